@@ -28,6 +28,7 @@
 #include <boost/filesystem/fstream.hpp>
 #include <exception>
 #include <iostream>
+#include <string_view>
 
 using namespace bcos;
 using namespace bcos::boostssl;
@@ -70,20 +71,37 @@ std::shared_ptr<boost::asio::ssl::context> ContextBuilder::buildSslContext(
 std::shared_ptr<boost::asio::ssl::context> ContextBuilder::buildSslContext(
     bool _server, const ContextConfig& _contextConfig)
 {
+    std::shared_ptr<boost::asio::ssl::context> sslContext;
     if (_contextConfig.isCertPath())
     {
-        if (_contextConfig.sslType() != "sm_ssl")
-        {
-            return buildSslContext(_contextConfig.certConfig());
-        }
-        return buildSslContext(_server, _contextConfig.smCertConfig());
+        sslContext = (_contextConfig.sslType() != "sm_ssl") ?
+                         buildSslContext(_contextConfig.certConfig()) :
+                         buildSslContext(_server, _contextConfig.smCertConfig());
     }
-
-    if (_contextConfig.sslType() != "sm_ssl")
+    else
+    {
+        sslContext = (_contextConfig.sslType() != "sm_ssl") ?
+                         buildSslContextByCertContent(_contextConfig.certConfig()) :
+                         buildSslContextByCertContent(_server, _contextConfig.smCertConfig());
+    }
+    if (_server)
     {
-        return buildSslContextByCertContent(_contextConfig.certConfig());
+        setSessionCache(*sslContext);
     }
-    return buildSslContextByCertContent(_server, _contextConfig.smCertConfig());
+    return sslContext;
+}
+
+void ContextBuilder::setSessionCache(boost::asio::ssl::context& _sslContext)
+{
+    // the reconnected clients resume the tls session by the session id or the session ticket
+    // instead of the full handshake, the session id context is required to resume the session
+    // when the peer certificate is verified
+    static const std::string_view sessionIdContext = "bcos-boostssl";
+    auto* ctx = _sslContext.native_handle();
+    SSL_CTX_set_session_id_context(ctx, (const unsigned char*)sessionIdContext.data(),
+        (unsigned int)sessionIdContext.size());
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+    SSL_CTX_sess_set_cache_size(ctx, SSL_SESSION_CACHE_SIZE);
 }
 
 std::shared_ptr<boost::asio::ssl::context> ContextBuilder::buildSslContext(
@@ -39,7 +39,11 @@ public:
     std::shared_ptr<boost::asio::ssl::context> buildSslContext(
         bool _server, const ContextConfig& _contextConfig);
 
+    // the max tls sessions cached by the server for resumption
+    constexpr static long SSL_SESSION_CACHE_SIZE = 20480;
+
 private:
+    void setSessionCache(boost::asio::ssl::context& _sslContext);
     std::shared_ptr<boost::asio::ssl::context> buildSslContext(
         const ContextConfig::CertConfig& _certConfig);
     std::shared_ptr<boost::asio::ssl::context> buildSslContext(
@@ -20,23 +20,30 @@
 #pragma once
 #include <bcos-boostssl/httpserver/Common.h>
 
+#include <deque>
+#include <mutex>
 #include <utility>
 
 namespace bcos::boostssl::http
 {
-// The queue for http request pipeline
+// The queue for http request pipeline, the responses are sent in the request order
 class Queue
 {
 private:
-    // the maximum number size of queue
+    // the maximum number of the requests read but not responded
     std::size_t m_limit;
-    // messages to be send
-    std::vector<HttpResponsePtr> m_allResp;
+    // the responses in the request order, nullptr if the request is not responded yet
+    std::deque<HttpResponsePtr> m_allResp;
+    // the sequence of the front of m_allResp
+    uint64_t m_frontSeq = 0;
+    // the front response is being written
+    bool m_sending = false;
+    mutable std::mutex x_allResp;
     // send handler
     std::function<void(HttpResponsePtr)> m_sender;
 
 public:
-    explicit Queue(std::size_t _limit = 16) : m_limit(_limit) { m_allResp.reserve(m_limit); }
+    explicit Queue(std::size_t _limit = 16) : m_limit(_limit) {}
 
     void setSender(std::function<void(HttpResponsePtr)> _sender) { m_sender = std::move(_sender); }
     std::function<void(HttpResponsePtr)> sender() const { return m_sender; }
@@ -45,31 +52,74 @@ public:
     void setLimit(std::size_t _limit) { m_limit = _limit; }
 
     // if the queue reached the m_limit
-    bool isFull() const { return m_allResp.size() >= m_limit; }
+    bool isFull() const
+    {
+        std::lock_guard lock(x_allResp);
+        return m_allResp.size() >= m_limit;
+    }
+
+    // reserve the position of the request read, returns the sequence to enqueue the response
+    uint64_t reserve()
+    {
+        std::lock_guard lock(x_allResp);
+        m_allResp.emplace_back();
+        return m_frontSeq + m_allResp.size() - 1;
+    }
 
     // called when a message finishes sending
     // returns `true` if the caller should initiate a read
     bool onWrite()
     {
-        BOOST_ASSERT(!m_allResp.empty());
-        auto const was_full = isFull();
-        m_allResp.erase(m_allResp.begin());
-        if (!m_allResp.empty())
+        HttpResponsePtr next;
+        bool wasFull = false;
+        {
+            std::lock_guard lock(x_allResp);
+            BOOST_ASSERT(!m_allResp.empty());
+            wasFull = m_allResp.size() >= m_limit;
+            m_allResp.pop_front();
+            ++m_frontSeq;
+            if (!m_allResp.empty() && m_allResp.front())
+            {
+                next = m_allResp.front();
+            }
+            else
+            {
+                m_sending = false;
+            }
+        }
+        if (next)
         {
-            m_sender(m_allResp.front());
+            m_sender(std::move(next));
         }
-        return was_full;
+        return wasFull;
     }
 
-    // enqueue and waiting called by the HTTP handler to send a response.
-    void enqueue(HttpResponsePtr _msg)
+    // called by the HTTP handler to send the response of the reserved request, the response
+    // waits until the responses of all the previous requests have been sent
+    void enqueue(uint64_t _seq, HttpResponsePtr _msg)
     {
-        m_allResp.push_back(std::move(_msg));
-        // there was no previous work, start this one
-        if (m_allResp.size() == 1)
+        HttpResponsePtr front;
+        {
+            std::lock_guard lock(x_allResp);
+            if (_seq < m_frontSeq || _seq - m_frontSeq >= m_allResp.size())
+            {
+                return;
+            }
+            m_allResp[_seq - m_frontSeq] = std::move(_msg);
+            // there was no previous work, start this one
+            if (!m_sending && m_allResp.front())
+            {
+                m_sending = true;
+                front = m_allResp.front();
+            }
+        }
+        if (front)
         {
-            m_sender(m_allResp.front());
+            m_sender(std::move(front));
         }
     }
+
+    // enqueue and waiting called by the HTTP handler to send a response.
+    void enqueue(HttpResponsePtr _msg) { enqueue(reserve(), std::move(_msg)); }
 };
 }  // namespace bcos::boostssl::http
@@ -166,6 +166,17 @@ void HttpServer::onAccept(boost::beast::error_code ec, boost::asio::ip::tcp::soc
                 return;
             }
 
+            // the verify callback is skipped for the resumed session, get the node id from the
+            // peer certificate stored in the session
+            if (SSL_session_reused(ss->native_handle()) && nodeId->empty())
+            {
+                if (auto* cert = SSL_get_peer_certificate(ss->native_handle()))
+                {
+                    NodeInfoTools::initSSLContextPubHexHandler()(cert, *nodeId);
+                    X509_free(cert);
+                }
+            }
+
             auto server = self.lock();
             if (server)
             {
@@ -196,15 +207,19 @@ HttpSession::Ptr HttpServer::buildHttpSession(
         // _httpResp->body())
         //                     << LOG_KV("keep_alive", _httpResp->keep_alive());
 
-        session->httpStream()->asyncWrite(*_httpResp,
-            [self, _httpResp](boost::beast::error_code ec, std::size_t bytes_transferred) {
-                auto session = self.lock();
-                if (!session)
-                {
-                    return;
-                }
-                session->onWrite(_httpResp->need_eof(), ec, bytes_transferred);
-            });
+        // the responses are enqueued by the rpc threads, write on the thread of the stream
+        auto httpStream = session->httpStream();
+        boost::asio::dispatch(httpStream->stream().get_executor(), [self, httpStream, _httpResp]() {
+            httpStream->asyncWrite(*_httpResp,
+                [self, _httpResp](boost::beast::error_code ec, std::size_t bytes_transferred) {
+                    auto session = self.lock();
+                    if (!session)
+                    {
+                        return;
+                    }
+                    session->onWrite(_httpResp->need_eof(), ec, bytes_transferred);
+                });
+        });
     });
 
     session->setQueue(queue);
@@ -122,6 +122,8 @@ public:
 
             HTTP_SESSION(INFO) << LOG_BADGE("onRead") << LOG_DESC("receive http request");
 
+            // the client wants to close the connection after this request, stop reading
+            m_keepAlive = m_parser->get().keep_alive();
             handleRequest(m_parser->release());
         }
         catch (...)
@@ -132,7 +134,9 @@ public:
                                          boost::current_exception_diagnostic_information());
         }
 
-        if (!m_queue->isFull())
+        // pipelining: read the next request without waiting for the response, the responses
+        // are sent in the request order by the queue
+        if (m_keepAlive && !m_queue->isFull())
         {
             doRead();
         }
@@ -158,7 +162,7 @@ public:
             return;
         }
 
-        if (m_queue->onWrite())
+        if (m_queue->onWrite() && m_keepAlive)
         {
             // read the next request
             doRead();
@@ -189,39 +193,44 @@ public:
 
         auto startT = utcTime();
         unsigned version = _httpRequest.version();
+        bool keepAlive = _httpRequest.keep_alive();
+        // the position of the response in the pipeline
+        auto seq = m_queue->reserve();
         auto self = std::weak_ptr<HttpSession>(shared_from_this());
         if (m_httpReqHandler)
         {
             std::string request = _httpRequest.body();
-            m_httpReqHandler(request, [self, version, startT](bcos::bytes _content) {
-                auto session = self.lock();
-                if (!session)
-                {
-                    return;
-                }
-                auto resp = session->buildHttpResp(
-                    boost::beast::http::status::ok, version, std::move(_content));
-                // put the response into the queue and waiting to be send
-                session->queue()->enqueue(resp);
-                BCOS_LOG(TRACE) << LOG_BADGE("handleRequest") << LOG_DESC("response")
-                                << LOG_KV("body", std::string_view((const char*)resp->body().data(),
-                                                      resp->body().size()))
-                                << LOG_KV("keep_alive", resp->keep_alive())
-                                << LOG_KV("timecost", (utcTime() - startT));
-            });
+            m_httpReqHandler(
+                request, [self, version, keepAlive, seq, startT](bcos::bytes _content) {
+                    auto session = self.lock();
+                    if (!session)
+                    {
+                        return;
+                    }
+                    auto resp = session->buildHttpResp(
+                        boost::beast::http::status::ok, version, std::move(_content), keepAlive);
+                    // put the response into the queue and waiting to be send
+                    session->queue()->enqueue(seq, resp);
+                    BCOS_LOG(TRACE) << LOG_BADGE("handleRequest") << LOG_DESC("response")
+                                    << LOG_KV("body",
+                                           std::string_view((const char*)resp->body().data(),
+                                               resp->body().size()))
+                                    << LOG_KV("keep_alive", resp->keep_alive())
+                                    << LOG_KV("timecost", (utcTime() - startT));
+                });
         }
         else
         {
             // unsupported http service
-            auto resp =
-                buildHttpResp(boost::beast::http::status::http_version_not_supported, version, {});
+            auto resp = buildHttpResp(
+                boost::beast::http::status::http_version_not_supported, version, {}, keepAlive);
             auto session = self.lock();
             if (!session)
             {
                 return;
             }
             // put the response into the queue and waiting to be send
-            session->queue()->enqueue(resp);
+            session->queue()->enqueue(seq, resp);
 
             HTTP_SESSION(WARNING) << LOG_BADGE("handleRequest")
                                   << LOG_DESC("unsupported http service")
@@ -235,15 +244,16 @@ public:
      * @brief: build http response object
      * @param status: http response status
      * @param content: http response content
+     * @param keepAlive: keep the connection alive after the response, follows the request
      * @return HttpResponsePtr:
      */
-    HttpResponsePtr buildHttpResp(
-        boost::beast::http::status status, unsigned version, bcos::bytes content)
+    HttpResponsePtr buildHttpResp(boost::beast::http::status status, unsigned version,
+        bcos::bytes content, bool keepAlive = true)
     {
         auto msg = std::make_shared<HttpResponse>(status, version);
         msg->set(boost::beast::http::field::server, BOOST_BEAST_VERSION_STRING);
         msg->set(boost::beast::http::field::content_type, "application/json");
-        msg->keep_alive(true);  // default , keep alive
+        msg->keep_alive(keepAlive);
         msg->body() = std::move(content);
         msg->prepare_payload();
         return msg;
@@ -283,6 +293,8 @@ private:
     boost::optional<boost::beast::http::request_parser<boost::beast::http::string_body>> m_parser;
 
     std::shared_ptr<std::string> m_nodeId;
+    // false after the request with "Connection: close" is read
+    bool m_keepAlive = true;
 };
 
 }  // namespace bcos::boostssl::http
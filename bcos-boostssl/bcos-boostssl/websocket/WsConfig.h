@@ -48,6 +48,15 @@ enum WsModel : uint16_t
     Mixed = Client | Server
 };
 
+// what to do when the messages waiting to be sent to a session exceed the limit
+enum class WsWriteQueuePolicy : uint16_t
+{
+    // drop the new message and respond with the WriteQueueOverflow error
+    DropMessage = 0,
+    // drop the session
+    Disconnect = 1,
+};
+
 class WsConfig
 {
 public:
@@ -89,6 +98,10 @@ private:
     // the max message to be send or read
     uint32_t m_maxMsgSize{DEFAULT_MAX_MESSAGE_SIZE};
 
+    // the max bytes waiting to be sent of a session, 0 means no limit
+    uint64_t m_maxWriteQueueSize{0};
+    WsWriteQueuePolicy m_writeQueuePolicy{WsWriteQueuePolicy::DropMessage};
+
 public:
     void setModel(WsModel _model) { m_model = _model; }
     WsModel model() const { return m_model; }
@@ -108,6 +121,15 @@ public:
     void setMaxMsgSize(uint32_t _maxMsgSize) { m_maxMsgSize = _maxMsgSize; }
     uint32_t maxMsgSize() const { return m_maxMsgSize; }
 
+    void setMaxWriteQueueSize(uint64_t _maxWriteQueueSize)
+    {
+        m_maxWriteQueueSize = _maxWriteQueueSize;
+    }
+    uint64_t maxWriteQueueSize() const { return m_maxWriteQueueSize; }
+
+    void setWriteQueuePolicy(WsWriteQueuePolicy _policy) { m_writeQueuePolicy = _policy; }
+    WsWriteQueuePolicy writeQueuePolicy() const { return m_writeQueuePolicy; }
+
     uint32_t reconnectPeriod() const
     {
         return m_reconnectPeriod > MIN_RECONNECT_PERIOD_MS ? m_reconnectPeriod :
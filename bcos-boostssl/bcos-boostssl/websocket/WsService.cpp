@@ -182,12 +182,14 @@ void WsService::reportConnectedNodes()
     for (auto const& session : ss)
     {
         auto writeQueueSize = session->writeQueueSize();
+        auto writeQueueBytes = session->writeQueueBytes();
         auto callbackQueueSize = session->callbackQueueSize();
         if (writeQueueSize > 0 || callbackQueueSize > 0)
         {
             WEBSOCKET_SERVICE(INFO) << LOG_BADGE("stat") << LOG_DESC("session write queue status")
                                     << LOG_KV("endpoint", session->endPoint())
                                     << LOG_KV("writeQueueSize", writeQueueSize)
+                                    << LOG_KV("writeQueueBytes", writeQueueBytes)
                                     << LOG_KV("callbackQueueSize", callbackQueueSize);
         }
         else
@@ -195,6 +197,7 @@ void WsService::reportConnectedNodes()
             WEBSOCKET_SERVICE(DEBUG) << LOG_BADGE("stat") << LOG_DESC("session write queue status")
                                      << LOG_KV("endpoint", session->endPoint())
                                      << LOG_KV("writeQueueSize", writeQueueSize)
+                                     << LOG_KV("writeQueueBytes", writeQueueBytes)
                                      << LOG_KV("callbackQueueSize", callbackQueueSize);
         }
     }
@@ -404,6 +407,8 @@ std::shared_ptr<WsSession> WsService::newSession(
     session->setMessageFactory(messageFactory());
     session->setEndPoint(endPoint);
     session->setMaxWriteMsgSize(m_config->maxMsgSize());
+    session->setMaxWriteQueueSize(m_config->maxWriteQueueSize());
+    session->setWriteQueuePolicy(m_config->writeQueuePolicy());
     session->setSendMsgTimeout(m_config->sendMsgTimeout());
     session->setNodeId(_nodeId);
 
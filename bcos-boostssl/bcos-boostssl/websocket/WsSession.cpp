@@ -267,15 +267,30 @@ void WsSession::onWritePacket()
         return;
     }
     m_writing = true;
-    auto msg = m_writeQueue.top();
-    m_writeQueue.pop();
+    auto msg = m_writeQueue.front();
+    m_writeQueue.pop_front();
     asyncWrite(msg->buffer);
 }
 
+bool WsSession::tryReserveWriteQueue(uint64_t _bytes)
+{
+    auto writeQueueBytes = m_writeQueueBytes.load();
+    do
+    {
+        // check and add in one step, the concurrent senders never exceed the limit together
+        if (m_maxWriteQueueSize > 0 && writeQueueBytes + _bytes > m_maxWriteQueueSize)
+        {
+            return false;
+        }
+    } while (!m_writeQueueBytes.compare_exchange_weak(writeQueueBytes, writeQueueBytes + _bytes));
+    return true;
+}
+
 void WsSession::asyncWrite(std::shared_ptr<bcos::bytes> _buffer)
 {
     if (!isConnected())
     {
+        m_writeQueueBytes -= _buffer->size();
         WEBSOCKET_SESSION(TRACE) << LOG_BADGE("asyncWrite")
                                  << LOG_DESC("session has been disconnected")
                                  << LOG_KV("endpoint", endPoint()) << LOG_KV("session", this);
@@ -294,6 +309,7 @@ void WsSession::asyncWrite(std::shared_ptr<bcos::bytes> _buffer)
                 {
                     return;
                 }
+                session->m_writeQueueBytes -= _buffer->size();
                 if (_ec)
                 {
                     BCOS_LOG(WARNING) << LOG_BADGE("Session") << LOG_BADGE("asyncWrite")
@@ -325,7 +341,7 @@ void WsSession::send(std::shared_ptr<bytes> buffer)
     {
         Guard lock(x_writeQueue);
         // data to be sent is always enqueue first
-        m_writeQueue.push(msg);
+        m_writeQueue.push_back(msg);
     }
     onWritePacket();
 }
@@ -394,6 +410,27 @@ void WsSession::asyncSendMessage(
         return;
     }
 
+    // the slow consumer should not hold the memory without limit
+    if (!tryReserveWriteQueue(buffer->size()))
+    {
+        WEBSOCKET_SESSION(WARNING)
+            << LOG_BADGE("asyncSendMessage") << LOG_DESC("the write queue is full")
+            << LOG_KV("endpoint", endPoint()) << LOG_KV("seq", seq)
+            << LOG_KV("msgSize", buffer->size()) << LOG_KV("writeQueueBytes", writeQueueBytes())
+            << LOG_KV("maxWriteQueueSize", m_maxWriteQueueSize)
+            << LOG_KV("policy", magic_enum::enum_name(m_writeQueuePolicy));
+        if (_respFunc)
+        {
+            auto error = BCOS_ERROR_PTR(WsError::WriteQueueOverflow, "Write queue overflow");
+            _respFunc(error, nullptr, nullptr);
+        }
+        if (m_writeQueuePolicy == WsWriteQueuePolicy::Disconnect)
+        {
+            drop(WsError::WriteQueueOverflow);
+        }
+        return;
+    }
+
     if (_respFunc)
     {  // callback
         auto callback = std::make_shared<CallBack>();
@@ -23,6 +23,7 @@
 #include "bcos-utilities/ObjectCounter.h"
 #include <bcos-boostssl/httpserver/Common.h>
 #include <bcos-boostssl/websocket/Common.h>
+#include <bcos-boostssl/websocket/WsConfig.h>
 #include <bcos-boostssl/websocket/WsMessage.h>
 #include <bcos-boostssl/websocket/WsStream.h>
 #include <bcos-utilities/Common.h>
@@ -35,9 +36,9 @@
 #include <boost/beast/websocket.hpp>
 #include <boost/thread/thread.hpp>
 #include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
-#include <queue>
 #include <shared_mutex>
 #include <unordered_map>
 #include <utility>
@@ -131,12 +132,26 @@ public:
     int32_t maxWriteMsgSize() const { return m_maxWriteMsgSize; }
     void setMaxWriteMsgSize(int32_t _maxWriteMsgSize) { m_maxWriteMsgSize = _maxWriteMsgSize; }
 
+    uint64_t maxWriteQueueSize() const { return m_maxWriteQueueSize; }
+    void setMaxWriteQueueSize(uint64_t _maxWriteQueueSize)
+    {
+        m_maxWriteQueueSize = _maxWriteQueueSize;
+    }
+
+    WsWriteQueuePolicy writeQueuePolicy() const { return m_writeQueuePolicy; }
+    void setWriteQueuePolicy(WsWriteQueuePolicy _policy) { m_writeQueuePolicy = _policy; }
+
     std::size_t writeQueueSize()
     {
         bcos::Guard lockGuard(x_writeQueue);
         return m_writeQueue.size();
     }
 
+    // the bytes of the messages accepted but not written yet
+    uint64_t writeQueueBytes() const { return m_writeQueueBytes.load(); }
+    // reserve the bytes of a message in the write queue, false if the queue is full
+    bool tryReserveWriteQueue(uint64_t _bytes);
+
     std::size_t callbackQueueSize()
     {
         bcos::Guard lockGuard(x_callback);
@@ -199,6 +214,9 @@ protected:
     int32_t m_sendMsgTimeout = -1;
     //
     int32_t m_maxWriteMsgSize = -1;
+    // the max bytes waiting to be sent, 0 means no limit
+    uint64_t m_maxWriteQueueSize = 0;
+    WsWriteQueuePolicy m_writeQueuePolicy = WsWriteQueuePolicy::DropMessage;
 
     //
     WsStreamDelegate::Ptr m_wsStreamDelegate;
@@ -218,10 +236,11 @@ protected:
 
     // ioc
     std::shared_ptr<boost::asio::io_context> m_ioc;
-    // send message queue
+    // send message queue, in the order of sending
     mutable bcos::Mutex x_writeQueue;
-    std::priority_queue<std::shared_ptr<Message>> m_writeQueue;
+    std::deque<std::shared_ptr<Message>> m_writeQueue;
     std::atomic_bool m_writing = {false};
+    std::atomic<uint64_t> m_writeQueueBytes = {0};
 };
 
 class WsSessionFactory
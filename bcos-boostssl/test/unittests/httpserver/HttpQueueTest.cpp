@@ -0,0 +1,74 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for the http pipeline queue
+ * @file HttpQueueTest.cpp
+ */
+
+#include <bcos-boostssl/httpserver/HttpQueue.h>
+
+#include <boost/test/unit_test.hpp>
+#include <memory>
+#include <vector>
+
+using namespace bcos;
+using namespace bcos::boostssl;
+using namespace bcos::boostssl::http;
+
+BOOST_AUTO_TEST_SUITE(HttpQueueTest)
+
+BOOST_AUTO_TEST_CASE(test_pipelineInOrder)
+{
+    auto queue = std::make_shared<Queue>(3);
+    std::vector<HttpResponsePtr> sent;
+    queue->setSender([&sent](HttpResponsePtr _resp) { sent.push_back(std::move(_resp)); });
+
+    auto seq0 = queue->reserve();
+    auto seq1 = queue->reserve();
+    BOOST_CHECK(!queue->isFull());
+    auto seq2 = queue->reserve();
+    BOOST_CHECK(queue->isFull());
+
+    auto resp0 = std::make_shared<HttpResponse>();
+    auto resp1 = std::make_shared<HttpResponse>();
+    auto resp2 = std::make_shared<HttpResponse>();
+
+    // the later responses wait for the first one
+    queue->enqueue(seq2, resp2);
+    queue->enqueue(seq1, resp1);
+    BOOST_CHECK(sent.empty());
+
+    queue->enqueue(seq0, resp0);
+    BOOST_CHECK_EQUAL(sent.size(), 1U);
+    BOOST_CHECK_EQUAL(sent[0], resp0);
+
+    // the queue was full, the caller should read the next request
+    BOOST_CHECK(queue->onWrite());
+    BOOST_CHECK_EQUAL(sent.size(), 2U);
+    BOOST_CHECK_EQUAL(sent[1], resp1);
+
+    BOOST_CHECK(!queue->onWrite());
+    BOOST_CHECK_EQUAL(sent.size(), 3U);
+    BOOST_CHECK_EQUAL(sent[2], resp2);
+    BOOST_CHECK(!queue->onWrite());
+
+    // the queue is idle, the response is sent at once
+    auto resp3 = std::make_shared<HttpResponse>();
+    queue->enqueue(resp3);
+    BOOST_CHECK_EQUAL(sent.size(), 4U);
+    BOOST_CHECK_EQUAL(sent[3], resp3);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -72,6 +72,13 @@ BOOST_AUTO_TEST_CASE(test_WsConfigTest)
         auto peers = std::make_shared<EndPoints>();
         config->setConnectPeers(peers);
         BOOST_CHECK_EQUAL(config->connectPeers()->size(), 0);
+
+        BOOST_CHECK_EQUAL(config->maxWriteQueueSize(), 0U);
+        BOOST_CHECK(config->writeQueuePolicy() == WsWriteQueuePolicy::DropMessage);
+        config->setMaxWriteQueueSize(1024);
+        config->setWriteQueuePolicy(WsWriteQueuePolicy::Disconnect);
+        BOOST_CHECK_EQUAL(config->maxWriteQueueSize(), 1024U);
+        BOOST_CHECK(config->writeQueuePolicy() == WsWriteQueuePolicy::Disconnect);
     }
 }
 
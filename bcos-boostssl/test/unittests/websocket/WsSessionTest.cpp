@@ -0,0 +1,66 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for WsSession
+ * @file WsSessionTest.cpp
+ */
+
+#include <bcos-boostssl/websocket/WsSession.h>
+#include <boost/test/unit_test.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace bcos;
+using namespace bcos::boostssl;
+using namespace bcos::boostssl::ws;
+
+BOOST_AUTO_TEST_SUITE(WsSessionTest)
+
+BOOST_AUTO_TEST_CASE(test_reserveWriteQueue)
+{
+    tbb::task_group taskGroup;
+    auto session = std::make_shared<WsSession>(taskGroup);
+
+    // no limit
+    BOOST_CHECK(session->tryReserveWriteQueue(1024 * 1024));
+    BOOST_CHECK_EQUAL(session->writeQueueBytes(), 1024 * 1024U);
+
+    // the concurrent senders reserve exactly up to the limit together
+    auto session2 = std::make_shared<WsSession>(taskGroup);
+    session2->setMaxWriteQueueSize(1000);
+    std::atomic<size_t> reserved = 0;
+    std::vector<std::thread> senders;
+    for (int i = 0; i < 8; ++i)
+    {
+        senders.emplace_back([&]() {
+            for (int j = 0; j < 100; ++j)
+            {
+                if (session2->tryReserveWriteQueue(100))
+                {
+                    ++reserved;
+                }
+            }
+        });
+    }
+    for (auto& sender : senders)
+    {
+        sender.join();
+    }
+    BOOST_CHECK_EQUAL(reserved.load(), 10U);
+    BOOST_CHECK_EQUAL(session2->writeQueueBytes(), 1000U);
+    BOOST_CHECK(!session2->tryReserveWriteQueue(1));
+}
+BOOST_AUTO_TEST_SUITE_END()
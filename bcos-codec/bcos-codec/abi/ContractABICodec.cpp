@@ -136,7 +136,7 @@ bytes ContractABICodec::serialise(std::string_view _in)
     bytes ret;
     ret = h256(u256(_in.size())).asBytes();
     ret.resize(ret.size() + (_in.size() + 31) / MAX_BYTE_LENGTH * MAX_BYTE_LENGTH);
-    bytesConstRef(_in.data()).populate(bytesRef(&ret).getCroppedData(32));
+    bytesConstRef((const byte*)_in.data(), _in.size()).populate(bytesRef(&ret).getCroppedData(32));
     return ret;
 }
 
@@ -190,19 +190,30 @@ void ContractABICodec::deserialize(string32& _out, std::size_t _offset)
 
 void ContractABICodec::deserialize(std::string& _out, std::size_t _offset)
 {
-    validOffset(_offset + MAX_BYTE_LENGTH - 1);
-
-    u256 len = fromBigEndian<u256>(data.getCroppedData(_offset, MAX_BYTE_LENGTH));
-    validOffset(_offset + MAX_BYTE_LENGTH + (std::size_t)len - 1);
-    auto result = data.getCroppedData(_offset + MAX_BYTE_LENGTH, static_cast<size_t>(len));
+    auto result = dynamicData(_offset);
     _out.assign((const char*)result.data(), result.size());
 }
 
 void ContractABICodec::deserialize(bytes& _out, std::size_t _offset)
 {
-    validOffset(_offset + MAX_BYTE_LENGTH - 1);
+    _out = dynamicData(_offset).toBytes();
+}
+
+void ContractABICodec::deserialize(std::string_view& _out, std::size_t _offset)
+{
+    auto result = dynamicData(_offset);
+    _out = std::string_view((const char*)result.data(), result.size());
+}
+
+void ContractABICodec::deserialize(bytesConstRef& _out, std::size_t _offset)
+{
+    _out = dynamicData(_offset);
+}
 
-    u256 len = fromBigEndian<u256>(data.getCroppedData(_offset, MAX_BYTE_LENGTH));
-    validOffset(_offset + MAX_BYTE_LENGTH + (std::size_t)len - 1);
-    _out = data.getCroppedData(_offset + MAX_BYTE_LENGTH, static_cast<size_t>(len)).toBytes();
-}
\ No newline at end of file
+void ContractABICodec::serialiseTo(bytes& _out, bytesConstRef _in)
+{
+    serialiseWordTo(_out, u256(_in.size()));
+    _out.insert(_out.end(), _in.begin(), _in.end());
+    // zero padding
+    _out.resize(_out.size() + paddedSize(_in.size()) - _in.size());
+}
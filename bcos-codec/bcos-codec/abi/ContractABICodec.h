@@ -44,6 +44,17 @@ struct ABIElementType<std::string> : std::true_type
 {
 };
 
+// views into the decoded data
+template <>
+struct ABIElementType<std::string_view> : std::true_type
+{
+};
+
+template <>
+struct ABIElementType<bytesConstRef> : std::true_type
+{
+};
+
 template <>
 struct ABIElementType<std::uint8_t> : std::false_type
 {
@@ -346,6 +357,66 @@ public:
     template <class... T>
     bytes serialise(const std::tuple<T...>& _in);
 
+    // the size of the encoded value, the offset of a dynamic value in the head is not included
+    template <class T>
+        requires std::is_arithmetic_v<T>
+    static std::size_t encodedSize(const T&)
+    {
+        return MAX_BYTE_LENGTH;
+    }
+    static std::size_t encodedSize(const u256&) { return MAX_BYTE_LENGTH; }
+    static std::size_t encodedSize(const s256&) { return MAX_BYTE_LENGTH; }
+    static std::size_t encodedSize(const Address&) { return MAX_BYTE_LENGTH; }
+    static std::size_t encodedSize(const string32&) { return MAX_BYTE_LENGTH; }
+    static std::size_t encodedSize(bytesConstRef _in)
+    {
+        return MAX_BYTE_LENGTH + paddedSize(_in.size());
+    }
+    static std::size_t encodedSize(const bytes& _in)
+    {
+        return MAX_BYTE_LENGTH + paddedSize(_in.size());
+    }
+    static std::size_t encodedSize(std::string_view _in)
+    {
+        return MAX_BYTE_LENGTH + paddedSize(_in.size());
+    }
+    static std::size_t encodedSize(const std::string& _in)
+    {
+        return MAX_BYTE_LENGTH + paddedSize(_in.size());
+    }
+    template <class T, std::size_t N>
+    static std::size_t encodedSize(const std::array<T, N>& _in);
+    template <class T>
+    static std::size_t encodedSize(const std::vector<T>& _in);
+    template <class... T>
+    static std::size_t encodedSize(const std::tuple<T...>& _in);
+
+    // append the encoded value to _out, the strings and the bytes are copied once
+    template <class T>
+    void serialiseTo(bytes& _out, const T& _in)
+    {
+        _out += serialise(_in);
+    }
+    static void serialiseTo(bytes& _out, bytesConstRef _in);
+    static void serialiseTo(bytes& _out, const bytes& _in)
+    {
+        serialiseTo(_out, bytesConstRef(_in.data(), _in.size()));
+    }
+    static void serialiseTo(bytes& _out, std::string_view _in)
+    {
+        serialiseTo(_out, bytesConstRef((const byte*)_in.data(), _in.size()));
+    }
+    static void serialiseTo(bytes& _out, const std::string& _in)
+    {
+        serialiseTo(_out, std::string_view(_in));
+    }
+    template <class T, std::size_t N>
+    void serialiseTo(bytes& _out, const std::array<T, N>& _in);
+    template <class T>
+    void serialiseTo(bytes& _out, const std::vector<T>& _in);
+    template <class... T>
+    void serialiseTo(bytes& _out, const std::tuple<T...>& _in);
+
     template <class T, std::enable_if_t<!std::is_integral_v<T>>>
     void deserialize(const T& _t, std::size_t _offset)
     {  // unsupport type
@@ -384,6 +455,9 @@ public:
 
     void deserialize(std::string& _out, std::size_t _offset);
     void deserialize(bytes& _out, std::size_t _offset);
+    // views into the data passed to abiOut, valid while the data is alive
+    void deserialize(std::string_view& _out, std::size_t _offset);
+    void deserialize(bytesConstRef& _out, std::size_t _offset);
 
     // static array
     template <class T, std::size_t N>
@@ -398,11 +472,8 @@ public:
 private:
     const bcos::crypto::Hash& m_hashImpl;
     static const int MAX_BYTE_LENGTH = 32;
-    // encode or decode offset
+    // decode offset
     std::size_t offset{0};
-    // encode temp bytes
-    bytes fixed;
-    bytes dynamic;
 
     // decode data
     bytesConstRef data;
@@ -422,33 +493,82 @@ private:
         }
     }
 
-    template <class T>
-    std::string toString(const T& _t)
+    // the content of the bytes or string at _offset
+    // Note: the decoded input of the transactions is part of the consensus, the checks are the same
+    // as the decoding into the copies before, the length truncated to size_t included
+    bytesConstRef dynamicData(std::size_t _offset)
     {
-        std::stringstream ss;
-        ss << _t;
-        return ss.str();
+        validOffset(_offset + MAX_BYTE_LENGTH - 1);
+        u256 length = fromBigEndian<u256>(data.getCroppedData(_offset, MAX_BYTE_LENGTH));
+        auto size = static_cast<std::size_t>(length);
+        validOffset(_offset + MAX_BYTE_LENGTH + size - 1);
+        return data.getCroppedData(_offset + MAX_BYTE_LENGTH, size);
     }
 
-    inline void abiInAux() { return; }
+    // fail before allocating the items of an array whose heads can't fit in the data, the
+    // decoding fails on reading the heads anyway, the items without head are not checked
+    void validArrayLength(std::size_t _length, std::size_t _itemSize, std::size_t _offset)
+    {
+        if (_itemSize == 0 || _length == 0)
+        {
+            return;
+        }
+        if (_offset > data.size() || _length > (data.size() - _offset) / _itemSize)
+        {
+            throw std::length_error(" deserialize failed, invalid array length " +
+                                    std::to_string(_length) + " at offset " +
+                                    std::to_string(_offset));
+        }
+    }
 
-    template <class T, class... U>
-    void abiInAux(T const& _t, U const&... _u)
+    static std::size_t paddedSize(std::size_t _size)
     {
-        bytes out = serialise(_t);
+        return (_size + MAX_BYTE_LENGTH - 1) / MAX_BYTE_LENGTH * MAX_BYTE_LENGTH;
+    }
 
-        if (ABIDynamicType<T>::value)
-        {  // dynamic type
-            dynamic += out;
-            fixed += serialise((u256)offset);
-            offset += out.size();
+    static void serialiseWordTo(bytes& _out, const u256& _in)
+    {
+        h256 word(_in);
+        _out.insert(_out.end(), word.data(), word.data() + MAX_BYTE_LENGTH);
+    }
+
+    // the size of the item in the head and the tail
+    template <class T>
+    static std::size_t itemSize(const T& _t)
+    {
+        return ABIDynamicType<T>::value ? MAX_BYTE_LENGTH + encodedSize(_t) : encodedSize(_t);
+    }
+
+    // the offset of the dynamic item or the static item
+    template <class T>
+    void serialiseHeadTo(bytes& _out, const T& _t, std::size_t& _dynamicOffset)
+    {
+        if constexpr (ABIDynamicType<T>::value)
+        {
+            serialiseWordTo(_out, u256(_dynamicOffset));
+            _dynamicOffset += encodedSize(_t);
         }
         else
-        {  // static type
-            fixed += out;
+        {
+            serialiseTo(_out, _t);
         }
+    }
 
-        abiInAux(_u...);
+    template <class T>
+    void serialiseTailTo(bytes& _out, const T& _t)
+    {
+        if constexpr (ABIDynamicType<T>::value)
+        {
+            serialiseTo(_out, _t);
+        }
+    }
+
+    template <class T>
+    std::string toString(const T& _t)
+    {
+        std::stringstream ss;
+        ss << _t;
+        return ss.str();
     }
 
     void abiOutAux() { return; }
@@ -514,15 +634,32 @@ public:
     template <class... T>
     bytes abiIn(const std::string& _sig, T const&... _t)
     {
-        offset = Offset<T...>::value * MAX_BYTE_LENGTH;
-        fixed.clear();
-        dynamic.clear();
+        bytes out;
+        abiInTo(out, _sig, _t...);
+        return out;
+    }
 
-        abiInAux(_t...);
+    // the size of abiIn, computed without encoding
+    template <class... T>
+    std::size_t abiInSize(const std::string& _sig, T const&... _t) const
+    {
+        return (_sig.empty() ? 0 : 4) + (itemSize(_t) + ... + 0);
+    }
 
-        return _sig.empty() ?
-                   fixed + dynamic :
-                   m_hashImpl.hash(_sig).ref().getCroppedData(0, 4).toBytes() + fixed + dynamic;
+    // append the encoding to _out, which is allocated once by the computed size, then the head
+    // and the tail are written in place
+    template <class... T>
+    void abiInTo(bytes& _out, const std::string& _sig, T const&... _t)
+    {
+        _out.reserve(_out.size() + abiInSize(_sig, _t...));
+        if (!_sig.empty())
+        {
+            auto hash = m_hashImpl.hash(_sig);
+            _out.insert(_out.end(), hash.data(), hash.data() + 4);
+        }
+        std::size_t dynamicOffset = Offset<T...>::value * MAX_BYTE_LENGTH;
+        (serialiseHeadTo(_out, _t, dynamicOffset), ...);
+        (serialiseTailTo(_out, _t), ...);
     }
 
     template <class... T>
@@ -607,6 +744,72 @@ bytes ContractABICodec::serialise(const std::tuple<T...>& _in)
     return offsetBytes + dynamicContent;
 }
 
+template <class T, std::size_t N>
+std::size_t ContractABICodec::encodedSize(const std::array<T, N>& _in)
+{
+    std::size_t size = 0;
+    for (const auto& e : _in)
+    {
+        size += itemSize(e);
+    }
+    return size;
+}
+
+template <class T>
+std::size_t ContractABICodec::encodedSize(const std::vector<T>& _in)
+{
+    std::size_t size = MAX_BYTE_LENGTH;
+    for (const auto& t : _in)
+    {
+        size += itemSize(t);
+    }
+    return size;
+}
+
+template <class... T>
+std::size_t ContractABICodec::encodedSize(const std::tuple<T...>& _in)
+{
+    return std::apply([](const auto&... _item) { return (itemSize(_item) + ... + 0); }, _in);
+}
+
+template <class T, std::size_t N>
+void ContractABICodec::serialiseTo(bytes& _out, const std::array<T, N>& _in)
+{
+    std::size_t dynamicOffset = N * MAX_BYTE_LENGTH;
+    for (const auto& e : _in)
+    {
+        serialiseHeadTo(_out, e, dynamicOffset);
+    }
+    for (const auto& e : _in)
+    {
+        serialiseTailTo(_out, e);
+    }
+}
+
+template <class T>
+void ContractABICodec::serialiseTo(bytes& _out, const std::vector<T>& _in)
+{
+    serialiseWordTo(_out, u256(_in.size()));
+    std::size_t dynamicOffset = _in.size() * MAX_BYTE_LENGTH;
+    for (const auto& t : _in)
+    {
+        serialiseHeadTo(_out, t, dynamicOffset);
+    }
+    for (const auto& t : _in)
+    {
+        serialiseTailTo(_out, t);
+    }
+}
+
+template <class... T>
+void ContractABICodec::serialiseTo(bytes& _out, const std::tuple<T...>& _in)
+{
+    std::size_t dynamicOffset = sizeof...(T) * MAX_BYTE_LENGTH;
+    std::apply([&](const auto&... _item) { (serialiseHeadTo(_out, _item, dynamicOffset), ...); },
+        _in);
+    std::apply([&](const auto&... _item) { (serialiseTailTo(_out, _item), ...); }, _in);
+}
+
 template <class T, std::size_t N>
 void ContractABICodec::deserialize(std::array<T, N>& _out, std::size_t _offset)
 {
@@ -637,6 +840,7 @@ void ContractABICodec::deserialize(std::vector<T>& _out, std::size_t _offset)
     // vector length
     deserialize(length, _offset);
     _offset += MAX_BYTE_LENGTH;
+    validArrayLength(static_cast<std::size_t>(length), Offset<T>::value * MAX_BYTE_LENGTH, _offset);
     _out.resize(static_cast<std::size_t>(length));
 
     for (std::size_t u = 0; u < static_cast<std::size_t>(length); ++u)
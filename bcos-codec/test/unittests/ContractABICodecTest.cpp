@@ -1139,6 +1139,115 @@ BOOST_AUTO_TEST_CASE(wrapper)
     BOOST_CHECK_EQUAL(encoded1, encoded2);
 }
 
+BOOST_AUTO_TEST_CASE(decodeView)
+{
+    auto hashImpl = std::make_shared<Keccak256>();
+    ContractABICodec abi(*hashImpl);
+
+    std::string key(100, 'k');
+    std::vector<std::string> values{"", std::string(33, 'v'), "value"};
+    bytes payload(64, 0x1f);
+    auto encoded = abi.abiIn("", u256(1), key, values, payload,
+        std::tuple<std::string, std::vector<std::string>>(key, values));
+
+    u256 number;
+    std::string_view keyView;
+    std::vector<std::string_view> valueViews;
+    bytesConstRef payloadView;
+    std::tuple<std::string_view, std::vector<std::string_view>> tupleView;
+    BOOST_CHECK(abi.abiOut(ref(encoded), number, keyView, valueViews, payloadView, tupleView));
+    BOOST_CHECK_EQUAL(number, 1);
+    BOOST_CHECK_EQUAL(keyView, key);
+    // a view into the encoded data
+    BOOST_CHECK((const byte*)keyView.data() >= encoded.data() &&
+                (const byte*)keyView.data() < encoded.data() + encoded.size());
+    BOOST_REQUIRE_EQUAL(valueViews.size(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(valueViews[i], values[i]);
+    }
+    BOOST_CHECK(payloadView.toBytes() == payload);
+    BOOST_CHECK_EQUAL(std::get<0>(tupleView), key);
+    BOOST_CHECK_EQUAL(std::get<1>(tupleView).size(), values.size());
+
+    // the views encode the same as the strings
+    BOOST_CHECK(abi.abiIn("", u256(1), keyView, valueViews, payloadView,
+                    std::tuple<std::string_view, std::vector<std::string_view>>(
+                        std::get<0>(tupleView), std::get<1>(tupleView))) == encoded);
+}
+
+BOOST_AUTO_TEST_CASE(decodeMalformed)
+{
+    auto hashImpl = std::make_shared<Keccak256>();
+    ContractABICodec abi(*hashImpl);
+
+    // offset 32, length 2^255 of the string, converted to size_t it's decoded to an empty string
+    // without failing, as the decoding has always done
+    bytes encoded = abi.abiIn("", u256(32), u256(u256(1) << 255));
+    std::string value = "value";
+    std::string_view view = "view";
+    BOOST_CHECK(abi.abiOut(ref(encoded), value));
+    BOOST_CHECK(abi.abiOut(ref(encoded), view));
+    BOOST_CHECK(value.empty());
+    BOOST_CHECK(view.empty());
+
+    // the length is larger than the data
+    encoded = abi.abiIn("", u256(32), u256(64), u256(0));
+    BOOST_CHECK(!abi.abiOut(ref(encoded), value));
+    BOOST_CHECK(!abi.abiOut(ref(encoded), view));
+
+    // the heads of the items can't fit in the data, failed before allocating them
+    encoded = abi.abiIn("", u256(32), u256(u256(1) << 40), u256(0));
+    std::vector<u256> numbers;
+    std::vector<std::string> strings;
+    BOOST_CHECK(!abi.abiOut(ref(encoded), numbers));
+    BOOST_CHECK(!abi.abiOut(ref(encoded), strings));
+    BOOST_CHECK(numbers.empty());
+
+    // the items without head
+    encoded = abi.abiIn("", u256(32), u256(3));
+    std::vector<std::array<u256, 0>> empties;
+    BOOST_CHECK(abi.abiOut(ref(encoded), empties));
+    BOOST_CHECK_EQUAL(empties.size(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(encodeTo)
+{
+    auto hashImpl = std::make_shared<Keccak256>();
+    ContractABICodec abi(*hashImpl);
+
+    std::vector<std::tuple<std::string, std::string>> fields{{"a", std::string(40, 'b')}, {"", ""}};
+    std::array<std::string, 2> array{"c", std::string(64, 'd')};
+    auto encoded = abi.abiIn("f(string,(string,string)[],string[2],uint256,bytes)",
+        std::string(31, 'e'), fields, array, u256(7), bytes(33, 1));
+    BOOST_CHECK_EQUAL(encoded.size(),
+        abi.abiInSize("f(string,(string,string)[],string[2],uint256,bytes)", std::string(31, 'e'),
+            fields, array, u256(7), bytes(33, 1)));
+
+    std::string decoded;
+    std::vector<std::tuple<std::string, std::string>> decodedFields;
+    std::array<std::string, 2> decodedArray;
+    u256 number;
+    bytes decodedBytes;
+    BOOST_CHECK(abi.abiOut(ref(encoded).getCroppedData(4), decoded, decodedFields, decodedArray,
+        number, decodedBytes));
+    BOOST_CHECK_EQUAL(decoded, std::string(31, 'e'));
+    BOOST_CHECK(decodedFields == fields);
+    BOOST_CHECK(decodedArray == array);
+    BOOST_CHECK_EQUAL(number, 7);
+    BOOST_CHECK(decodedBytes == bytes(33, 1));
+
+    // the same as serialise
+    BOOST_CHECK(abi.abiIn("", fields) == abi.serialise(u256(32)) + abi.serialise(fields));
+    BOOST_CHECK(abi.abiIn("", array) == abi.serialise(u256(32)) + abi.serialise(array));
+
+    // appended to the buffer
+    bytes buffer{0xff};
+    abi.abiInTo(buffer, "", u256(7));
+    BOOST_CHECK_EQUAL(buffer.size(), 33);
+    BOOST_CHECK_EQUAL(buffer.back(), 7);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
\ No newline at end of file
@@ -106,12 +106,20 @@ bytes getComponentBytes(size_t index, const std::string& typeName, const bytesCo
         const uint8_t* dynamicArrayLenData = data.data() + indexOffset + offsetBegin;
         std::reverse_copy(
             dynamicArrayLenData, dynamicArrayLenData + sizeof(uint64_t), (uint8_t*)&offset);
+        if (offset > data.size() - slotSize)
+        {  // the offset is out of the input
+            return {};
+        }
         const uint8_t* dynamicArray = data.data() + offset;
         uint64_t dataLength = 0;
         // dataLength is the length of the string or bytes
         // dynamicArray = [32 bytes length, dataLength bytes data]
         std::reverse_copy(
             dynamicArray + offsetBegin, dynamicArray + slotSize, (uint8_t*)&dataLength);
+        if (dataLength > data.size() - offset - slotSize)
+        {  // the length is out of the input
+            return {};
+        }
         const uint8_t* rawData = dynamicArray + slotSize;
         return {rawData, rawData + dataLength};
     }
@@ -46,6 +46,18 @@ const char* const CRYPTO_METHOD_SM2_VERIFY_STR = "sm2Verify(bytes32,bytes,bytes3
 // the params are (vrfInput, vrfPublicKey, vrfProof)
 const char* const CRYPTO_METHOD_CURVE25519_VRF_VERIFY_STR =
     "curve25519VRFVerify(bytes,bytes,bytes)";
+// batch interfaces, enabled by feature_crypto_batch
+const char* const CRYPTO_METHOD_SM3_BATCH_STR = "sm3Batch(bytes[])";
+const char* const CRYPTO_METHOD_KECCAK256_BATCH_STR = "keccak256HashBatch(bytes[])";
+const char* const CRYPTO_METHOD_SM2_VERIFY_BATCH_STR =
+    "sm2VerifyBatch(bytes32[],bytes[],bytes32[],bytes32[])";
+// the signature is r(32) s(32) v(1)
+const char* const CRYPTO_METHOD_ECRECOVER_BATCH_STR = "ecrecoverBatch(bytes32[],bytes[])";
+
+namespace
+{
+constexpr size_t ECRECOVER_SIGNATURE_SIZE = 65;
+}  // namespace
 
 CryptoPrecompiled::CryptoPrecompiled(crypto::Hash::Ptr _hashImpl) : Precompiled(_hashImpl)
 {
@@ -56,6 +68,14 @@ CryptoPrecompiled::CryptoPrecompiled(crypto::Hash::Ptr _hashImpl) : Precompiled(
         getFuncSelector(CRYPTO_METHOD_SM2_VERIFY_STR, _hashImpl);
     name2Selector[CRYPTO_METHOD_CURVE25519_VRF_VERIFY_STR] =
         getFuncSelector(CRYPTO_METHOD_CURVE25519_VRF_VERIFY_STR, _hashImpl);
+    name2Selector[CRYPTO_METHOD_SM3_BATCH_STR] =
+        getFuncSelector(CRYPTO_METHOD_SM3_BATCH_STR, _hashImpl);
+    name2Selector[CRYPTO_METHOD_KECCAK256_BATCH_STR] =
+        getFuncSelector(CRYPTO_METHOD_KECCAK256_BATCH_STR, _hashImpl);
+    name2Selector[CRYPTO_METHOD_SM2_VERIFY_BATCH_STR] =
+        getFuncSelector(CRYPTO_METHOD_SM2_VERIFY_BATCH_STR, _hashImpl);
+    name2Selector[CRYPTO_METHOD_ECRECOVER_BATCH_STR] =
+        getFuncSelector(CRYPTO_METHOD_ECRECOVER_BATCH_STR, _hashImpl);
 }
 
 std::shared_ptr<PrecompiledExecResult> CryptoPrecompiled::call(
@@ -101,6 +121,23 @@ std::shared_ptr<PrecompiledExecResult> CryptoPrecompiled::call(
     {
         curve25519VRFVerify(_executive, paramData, _callParameters);
     }
+    else if ((funcSelector == name2Selector[CRYPTO_METHOD_SM3_BATCH_STR] ||
+                 funcSelector == name2Selector[CRYPTO_METHOD_KECCAK256_BATCH_STR]) &&
+             blockContext.features().get(ledger::Features::Flag::feature_crypto_batch))
+    {
+        hashBatch(_executive, paramData, _callParameters, gasPricer,
+            funcSelector == name2Selector[CRYPTO_METHOD_SM3_BATCH_STR]);
+    }
+    else if (funcSelector == name2Selector[CRYPTO_METHOD_SM2_VERIFY_BATCH_STR] &&
+             blockContext.features().get(ledger::Features::Flag::feature_crypto_batch))
+    {
+        sm2VerifyBatch(_executive, paramData, _callParameters, gasPricer);
+    }
+    else if (funcSelector == name2Selector[CRYPTO_METHOD_ECRECOVER_BATCH_STR] &&
+             blockContext.features().get(ledger::Features::Flag::feature_crypto_batch))
+    {
+        ecrecoverBatch(_executive, paramData, _callParameters, gasPricer);
+    }
     else
     {
         // no defined function
@@ -194,3 +231,127 @@ void CryptoPrecompiled::sm2Verify(const std::shared_ptr<executor::TransactionExe
         _callResult->setExecResult(codec.encode(false, emptyAccount));
     }
 }
+
+void CryptoPrecompiled::hashBatch(const std::shared_ptr<executor::TransactionExecutive>& _executive,
+    bytesConstRef _paramData, PrecompiledExecResult::Ptr _callResult,
+    PrecompiledGas::Ptr const& _gasPricer, bool _isSM3)
+{
+    const auto& blockContext = _executive->blockContext();
+    auto codec = CodecWrapper(blockContext.hashHandler(), blockContext.isWasm());
+    std::vector<bytes> inputs;
+    codec.decode(_paramData, inputs);
+    checkBatchSize("CryptoPrecompiled", inputs.size());
+
+    std::vector<string32> hashes(inputs.size());
+    forEachBatchItem(inputs.size(), [&](size_t _index) {
+        auto hash = _isSM3 ? crypto::sm3Hash(ref(inputs[_index])) :
+                             crypto::keccak256Hash(ref(inputs[_index]));
+        hashes[_index] = codec::toString32(hash);
+    });
+    for (auto const& input : inputs)
+    {
+        auto words = (input.size() + GasMetrics::MemUnitSize - 1) / GasMetrics::MemUnitSize;
+        _gasPricer->appendOperation(InterfaceOpcode::HashWord, words);
+    }
+    _gasPricer->appendOperation(InterfaceOpcode::Hash, inputs.size());
+    PRECOMPILED_LOG(TRACE) << LOG_DESC("CryptoPrecompiled: hashBatch") << LOG_KV("sm3", _isSM3)
+                           << LOG_KV("size", inputs.size());
+    _callResult->setExecResult(codec.encode(hashes));
+}
+
+void CryptoPrecompiled::sm2VerifyBatch(
+    const std::shared_ptr<executor::TransactionExecutive>& _executive, bytesConstRef _paramData,
+    PrecompiledExecResult::Ptr _callResult, PrecompiledGas::Ptr const& _gasPricer)
+{
+    const auto& blockContext = _executive->blockContext();
+    auto codec = CodecWrapper(blockContext.hashHandler(), blockContext.isWasm());
+    std::vector<string32> messages;
+    std::vector<bytes> publicKeys;
+    std::vector<string32> rs;
+    std::vector<string32> ss;
+    codec.decode(_paramData, messages, publicKeys, rs, ss);
+    checkBatchSize("CryptoPrecompiled", messages.size());
+    if (publicKeys.size() != messages.size() || rs.size() != messages.size() ||
+        ss.size() != messages.size())
+    {
+        BOOST_THROW_EXCEPTION(bcos::protocol::PrecompiledError(
+            "CryptoPrecompiled sm2VerifyBatch params size mismatch"));
+    }
+
+    std::vector<Address> accounts(messages.size());
+    std::vector<uint8_t> verified(messages.size(), 0);
+    forEachBatchItem(messages.size(), [&](size_t _index) {
+        try
+        {
+            auto signatureData = std::make_shared<SignatureDataWithPub>(fromString32(rs[_index]),
+                fromString32(ss[_index]), ref(publicKeys[_index]));
+            auto publicKey =
+                crypto::sm2Recover(fromString32(messages[_index]), ref(*(signatureData->encode())));
+            if (publicKey)
+            {
+                accounts[_index] = right160(crypto::sm3Hash(
+                    bytesConstRef(publicKey->data().data(), publicKey->data().size())));
+                verified[_index] = 1;
+            }
+        }
+        catch (std::exception const& e)
+        {
+            PRECOMPILED_LOG(DEBUG) << LOG_DESC("CryptoPrecompiled: sm2VerifyBatch exception")
+                                   << LOG_KV("index", _index)
+                                   << LOG_KV("e", boost::diagnostic_information(e));
+        }
+    });
+    _gasPricer->appendOperation(InterfaceOpcode::SignatureVerify, messages.size());
+    bool verifySuccess = std::all_of(verified.begin(), verified.end(), [](uint8_t _verified) {
+        return _verified != 0;
+    });
+    PRECOMPILED_LOG(TRACE) << LOG_DESC("CryptoPrecompiled: sm2VerifyBatch")
+                           << LOG_KV("size", messages.size())
+                           << LOG_KV("verifySuccess", verifySuccess);
+    _callResult->setExecResult(codec.encode(verifySuccess, accounts));
+}
+
+void CryptoPrecompiled::ecrecoverBatch(
+    const std::shared_ptr<executor::TransactionExecutive>& _executive, bytesConstRef _paramData,
+    PrecompiledExecResult::Ptr _callResult, PrecompiledGas::Ptr const& _gasPricer)
+{
+    const auto& blockContext = _executive->blockContext();
+    auto codec = CodecWrapper(blockContext.hashHandler(), blockContext.isWasm());
+    std::vector<string32> hashes;
+    std::vector<bytes> signatures;
+    codec.decode(_paramData, hashes, signatures);
+    checkBatchSize("CryptoPrecompiled", hashes.size());
+    if (signatures.size() != hashes.size())
+    {
+        BOOST_THROW_EXCEPTION(bcos::protocol::PrecompiledError(
+            "CryptoPrecompiled ecrecoverBatch params size mismatch"));
+    }
+
+    std::vector<Address> accounts(hashes.size());
+    forEachBatchItem(hashes.size(), [&](size_t _index) {
+        auto const& signature = signatures[_index];
+        if (signature.size() != ECRECOVER_SIGNATURE_SIZE)
+        {
+            return;
+        }
+        // the input of the ecrecover precompiled: hash(32) v(32) r(32) s(32)
+        std::array<uint8_t, 128> input{};
+        auto hash = fromString32(hashes[_index]);
+        std::copy(hash.begin(), hash.end(), input.begin());
+        auto v = signature[ECRECOVER_SIGNATURE_SIZE - 1];
+        input[63] = v < 27 ? v + 27 : v;
+        std::copy(signature.begin(), signature.begin() + 64, input.begin() + 64);
+        auto [success, output] = crypto::ecRecover(bytesConstRef(input.data(), input.size()));
+        if (success && output.size() == crypto::HashType::SIZE)
+        {
+            accounts[_index] = right160(crypto::HashType(output));
+        }
+    });
+    _gasPricer->appendOperation(InterfaceOpcode::SignatureVerify, hashes.size());
+    bool verifySuccess = std::none_of(accounts.begin(), accounts.end(),
+        [](const Address& _account) { return _account == Address(); });
+    PRECOMPILED_LOG(TRACE) << LOG_DESC("CryptoPrecompiled: ecrecoverBatch")
+                           << LOG_KV("size", hashes.size())
+                           << LOG_KV("verifySuccess", verifySuccess);
+    _callResult->setExecResult(codec.encode(verifySuccess, accounts));
+}
@@ -34,6 +34,13 @@ abstract contract Crypto
     function keccak256Hash(bytes memory data) public view returns(bytes32){}
     function sm2Verify(bytes32 message, bytes memory publicKey, bytes32 r, bytes32 s) public view returns(bool, address){}
     function curve25519VRFVerify(bytes memory message, bytes memory publicKey, bytes memory proof) public view returns(bool, uint256){}
+    // batch interfaces, enabled by feature_crypto_batch
+    function sm3Batch(bytes[] memory data) public view returns(bytes32[] memory){}
+    function keccak256HashBatch(bytes[] memory data) public view returns(bytes32[] memory){}
+    // the accounts of the failed signatures are zero, the bool is true if all succeed
+    function sm2VerifyBatch(bytes32[] memory messages, bytes[] memory publicKeys, bytes32[] memory r, bytes32[] memory s) public view returns(bool, address[] memory){}
+    // the signature is r(32) s(32) v(1)
+    function ecrecoverBatch(bytes32[] memory hashes, bytes[] memory signatures) public view returns(bool, address[] memory){}
 }
 #endif
 
@@ -52,6 +59,15 @@ private:
         bytesConstRef _paramData, PrecompiledExecResult::Ptr _callResult);
     void curve25519VRFVerify(const std::shared_ptr<executor::TransactionExecutive>& _executive,
         bytesConstRef _paramData, PrecompiledExecResult::Ptr _callResult);
+    void hashBatch(const std::shared_ptr<executor::TransactionExecutive>& _executive,
+        bytesConstRef _paramData, PrecompiledExecResult::Ptr _callResult,
+        PrecompiledGas::Ptr const& _gasPricer, bool _isSM3);
+    void sm2VerifyBatch(const std::shared_ptr<executor::TransactionExecutive>& _executive,
+        bytesConstRef _paramData, PrecompiledExecResult::Ptr _callResult,
+        PrecompiledGas::Ptr const& _gasPricer);
+    void ecrecoverBatch(const std::shared_ptr<executor::TransactionExecutive>& _executive,
+        bytesConstRef _paramData, PrecompiledExecResult::Ptr _callResult,
+        PrecompiledGas::Ptr const& _gasPricer);
 };
 }  // namespace precompiled
 }  // namespace bcos
@@ -54,7 +54,10 @@ enum InterfaceOpcode : int64_t
     Remove = 0x12,
     PaillierAdd = 0x13,
     GroupSigVerify = 0x14,
-    RingSigVerify = 0x15
+    RingSigVerify = 0x15,
+    Hash = 0x16,
+    HashWord = 0x17,
+    SignatureVerify = 0x18
 };
 
 struct GasMetrics
@@ -75,6 +78,10 @@ struct GasMetrics
     int64_t StoreGas = 10000;
     int64_t RemoveGas = 2500;
     int64_t VerifyGas = 20000;
+    // the batch crypto interfaces are priced per item, the same as the evm sha3 and ecrecover
+    int64_t HashGas = 30;
+    int64_t HashWordGas = 6;
+    int64_t SignatureVerifyGas = 3000;
 
     // opcode to gasCost mapping
     std::map<InterfaceOpcode, int64_t> OpCode2GasCost;
@@ -96,7 +103,9 @@ struct GasMetrics
             {InterfaceOpcode::Insert, StoreGas}, {InterfaceOpcode::Update, StoreGas},
             {InterfaceOpcode::Remove, RemoveGas}, {InterfaceOpcode::PaillierAdd, VerifyGas},
             {InterfaceOpcode::GroupSigVerify, VerifyGas},
-            {InterfaceOpcode::RingSigVerify, VerifyGas}};
+            {InterfaceOpcode::RingSigVerify, VerifyGas}, {InterfaceOpcode::Hash, HashGas},
+            {InterfaceOpcode::HashWord, HashWordGas},
+            {InterfaceOpcode::SignatureVerify, SignatureVerifyGas}};
     }
 };
 
@@ -26,6 +26,7 @@
 #include "bcos-executor/src/Common.h"
 #include "bcos-executor/src/executive/TransactionExecutive.h"
 #include "bcos-framework/executor/PrecompiledTypeDef.h"
+#include "bcos-framework/protocol/Exceptions.h"
 #include "bcos-framework/storage/Table.h"
 #include "bcos-tool/BfsFileFactory.h"
 #include <bcos-utilities/Common.h>
@@ -33,6 +34,8 @@
 #include <boost/archive/text_oarchive.hpp>
 #include <boost/serialization/string.hpp>
 #include <boost/serialization/vector.hpp>
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 
 namespace bcos::precompiled
 {
@@ -173,4 +176,39 @@ s256 externalTouchNewFile(const std::shared_ptr<executor::TransactionExecutive>&
     std::string_view _filePath, std::string_view _fileType, int64_t gasLeft);
 
 
+// the items of a batch call, bounded to keep a call short
+constexpr static size_t BATCH_MAX_SIZE = 1024;
+// the items processed by a tbb task
+constexpr static size_t BATCH_GRAIN_SIZE = 4;
+
+inline void checkBatchSize(std::string_view _precompiledName, size_t _size)
+{
+    if (_size > BATCH_MAX_SIZE)
+    {
+        BOOST_THROW_EXCEPTION(protocol::PrecompiledError(std::string(_precompiledName) +
+                                                         " batch size exceeds " +
+                                                         std::to_string(BATCH_MAX_SIZE)));
+    }
+}
+
+// the items of a batch are independent, processed by the tbb threads if the batch is large enough
+void forEachBatchItem(size_t _size, auto&& _function)
+{
+    if (_size < BATCH_GRAIN_SIZE * 2)
+    {
+        for (size_t i = 0; i < _size; ++i)
+        {
+            _function(i);
+        }
+        return;
+    }
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, _size, BATCH_GRAIN_SIZE),
+        [&](const tbb::blocked_range<size_t>& _range) {
+            for (auto i = _range.begin(); i < _range.end(); ++i)
+            {
+                _function(i);
+            }
+        });
+}
+
 }  // namespace bcos::precompiled
\ No newline at end of file
@@ -33,14 +33,46 @@ contract GroupSig
 {
     function groupSigVerify(string signature, string message, string gpkInfo, string paramInfo)
 public constant returns(int, bool);
+    function groupSigVerifyBatch(string[] signatures, string[] messages, string gpkInfo, string
+paramInfo) public constant returns(int, bool);
 }
 */
 
 const char* const GROUP_SIG_METHOD_SET_STR = "groupSigVerify(string,string,string,string)";
+// the signatures of the same group, enabled by feature_crypto_batch
+const char* const GROUP_SIG_METHOD_VERIFY_BATCH_STR =
+    "groupSigVerifyBatch(string[],string[],string,string)";
 
 GroupSigPrecompiled::GroupSigPrecompiled(crypto::Hash::Ptr _hashImpl) : Precompiled(_hashImpl)
 {
     name2Selector[GROUP_SIG_METHOD_SET_STR] = getFuncSelector(GROUP_SIG_METHOD_SET_STR, _hashImpl);
+    name2Selector[GROUP_SIG_METHOD_VERIFY_BATCH_STR] =
+        getFuncSelector(GROUP_SIG_METHOD_VERIFY_BATCH_STR, _hashImpl);
+}
+
+bool GroupSigPrecompiled::groupSigVerifyBatch(const std::vector<std::string>& _signatures,
+    const std::vector<std::string>& _messages, const std::string& _gpkInfo,
+    const std::string& _paramInfo)
+{
+    std::vector<uint8_t> results(_signatures.size(), 0);
+    forEachBatchItem(_signatures.size(), [&](size_t _index) {
+        try
+        {
+            results[_index] = static_cast<uint8_t>(GroupSigApi::group_verify(
+                _signatures[_index], _messages[_index], _gpkInfo, _paramInfo));
+        }
+        catch (std::exception& error)
+        {
+            PRECOMPILED_LOG(INFO) << LOG_BADGE("GroupSigPrecompiled") << LOG_DESC(error.what())
+                                  << LOG_KV("index", _index);
+        }
+        catch (std::string& error)
+        {
+            PRECOMPILED_LOG(INFO) << LOG_BADGE("GroupSigPrecompiled") << LOG_DESC(error)
+                                  << LOG_KV("index", _index);
+        }
+    });
+    return std::all_of(results.begin(), results.end(), [](uint8_t _result) { return _result; });
 }
 
 std::shared_ptr<PrecompiledExecResult> GroupSigPrecompiled::call(
@@ -87,6 +119,27 @@ std::shared_ptr<PrecompiledExecResult> GroupSigPrecompiled::call(
         }
         _callParameters->setExecResult(codec->encode(retCode, result));
     }
+    else if (func == name2Selector[GROUP_SIG_METHOD_VERIFY_BATCH_STR] &&
+             blockContext.features().get(ledger::Features::Flag::feature_crypto_batch))
+    {
+        // groupSigVerifyBatch(string[],string[],string,string)
+        std::vector<std::string> signatures;
+        std::vector<std::string> messages;
+        std::string gpkInfo;
+        std::string paramInfo;
+        codec->decode(data, signatures, messages, gpkInfo, paramInfo);
+        checkBatchSize("GroupSigPrecompiled", signatures.size());
+        if (signatures.size() != messages.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                bcos::protocol::PrecompiledError("GroupSigPrecompiled params size mismatch"));
+        }
+        auto result =
+            !signatures.empty() && groupSigVerifyBatch(signatures, messages, gpkInfo, paramInfo);
+        gasPricer->appendOperation(InterfaceOpcode::GroupSigVerify, signatures.size());
+        int32_t retCode = result ? CODE_SUCCESS : VERIFY_GROUP_SIG_FAILED;
+        _callParameters->setExecResult(codec->encode(retCode, result));
+    }
     else
     {
         PRECOMPILED_LOG(INFO) << LOG_BADGE("GroupSigPrecompiled")
@@ -37,11 +37,15 @@ using namespace bcos::precompiled;
 contract Paillier
 {
     function paillierAdd(string cipher1, string cipher2) public constant returns(string);
+    function paillierAdd(bytes cipher1, bytes cipher2) public constant returns(bytes);
+    function paillierAddBatch(bytes[] ciphers) public constant returns(bytes);
 }
 #endif
 
 const char* const PAILLIER_METHOD_SET_STR = "paillierAdd(string,string)";
 const char* const PAILLIER_METHOD_ADD_RAW_STR = "paillierAdd(bytes,bytes)";
+// sum of the ciphers of the same public key, enabled by feature_crypto_batch
+const char* const PAILLIER_METHOD_ADD_BATCH_STR = "paillierAddBatch(bytes[])";
 
 PaillierPrecompiled::PaillierPrecompiled(const crypto::Hash::Ptr& _hashImpl)
   : Precompiled(_hashImpl), m_callPaillier(std::make_shared<CallPaillier>())
@@ -49,6 +53,34 @@ PaillierPrecompiled::PaillierPrecompiled(const crypto::Hash::Ptr& _hashImpl)
     name2Selector[PAILLIER_METHOD_SET_STR] = getFuncSelector(PAILLIER_METHOD_SET_STR, _hashImpl);
     name2Selector[PAILLIER_METHOD_ADD_RAW_STR] =
         getFuncSelector(PAILLIER_METHOD_ADD_RAW_STR, _hashImpl);
+    name2Selector[PAILLIER_METHOD_ADD_BATCH_STR] =
+        getFuncSelector(PAILLIER_METHOD_ADD_BATCH_STR, _hashImpl);
+}
+
+bytes PaillierPrecompiled::paillierAddBatch(const std::vector<bytes>& _ciphers) const
+{
+    auto sum = [this](const bytes* _begin, const bytes* _end) {
+        bytes result = *_begin;
+        for (const auto* it = _begin + 1; it != _end; ++it)
+        {
+            result = m_callPaillier->paillierAdd(result, *it);
+        }
+        return result;
+    };
+    if (_ciphers.size() < BATCH_GRAIN_SIZE * 2)
+    {
+        return sum(_ciphers.data(), _ciphers.data() + _ciphers.size());
+    }
+    // the homomorphic addition is associative, the chunks are summed in parallel and then in
+    // order, so the result is the same as the serial one
+    auto chunkSize = BATCH_GRAIN_SIZE * 4;
+    std::vector<bytes> partialSums((_ciphers.size() + chunkSize - 1) / chunkSize);
+    forEachBatchItem(partialSums.size(), [&](size_t _index) {
+        const auto* begin = _ciphers.data() + _index * chunkSize;
+        const auto* end = _ciphers.data() + std::min(_ciphers.size(), (_index + 1) * chunkSize);
+        partialSums[_index] = sum(begin, end);
+    });
+    return sum(partialSums.data(), partialSums.data() + partialSums.size());
 }
 
 PrecompiledExecResult::Ptr PaillierPrecompiled::call(
@@ -107,6 +139,33 @@ PrecompiledExecResult::Ptr PaillierPrecompiled::call(
             getErrorCodeOut(_callParameters->mutableExecResult(), CODE_INVALID_CIPHERS, codec);
         }
     }
+    else if (func == name2Selector[PAILLIER_METHOD_ADD_BATCH_STR] &&
+             blockContext.features().get(ledger::Features::Flag::feature_crypto_batch))
+    {  // paillierAddBatch(bytes[])
+        std::vector<bytes> ciphers;
+        codec.decode(data, ciphers);
+        checkBatchSize("PaillierPrecompiled", ciphers.size());
+        try
+        {
+            if (ciphers.empty())
+            {
+                getErrorCodeOut(_callParameters->mutableExecResult(), CODE_INVALID_CIPHERS, codec);
+            }
+            else
+            {
+                auto result = paillierAddBatch(ciphers);
+                gasPricer->appendOperation(InterfaceOpcode::PaillierAdd, ciphers.size() - 1);
+                _callParameters->setExecResult(codec.encode(result));
+            }
+        }
+        catch (CallException& e)
+        {
+            PRECOMPILED_LOG(INFO) << LOG_BADGE("PaillierPrecompiled")
+                                  << LOG_DESC(std::string(e.what()))
+                                  << LOG_KV("size", ciphers.size());
+            getErrorCodeOut(_callParameters->mutableExecResult(), CODE_INVALID_CIPHERS, codec);
+        }
+    }
     else
     {
         PRECOMPILED_LOG(ERROR) << LOG_BADGE("PaillierPrecompiled")
@@ -43,6 +43,10 @@ public:
      bool isParallelPrecompiled() override { return true; }
 
      std::vector<std::string> getParallelTag(bytesConstRef, bool) override { return {}; }
+
+    // the sum of the not empty ciphers, throw CallException if any cipher is invalid
+    bytes paillierAddBatch(const std::vector<bytes>& _ciphers) const;
+
 private:
     std::shared_ptr<CallPaillier> m_callPaillier;
 };
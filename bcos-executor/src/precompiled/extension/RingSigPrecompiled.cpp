@@ -33,14 +33,44 @@ contract RingSig
 {
     function ringSigVerify(string signature, string message, string paramInfo) public constant
 returns(int, bool);
+    function ringSigVerifyBatch(string[] signatures, string[] messages, string paramInfo) public
+constant returns(int, bool);
 }
 */
 
 const char* const RING_SIG_METHOD_SET_STR = "ringSigVerify(string,string,string)";
+// the signatures of the same ring, enabled by feature_crypto_batch
+const char* const RING_SIG_METHOD_VERIFY_BATCH_STR = "ringSigVerifyBatch(string[],string[],string)";
 
 RingSigPrecompiled::RingSigPrecompiled(crypto::Hash::Ptr _hashImpl) : Precompiled(_hashImpl)
 {
     name2Selector[RING_SIG_METHOD_SET_STR] = getFuncSelector(RING_SIG_METHOD_SET_STR, _hashImpl);
+    name2Selector[RING_SIG_METHOD_VERIFY_BATCH_STR] =
+        getFuncSelector(RING_SIG_METHOD_VERIFY_BATCH_STR, _hashImpl);
+}
+
+bool RingSigPrecompiled::ringSigVerifyBatch(const std::vector<std::string>& _signatures,
+    const std::vector<std::string>& _messages, const std::string& _paramInfo)
+{
+    std::vector<uint8_t> results(_signatures.size(), 0);
+    forEachBatchItem(_signatures.size(), [&](size_t _index) {
+        try
+        {
+            results[_index] = static_cast<uint8_t>(RingSigApi::LinkableRingSig::ring_verify(
+                _signatures[_index], _messages[_index], _paramInfo));
+        }
+        catch (std::exception& error)
+        {
+            PRECOMPILED_LOG(INFO) << LOG_BADGE("RingSigPrecompiled") << LOG_DESC(error.what())
+                                  << LOG_KV("index", _index);
+        }
+        catch (std::string& error)
+        {
+            PRECOMPILED_LOG(INFO) << LOG_BADGE("RingSigPrecompiled") << LOG_DESC(error)
+                                  << LOG_KV("index", _index);
+        }
+    });
+    return std::all_of(results.begin(), results.end(), [](uint8_t _result) { return _result; });
 }
 
 std::shared_ptr<PrecompiledExecResult> RingSigPrecompiled::call(
@@ -87,6 +117,25 @@ std::shared_ptr<PrecompiledExecResult> RingSigPrecompiled::call(
         }
         _callParameters->setExecResult(codec->encode(retCode, result));
     }
+    else if (func == name2Selector[RING_SIG_METHOD_VERIFY_BATCH_STR] &&
+             blockContext.features().get(ledger::Features::Flag::feature_crypto_batch))
+    {
+        // ringSigVerifyBatch(string[],string[],string)
+        std::vector<std::string> signatures;
+        std::vector<std::string> messages;
+        std::string paramInfo;
+        codec->decode(data, signatures, messages, paramInfo);
+        checkBatchSize("RingSigPrecompiled", signatures.size());
+        if (signatures.size() != messages.size())
+        {
+            BOOST_THROW_EXCEPTION(
+                bcos::protocol::PrecompiledError("RingSigPrecompiled params size mismatch"));
+        }
+        auto result = !signatures.empty() && ringSigVerifyBatch(signatures, messages, paramInfo);
+        gasPricer->appendOperation(InterfaceOpcode::GroupSigVerify, signatures.size());
+        int32_t retCode = result ? CODE_SUCCESS : VERIFY_RING_SIG_FAILED;
+        _callParameters->setExecResult(codec->encode(retCode, result));
+    }
     else
     {
         PRECOMPILED_LOG(INFO) << LOG_BADGE("RingSigPrecompiled")
@@ -36,6 +36,10 @@ public:
     std::shared_ptr<PrecompiledExecResult> call(
         std::shared_ptr<executor::TransactionExecutive> _executive,
         PrecompiledExecResult::Ptr _callParameters) override;
+
+    // true if all the signatures of the ring are valid, the invalid inputs are not valid
+    static bool ringSigVerifyBatch(const std::vector<std::string>& _signatures,
+        const std::vector<std::string>& _messages, const std::string& _paramInfo);
 };
 }  // namespace precompiled
 }  // namespace bcos
\ No newline at end of file
@@ -0,0 +1,237 @@
+/*
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the code analysis cache shared by the executors
+ * @file CodeAnalysisCache.cpp
+ */
+
+#include "CodeAnalysisCache.h"
+#include <boost/endian/conversion.hpp>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace bcos;
+using namespace bcos::executor;
+
+namespace
+{
+constexpr std::string_view c_fileMagic = "BCOSCODE1";
+// the code larger than the limit of EIP-170 is not from a valid contract
+constexpr uint32_t c_maxCodeSize = 0x10000;
+}  // namespace
+
+CodeAnalysisCache::CodeAnalysisCache(size_t capacity)
+  : m_shardCapacity((capacity + SHARD_COUNT - 1) / SHARD_COUNT)
+{}
+
+CodeAnalysisCache& CodeAnalysisCache::global()
+{
+    static CodeAnalysisCache cache;
+    return cache;
+}
+
+std::shared_ptr<CodeAnalysisCache::Analysis> CodeAnalysisCache::get(
+    const crypto::HashType& codeHash, evmc_revision revision)
+{
+    auto& shard = shardOf(codeHash);
+    std::unique_lock lock(shard.mutex);
+    auto it = shard.index.find(codeHash);
+    if (it == shard.index.end() || it->second->revision != revision)
+    {
+        return nullptr;
+    }
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    return it->second->analysis;
+}
+
+void CodeAnalysisCache::put(
+    const crypto::HashType& codeHash, evmc_revision revision, std::shared_ptr<Analysis> analysis)
+{
+    auto& shard = shardOf(codeHash);
+    std::unique_lock lock(shard.mutex);
+    if (auto it = shard.index.find(codeHash); it != shard.index.end())
+    {
+        // analysed by another thread at the same time, or with another revision
+        it->second->revision = revision;
+        it->second->analysis = std::move(analysis);
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        return;
+    }
+    shard.entries.emplace_front(
+        Entry{.codeHash = codeHash, .revision = revision, .analysis = std::move(analysis)});
+    shard.index.emplace(codeHash, shard.entries.begin());
+    evict(shard);
+}
+
+std::shared_ptr<CodeAnalysisCache::Analysis> CodeAnalysisCache::getOrAnalyze(
+    const crypto::HashType& codeHash, evmc_revision revision, bytes_view code)
+{
+    if (auto analysis = get(codeHash, revision))
+    {
+        return analysis;
+    }
+    // analyse without the lock, the shard is not blocked by a large code
+    auto analysis = std::make_shared<Analysis>(evmone::baseline::analyze(revision, code));
+    put(codeHash, revision, analysis);
+    return analysis;
+}
+
+void CodeAnalysisCache::reserve(size_t capacity)
+{
+    auto shardCapacity = (capacity + SHARD_COUNT - 1) / SHARD_COUNT;
+    auto current = m_shardCapacity.load();
+    while (current < shardCapacity &&
+           !m_shardCapacity.compare_exchange_weak(current, shardCapacity))
+    {
+    }
+}
+
+size_t CodeAnalysisCache::capacity() const
+{
+    return m_shardCapacity.load() * SHARD_COUNT;
+}
+
+size_t CodeAnalysisCache::size() const
+{
+    size_t count = 0;
+    for (auto const& shard : m_shards)
+    {
+        std::unique_lock lock(shard.mutex);
+        count += shard.entries.size();
+    }
+    return count;
+}
+
+void CodeAnalysisCache::evict(Shard& shard) const
+{
+    auto shardCapacity = m_shardCapacity.load();
+    while (shard.entries.size() > shardCapacity)
+    {
+        shard.index.erase(shard.entries.back().codeHash);
+        shard.entries.pop_back();
+    }
+}
+
+size_t CodeAnalysisCache::save(const std::string& path) const
+{
+    auto tmpPath = path + ".tmp";
+    std::ofstream output(tmpPath, std::ios::binary | std::ios::trunc);
+    if (!output)
+    {
+        EXECUTOR_LOG(WARNING) << LOG_BADGE("CodeAnalysisCache") << LOG_DESC("open file failed")
+                              << LOG_KV("path", tmpPath);
+        return 0;
+    }
+    output.write(c_fileMagic.data(), static_cast<std::streamsize>(c_fileMagic.size()));
+
+    size_t count = 0;
+    for (auto const& shard : m_shards)
+    {
+        std::unique_lock lock(shard.mutex);
+        for (auto const& entry : shard.entries)
+        {
+            auto code = entry.analysis->executable_code;
+            auto revision = boost::endian::native_to_little(static_cast<int32_t>(entry.revision));
+            auto codeSize = boost::endian::native_to_little(static_cast<uint32_t>(code.size()));
+            output.write(reinterpret_cast<const char*>(entry.codeHash.data()),
+                static_cast<std::streamsize>(entry.codeHash.size()));
+            output.write(reinterpret_cast<const char*>(&revision), sizeof(revision));
+            output.write(reinterpret_cast<const char*>(&codeSize), sizeof(codeSize));
+            output.write(reinterpret_cast<const char*>(code.data()),
+                static_cast<std::streamsize>(code.size()));
+            ++count;
+        }
+    }
+    output.close();
+    if (!output)
+    {
+        EXECUTOR_LOG(WARNING) << LOG_BADGE("CodeAnalysisCache") << LOG_DESC("write file failed")
+                              << LOG_KV("path", tmpPath);
+        return 0;
+    }
+    std::error_code errorCode;
+    std::filesystem::rename(tmpPath, path, errorCode);
+    if (errorCode)
+    {
+        EXECUTOR_LOG(WARNING) << LOG_BADGE("CodeAnalysisCache") << LOG_DESC("rename file failed")
+                              << LOG_KV("path", path) << LOG_KV("message", errorCode.message());
+        return 0;
+    }
+    EXECUTOR_LOG(INFO) << LOG_BADGE("CodeAnalysisCache") << LOG_DESC("saved")
+                       << LOG_KV("path", path) << LOG_KV("count", count);
+    return count;
+}
+
+size_t CodeAnalysisCache::load(const std::string& path, const crypto::Hash& hashImpl)
+{
+    std::ifstream input(path, std::ios::binary);
+    if (!input)
+    {
+        return 0;
+    }
+    std::string magic(c_fileMagic.size(), '\0');
+    if (!input.read(magic.data(), static_cast<std::streamsize>(magic.size())) ||
+        magic != c_fileMagic)
+    {
+        EXECUTOR_LOG(WARNING) << LOG_BADGE("CodeAnalysisCache") << LOG_DESC("invalid file")
+                              << LOG_KV("path", path);
+        return 0;
+    }
+
+    size_t count = 0;
+    size_t mismatch = 0;
+    bytes code;
+    while (count < capacity())
+    {
+        crypto::HashType codeHash;
+        int32_t revision = 0;
+        uint32_t codeSize = 0;
+        if (!input.read(reinterpret_cast<char*>(codeHash.data()),
+                static_cast<std::streamsize>(codeHash.size())) ||
+            !input.read(reinterpret_cast<char*>(&revision), sizeof(revision)) ||
+            !input.read(reinterpret_cast<char*>(&codeSize), sizeof(codeSize)))
+        {
+            break;
+        }
+        revision = boost::endian::little_to_native(revision);
+        codeSize = boost::endian::little_to_native(codeSize);
+        if (codeSize > c_maxCodeSize || revision < 0 || revision > EVMC_MAX_REVISION)
+        {
+            ++mismatch;
+            break;
+        }
+        code.resize(codeSize);
+        if (!input.read(reinterpret_cast<char*>(code.data()), codeSize))
+        {
+            break;
+        }
+        // the file is not trusted, the analysis is used by the code hash
+        if (hashImpl.hash(code) != codeHash)
+        {
+            ++mismatch;
+            continue;
+        }
+        auto evmcRevision = static_cast<evmc_revision>(revision);
+        put(codeHash, evmcRevision,
+            std::make_shared<Analysis>(
+                evmone::baseline::analyze(evmcRevision, bytes_view(code.data(), code.size()))));
+        ++count;
+    }
+    EXECUTOR_LOG(INFO) << LOG_BADGE("CodeAnalysisCache") << LOG_DESC("loaded")
+                       << LOG_KV("path", path) << LOG_KV("count", count)
+                       << LOG_KV("mismatch", mismatch);
+    return count;
+}
@@ -0,0 +1,100 @@
+/*
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the code analysis cache shared by the executors
+ * @file CodeAnalysisCache.h
+ */
+
+#pragma once
+#include "../Common.h"
+#include "bcos-crypto/interfaces/crypto/CommonType.h"
+#include "bcos-crypto/interfaces/crypto/Hash.h"
+#include <evmc/evmc.h>
+#include <evmone/baseline.hpp>
+#include <array>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace bcos::executor
+{
+/**
+ * @brief The evmone analyses keyed by the code hash, shared by all the executors of the process,
+ * so the same code deployed at many addresses is analysed once. The cache is split into shards by
+ * the code hash, each shard is a LRU with its own lock, so the executor threads seldom contend.
+ */
+class CodeAnalysisCache
+{
+public:
+    using Analysis = evmone::baseline::CodeAnalysis;
+    constexpr static size_t SHARD_COUNT = 16;
+    constexpr static size_t DEFAULT_CAPACITY = 1024;
+
+    explicit CodeAnalysisCache(size_t capacity = DEFAULT_CAPACITY);
+    ~CodeAnalysisCache() = default;
+    CodeAnalysisCache(const CodeAnalysisCache&) = delete;
+    CodeAnalysisCache& operator=(const CodeAnalysisCache&) = delete;
+
+    static CodeAnalysisCache& global();
+
+    // nullptr if not found or analysed with another revision
+    std::shared_ptr<Analysis> get(const crypto::HashType& codeHash, evmc_revision revision);
+    void put(const crypto::HashType& codeHash, evmc_revision revision,
+        std::shared_ptr<Analysis> analysis);
+    // The code must match the code hash
+    std::shared_ptr<Analysis> getOrAnalyze(
+        const crypto::HashType& codeHash, evmc_revision revision, bytes_view code);
+
+    // Raise the capacity, the analyses of the process are bounded by the largest one required
+    void reserve(size_t capacity);
+    size_t capacity() const;
+    size_t size() const;
+
+    // Only the code is saved, and analysed again when loaded, so the file doesn't depend on the
+    // layout of the analysis. Return the count of the analyses saved or loaded.
+    size_t save(const std::string& path) const;
+    size_t load(const std::string& path, const crypto::Hash& hashImpl);
+
+private:
+    struct Entry
+    {
+        crypto::HashType codeHash;
+        evmc_revision revision;
+        std::shared_ptr<Analysis> analysis;
+    };
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        // the most recently used at front
+        std::list<Entry> entries;
+        std::unordered_map<crypto::HashType, std::list<Entry>::iterator,
+            std::hash<crypto::HashType>>
+            index;
+    };
+
+    Shard& shardOf(const crypto::HashType& codeHash)
+    {
+        return m_shards[codeHash[0] % SHARD_COUNT];
+    }
+    // the entries beyond the capacity of the shard are evicted, must hold the lock of the shard
+    void evict(Shard& shard) const;
+
+    std::array<Shard, SHARD_COUNT> m_shards;
+    std::atomic_size_t m_shardCapacity;
+};
+}  // namespace bcos::executor
@@ -0,0 +1,103 @@
+/*
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the reusable evmone execution states of a thread
+ * @file ExecutionStatePool.h
+ */
+
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace bcos::executor
+{
+/**
+ * @brief The evmone execution states (the 1024 items stack, the memory and the return data) of
+ * a thread, reused by the calls instead of allocated for every frame. A nested call takes another
+ * state, so the pool keeps at most one state per call depth. The state whose memory grew beyond
+ * MAX_RETAINED_MEMORY is freed, so a rare large call doesn't pin its memory. The executive may be
+ * resumed on another thread during a call, the state released there is freed, as the pool is only
+ * used by its thread.
+ */
+template <class State>
+class ExecutionStatePool
+{
+public:
+    constexpr static size_t MAX_STATES = 16;
+    constexpr static size_t MAX_RETAINED_MEMORY = 1024 * 1024;
+
+    // Return the state to the pool when destroyed
+    class Lease
+    {
+    public:
+        Lease(ExecutionStatePool& pool, std::unique_ptr<State> state)
+          : m_pool(pool), m_state(std::move(state))
+        {}
+        ~Lease() noexcept { m_pool.release(std::move(m_state)); }
+        Lease(const Lease&) = delete;
+        Lease(Lease&&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        Lease& operator=(Lease&&) = delete;
+
+        State& operator*() const { return *m_state; }
+        State* operator->() const { return m_state.get(); }
+
+    private:
+        ExecutionStatePool& m_pool;
+        std::unique_ptr<State> m_state;
+    };
+
+    // The pool of the current thread, the evm executes a call on one thread
+    static ExecutionStatePool& local()
+    {
+        static thread_local ExecutionStatePool pool;
+        return pool;
+    }
+
+    ExecutionStatePool() { m_states.reserve(MAX_STATES); }
+
+    // The state must be reset by the caller before executing
+    Lease acquire()
+    {
+        if (m_states.empty())
+        {
+            return {*this, std::make_unique<State>()};
+        }
+        auto state = std::move(m_states.back());
+        m_states.pop_back();
+        return {*this, std::move(state)};
+    }
+
+    size_t size() const { return m_states.size(); }
+
+private:
+    void release(std::unique_ptr<State> state) noexcept
+    {
+        // m_states is only read on the owner thread, another thread may be modifying it
+        if (!state || std::this_thread::get_id() != m_owner ||
+            state->memory.size() > MAX_RETAINED_MEMORY || m_states.size() >= MAX_STATES)
+        {
+            return;
+        }
+        // reserved, doesn't allocate
+        m_states.emplace_back(std::move(state));
+    }
+
+    std::vector<std::unique_ptr<State>> m_states;
+    std::thread::id m_owner = std::this_thread::get_id();
+};
+}  // namespace bcos::executor
@@ -57,17 +57,7 @@ VMInstance VMFactory::create(VMKind kind, evmc_revision revision, const crypto::
         {
             return VMInstance{evmc_create_evmone(), revision, code};
         }
-        std::shared_ptr<evmoneCodeAnalysis> analysis{get(codeHash, revision)};
-        if (!analysis)
-        {
-            // analysis =
-            //     std::make_shared<evmoneCodeAnalysis>(evmone::advanced::analyze(revision, code));
-
-            analysis = std::make_shared<evmoneCodeAnalysis>(
-                evmone::baseline::analyze(revision, code));  // baseline
-            put(codeHash, analysis, revision);
-        }
-        return VMInstance{analysis, revision, code};
+        return VMInstance{m_cache->getOrAnalyze(codeHash, revision, code), revision, code};
     }
     }
 }
@@ -75,32 +65,13 @@ VMInstance VMFactory::create(VMKind kind, evmc_revision revision, const crypto::
 std::shared_ptr<evmoneCodeAnalysis> VMFactory::get(
     const crypto::HashType& key, evmc_revision revision) noexcept
 {
-    if (revision == m_revision)
-    {
-        m_cacheMutex.lock();
-        auto analysis = m_cache.get(key);
-        m_cacheMutex.unlock();
-        if (analysis)
-        {
-            return analysis.value();
-        }
-    }
-    return nullptr;
+    return m_cache->get(key, revision);
 }
 
 void VMFactory::put(const crypto::HashType& key,
     const std::shared_ptr<evmoneCodeAnalysis>& analysis, evmc_revision revision) noexcept
 {
-    if (revision != m_revision)
-    {
-        std::unique_lock lock(m_cacheMutex);
-        m_cache.clear();
-    }
-    m_revision = revision;
-    {
-        std::unique_lock lock(m_cacheMutex);
-        m_cache.insert(key, analysis);
-    }
+    m_cache->put(key, revision, analysis);
 }
 
 }  // namespace bcos::executor
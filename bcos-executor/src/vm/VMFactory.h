@@ -21,11 +21,11 @@
 
 #pragma once
 #include "../Common.h"
+#include "CodeAnalysisCache.h"
 #include "VMInstance.h"
 #include "bcos-crypto/interfaces/crypto/CommonType.h"
 #include <evmc/loader.h>
 #include <evmone/evmone.h>
-#include <boost/compute/detail/lru_cache.hpp>
 #include <memory>
 #include <shared_mutex>
 #include <string>
@@ -46,7 +46,12 @@ enum class VMKind
 class VMFactory
 {
 public:
-    VMFactory(size_t cache_size = c_EVMONE_CACHE_SIZE) : m_cache(cache_size) {}
+    // The analyses are cached in the process wide cache, shared with the other executors
+    VMFactory(size_t cache_size = c_EVMONE_CACHE_SIZE)
+      : m_cache(std::addressof(CodeAnalysisCache::global()))
+    {
+        m_cache->reserve(cache_size);
+    }
 
     /// Creates a VM instance of the kind provided.
     VMInstance create(VMKind _kind, evmc_revision revision, const crypto::HashType& codeHash,
@@ -60,9 +65,6 @@ public:
         evmc_revision revision) noexcept;
 
 private:
-    boost::compute::detail::lru_cache<crypto::HashType, std::shared_ptr<evmoneCodeAnalysis>>
-        m_cache;
-    evmc_revision m_revision = EVMC_PARIS;
-    std::mutex m_cacheMutex;
+    CodeAnalysisCache* m_cache;
 };
 }  // namespace bcos::executor
@@ -20,6 +20,7 @@
  */
 
 #include "VMInstance.h"
+#include "ExecutionStatePool.h"
 #include "HostContext.h"
 #include "evmone/advanced_execution.hpp"
 #include "evmone/execution_state.hpp"
@@ -59,15 +60,14 @@ Result VMInstance::execute(HostContext& _hostContext, evmc_message* _msg)
         return Result(m_instance->execute(m_instance, _hostContext.interface, &_hostContext,
             m_revision, _msg, m_code.data(), m_code.size()));
     }
-    auto state = std::unique_ptr<evmone::ExecutionState>(new evmone::ExecutionState(
-        *_msg, m_revision, *_hostContext.interface, &_hostContext, m_code, {}));
+    // the states are reused by the calls of the thread, a nested call takes another one
+    auto state = ExecutionStatePool<evmone::ExecutionState>::local().acquire();
+    state->reset(*_msg, m_revision, *_hostContext.interface, &_hostContext, m_code, {});
     {                                             // baseline
         static auto* evm = evmc_create_evmone();  // baseline use the vm to get options
         return Result(evmone::baseline::execute(
             *static_cast<evmone::VM*>(evm), _msg->gas, *state, *m_analysis));
     }
-    // advanced, TODO: state also could be reused
-    // return Result(evmone::advanced::execute(*state, *m_analysis));
 }
 
 evmc_revision toRevision(VMSchedule const& _schedule)
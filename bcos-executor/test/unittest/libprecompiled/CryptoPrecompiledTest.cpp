@@ -355,6 +355,78 @@ BOOST_AUTO_TEST_CASE(testSM2Verify)
     BOOST_CHECK(accountAddress.hex() == Address().hex());
 }
 
+BOOST_AUTO_TEST_CASE(testBatch)
+{
+    SM2VerifyPrecompiledFixture fixture;
+    auto call = [&](bytes const& in) {
+        auto parameters = std::make_shared<PrecompiledExecResult>();
+        parameters->m_input = bytesConstRef(in.data(), in.size());
+        parameters->m_gasLeft = 10000000;
+        auto execResult = fixture.m_cryptoPrecompiled->call(fixture.m_executive, parameters);
+        return execResult->execResult();
+    };
+
+    // disabled without the feature
+    std::vector<bytes> inputs{bytes{'a', 'b', 'c'}, bytes{}, bytes(100, 'x')};
+    auto hashIn = fixture.m_abi->abiIn("keccak256HashBatch(bytes[])", inputs);
+    BOOST_CHECK_THROW(call(hashIn), bcos::protocol::PrecompiledError);
+
+    ledger::Features features;
+    features.set(ledger::Features::Flag::feature_crypto_batch);
+    fixture.m_blockContext->setFeatures(features);
+
+    // hash
+    auto out = call(hashIn);
+    std::vector<string32> hashes;
+    fixture.m_abi->abiOut(bytesConstRef(&out), hashes);
+    BOOST_REQUIRE_EQUAL(hashes.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        BOOST_CHECK_EQUAL(fromString32(hashes[i]), keccak256Hash(ref(inputs[i])));
+    }
+
+    // sm2 verify, the second signature mismatches
+    h256 fixedSec("bcec428d5205abe0f0cc8a734083908d9eb8563e31f943d760786edf42ad67dd");
+    auto sm2KeyPair = std::make_shared<SM2KeyPair>(std::make_shared<KeyImpl>(fixedSec.asBytes()));
+    HashType hash("82ec580fe6d36ae4f81cae3c73f4a5b3b5a09c943172dc9053c69fd8e18dca1e");
+    HashType mismatchHash("c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470");
+    auto sm2Signature = SignatureDataWithPub(ref(*sm2Sign(*sm2KeyPair, hash, true)));
+    auto sm2In = fixture.m_abi->abiIn("sm2VerifyBatch(bytes32[],bytes[],bytes32[],bytes32[])",
+        std::vector<string32>{toString32(hash), toString32(mismatchHash)},
+        std::vector<bytes>{*sm2Signature.pub(), *sm2Signature.pub()},
+        std::vector<string32>{toString32(sm2Signature.r()), toString32(sm2Signature.r())},
+        std::vector<string32>{toString32(sm2Signature.s()), toString32(sm2Signature.s())});
+    out = call(sm2In);
+    bool verifySuccess = true;
+    std::vector<Address> accounts;
+    fixture.m_abi->abiOut(bytesConstRef(&out), verifySuccess, accounts);
+    BOOST_CHECK(!verifySuccess);
+    BOOST_REQUIRE_EQUAL(accounts.size(), 2);
+    BOOST_CHECK_EQUAL(accounts[0].hex(), sm2KeyPair->address(smHashImpl).hex());
+    BOOST_CHECK_EQUAL(accounts[1].hex(), Address().hex());
+
+    // ecrecover
+    auto keyPair = fixture.m_cryptoSuite->signatureImpl()->generateKeyPair();
+    std::vector<string32> messages;
+    std::vector<bytes> signatures;
+    for (int i = 0; i < 20; ++i)
+    {
+        auto message = keccak256Hash(bytesConstRef((const byte*)&i, sizeof(i)));
+        messages.emplace_back(toString32(message));
+        signatures.emplace_back(*fixture.m_cryptoSuite->signatureImpl()->sign(*keyPair, message));
+    }
+    auto ecrecoverIn =
+        fixture.m_abi->abiIn("ecrecoverBatch(bytes32[],bytes[])", messages, signatures);
+    out = call(ecrecoverIn);
+    fixture.m_abi->abiOut(bytesConstRef(&out), verifySuccess, accounts);
+    BOOST_CHECK(verifySuccess);
+    BOOST_REQUIRE_EQUAL(accounts.size(), messages.size());
+    for (auto const& account : accounts)
+    {
+        BOOST_CHECK_EQUAL(account.hex(), keyPair->address(fixture.m_cryptoSuite->hashImpl()).hex());
+    }
+}
+
 BOOST_AUTO_TEST_CASE(testEVMPrecompiled)
 {
     deployTest();
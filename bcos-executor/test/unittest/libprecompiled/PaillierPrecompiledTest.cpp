@@ -0,0 +1,157 @@
+/**
+ *  Copyright (C) 2023 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+#include "bcos-executor/src/precompiled/extension/PaillierPrecompiled.h"
+#include "../mock/MockLedger.h"
+#include "bcos-codec/abi/ContractABICodec.h"
+#include "bcos-executor/src/executive/BlockContext.h"
+#include "bcos-executor/src/executive/TransactionExecutive.h"
+#include "bcos-executor/src/precompiled/common/Common.h"
+#include "bcos-executor/src/precompiled/common/Utilities.h"
+#include "vm/gas_meter/GasInjector.h"
+#include <bcos-crypto/hash/Keccak256.h>
+#include <bcos-framework/executor/PrecompiledTypeDef.h>
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <paillier/callpaillier.h>
+
+using namespace bcos;
+using namespace bcos::precompiled;
+using namespace bcos::executor;
+using namespace bcos::storage;
+
+namespace bcos::test
+{
+struct PaillierPrecompiledFixture
+{
+    PaillierPrecompiledFixture()
+    {
+        m_hashImpl = std::make_shared<bcos::crypto::Keccak256>();
+        m_paillierPrecompiled = std::make_shared<PaillierPrecompiled>(m_hashImpl);
+        m_ledgerCache = std::make_shared<LedgerCache>(std::make_shared<MockLedger>());
+        m_blockContext = std::make_shared<BlockContext>(
+            nullptr, m_ledgerCache, m_hashImpl, 0, h256(), utcTime(), 0, false, false);
+        m_executive =
+            std::make_shared<TransactionExecutive>(*m_blockContext, "", 100, 0, m_gasInjector);
+    }
+
+    // the ciphers of 1, 2, ..., _size under the same public key
+    std::vector<bytes> ciphers(size_t _size)
+    {
+        std::vector<bytes> result;
+        result.reserve(_size);
+        auto cipher = fromHex(c_cipher);
+        for (size_t i = 0; i < _size; ++i)
+        {
+            result.emplace_back(
+                result.empty() ? cipher : m_callPaillier.paillierAdd(result.back(), cipher));
+        }
+        return result;
+    }
+
+    bytes serialAdd(const std::vector<bytes>& _ciphers)
+    {
+        bytes result = _ciphers[0];
+        for (size_t i = 1; i < _ciphers.size(); ++i)
+        {
+            result = m_callPaillier.paillierAdd(result, _ciphers[i]);
+        }
+        return result;
+    }
+
+    // the cipher of 1 with a 1024 bits key: the key length, the public key n and the cipher
+    constexpr static std::string_view c_cipher =
+        "0080B0B3A7075E8A537737C42EE716A7FBB321ABD198C5246015242B240F5C76871AB1A4BB6818EA8D4C307D"
+        "62EB96323DA29F530E33E8CC1509705703919E5EFCBB2C4B6FAB2C414C9A9C2C05415CB30737B3D5AF346EDF"
+        "708E0133F4D38D5D21AC4AB80E953B246E6419A83F811100FE9A832FC8FEF5186DFCE249A853560FAC99388E"
+        "9C6795710413482D80D9244897ABC4AF46C4384679FDF3D9BF2FE0E147C98F79FC2194768C63D587C46D1985"
+        "7E1E38120D3F3B95439E25848D745C8A6818ABE86C174339A04B863A76A41523F07B432E96C98A4C92198044"
+        "E17F5A05D88C95A7B7500BAB61CE951D1545D3F5E8D7C3FEADC74CFD9C44DE26ACC7BCA9725399EC20DB1A71"
+        "1DABB1F7D576350BDE459E9EFC1143DC567F204C5111B179334EC3454D36DD9ED344DFC634CFA421A087F1F7"
+        "600C2F522CC2A6AC313A78D2BCC456E43E82C57E28BC4737F3316B390C2FAF6F3346CACF35230CDB099017A1"
+        "2DC39A26EF04FA9535B0723B0F8CE443E6DB6EC72677B97C653AFA0E4390EF499480";
+
+    LedgerCache::Ptr m_ledgerCache;
+    bcos::crypto::Hash::Ptr m_hashImpl;
+    BlockContext::Ptr m_blockContext;
+    TransactionExecutive::Ptr m_executive;
+    wasm::GasInjector m_gasInjector;
+    PaillierPrecompiled::Ptr m_paillierPrecompiled;
+    CallPaillier m_callPaillier;
+};
+
+BOOST_FIXTURE_TEST_SUITE(test_PaillierPrecompiled, PaillierPrecompiledFixture)
+
+BOOST_AUTO_TEST_CASE(TestPaillierAddBatch)
+{
+    // below and above the size summed in parallel chunks
+    for (auto size : {size_t(1), BATCH_GRAIN_SIZE * 2 - 1, BATCH_GRAIN_SIZE * 2,
+             BATCH_GRAIN_SIZE * 4 * 3 + 1})
+    {
+        auto inputs = ciphers(size);
+        BOOST_CHECK(m_paillierPrecompiled->paillierAddBatch(inputs) == serialAdd(inputs));
+    }
+
+    auto inputs = ciphers(BATCH_GRAIN_SIZE * 4);
+    inputs.front().pop_back();
+    BOOST_CHECK_THROW(m_paillierPrecompiled->paillierAddBatch(inputs), CallException);
+}
+
+BOOST_AUTO_TEST_CASE(TestPaillierAddBatchCall)
+{
+    bcos::codec::abi::ContractABICodec abi(*m_hashImpl);
+    auto inputs = ciphers(BATCH_GRAIN_SIZE * 4 + 1);
+    bytes in = abi.abiIn("paillierAddBatch(bytes[])", inputs);
+    auto parameters = std::make_shared<PrecompiledExecResult>();
+    parameters->m_input = bytesConstRef(in.data(), in.size());
+
+    // disabled without the feature
+    auto execResult = m_paillierPrecompiled->call(m_executive, parameters);
+    bytes out = execResult->execResult();
+    int retCode;
+    bool result;
+    abi.abiOut(bytesConstRef(&out), retCode, result);
+    BOOST_TEST(false == result);
+    BOOST_TEST(retCode == CODE_UNKNOW_FUNCTION_CALL);
+
+    ledger::Features features;
+    features.set(ledger::Features::Flag::feature_crypto_batch);
+    m_blockContext->setFeatures(features);
+    execResult = m_paillierPrecompiled->call(m_executive, parameters);
+    out = execResult->execResult();
+    bytes sum;
+    abi.abiOut(bytesConstRef(&out), sum);
+    BOOST_CHECK(sum == serialAdd(inputs));
+
+    // empty or invalid ciphers
+    std::vector<bytes> emptyInputs;
+    in = abi.abiIn("paillierAddBatch(bytes[])", emptyInputs);
+    parameters->m_input = bytesConstRef(in.data(), in.size());
+    execResult = m_paillierPrecompiled->call(m_executive, parameters);
+    out = execResult->execResult();
+    s256 code;
+    abi.abiOut(bytesConstRef(&out), code);
+    BOOST_CHECK(code == s256((int)CODE_INVALID_CIPHERS));
+
+    inputs.front().pop_back();
+    in = abi.abiIn("paillierAddBatch(bytes[])", inputs);
+    parameters->m_input = bytesConstRef(in.data(), in.size());
+    execResult = m_paillierPrecompiled->call(m_executive, parameters);
+    out = execResult->execResult();
+    abi.abiOut(bytesConstRef(&out), code);
+    BOOST_CHECK(code == s256((int)CODE_INVALID_CIPHERS));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
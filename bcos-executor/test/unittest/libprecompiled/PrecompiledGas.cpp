@@ -53,6 +53,9 @@ void checkBasicGasCost(GasMetrics::Ptr _metric)
     checkGasCost(_metric, InterfaceOpcode::PaillierAdd, 20000);
     checkGasCost(_metric, InterfaceOpcode::GroupSigVerify, 20000);
     checkGasCost(_metric, InterfaceOpcode::RingSigVerify, 20000);
+    checkGasCost(_metric, InterfaceOpcode::Hash, 30);
+    checkGasCost(_metric, InterfaceOpcode::HashWord, 6);
+    checkGasCost(_metric, InterfaceOpcode::SignatureVerify, 3000);
 }
 
 BOOST_AUTO_TEST_CASE(testPrecompiledGasFactory)
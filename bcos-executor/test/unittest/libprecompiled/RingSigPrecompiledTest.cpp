@@ -130,6 +130,35 @@ BOOST_AUTO_TEST_CASE(TestRingSigVerify)
     abi.abiOut(bytesConstRef(&out), retCode, result);
     BOOST_TEST(false == result);
     BOOST_TEST(retCode == VERIFY_RING_SIG_FAILED);
+
+    // batch, enabled by feature
+    ledger::Features features;
+    features.set(ledger::Features::Flag::feature_crypto_batch);
+    fixture.m_blockContext->setFeatures(features);
+    std::vector<std::string> signatures(10, signature);
+    std::vector<std::string> messages(10, message1);
+    in = abi.abiIn("ringSigVerifyBatch(string[],string[],string)", signatures, messages, paramInfo);
+    parameters->m_input = bytesConstRef(in.data(), in.size());
+    execResult = ringSigPrecompiled->call(fixture.m_executive, parameters);
+    out = execResult->execResult();
+    abi.abiOut(bytesConstRef(&out), retCode, result);
+    BOOST_TEST(true == result);
+    BOOST_TEST(0 == retCode);
+
+    messages.back() = message2;
+    in = abi.abiIn("ringSigVerifyBatch(string[],string[],string)", signatures, messages, paramInfo);
+    parameters->m_input = bytesConstRef(in.data(), in.size());
+    execResult = ringSigPrecompiled->call(fixture.m_executive, parameters);
+    out = execResult->execResult();
+    abi.abiOut(bytesConstRef(&out), retCode, result);
+    BOOST_TEST(false == result);
+    BOOST_TEST(retCode == VERIFY_RING_SIG_FAILED);
+
+    messages.pop_back();
+    in = abi.abiIn("ringSigVerifyBatch(string[],string[],string)", signatures, messages, paramInfo);
+    parameters->m_input = bytesConstRef(in.data(), in.size());
+    BOOST_CHECK_THROW(ringSigPrecompiled->call(fixture.m_executive, parameters),
+        bcos::protocol::PrecompiledError);
 }
 
 BOOST_AUTO_TEST_CASE(ErrorFunc)
@@ -0,0 +1,104 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file CodeAnalysisCacheTest.cpp
+ */
+
+#include "vm/CodeAnalysisCache.h"
+#include <bcos-crypto/hash/Keccak256.h>
+#include <boost/test/unit_test.hpp>
+#include <filesystem>
+
+using namespace bcos::executor;
+
+namespace bcos::test
+{
+class CodeAnalysisCacheTestFixture
+{
+public:
+    bcos::bytes code(uint8_t seed) const
+    {
+        // PUSH1 seed, PUSH1 0, SSTORE, JUMPDEST, STOP
+        return bcos::bytes{0x60, seed, 0x60, 0x00, 0x55, 0x5b, 0x00};
+    }
+    crypto::HashType codeHash(bcos::bytes const& code) const { return hashImpl.hash(code); }
+    bytes_view view(bcos::bytes const& code) const { return {code.data(), code.size()}; }
+
+    crypto::Keccak256 hashImpl;
+};
+
+BOOST_FIXTURE_TEST_SUITE(testCodeAnalysisCache, CodeAnalysisCacheTestFixture)
+
+BOOST_AUTO_TEST_CASE(shareByCodeHash)
+{
+    CodeAnalysisCache cache;
+    auto code1 = code(1);
+    auto hash1 = codeHash(code1);
+    BOOST_CHECK(!cache.get(hash1, EVMC_PARIS));
+
+    auto analysis = cache.getOrAnalyze(hash1, EVMC_PARIS, view(code1));
+    BOOST_REQUIRE(analysis);
+    BOOST_CHECK(analysis->check_jumpdest(5));
+    BOOST_CHECK_EQUAL(cache.getOrAnalyze(hash1, EVMC_PARIS, view(code1)), analysis);
+    BOOST_CHECK_EQUAL(cache.get(hash1, EVMC_PARIS), analysis);
+    // Analysed again with another revision
+    BOOST_CHECK(!cache.get(hash1, EVMC_CANCUN));
+    BOOST_CHECK_EQUAL(cache.size(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(evictLeastRecentlyUsed)
+{
+    CodeAnalysisCache cache(CodeAnalysisCache::SHARD_COUNT);
+    BOOST_CHECK_EQUAL(cache.capacity(), CodeAnalysisCache::SHARD_COUNT);
+    for (int i = 0; i < 200; ++i)
+    {
+        auto bytecode = code(i);
+        cache.getOrAnalyze(codeHash(bytecode), EVMC_PARIS, view(bytecode));
+    }
+    BOOST_CHECK_LE(cache.size(), cache.capacity());
+    // The latest one is kept
+    BOOST_CHECK(cache.get(codeHash(code(199)), EVMC_PARIS));
+
+    cache.reserve(1024);
+    BOOST_CHECK_EQUAL(cache.capacity(), 1024);
+    cache.reserve(16);
+    BOOST_CHECK_EQUAL(cache.capacity(), 1024);
+}
+
+BOOST_AUTO_TEST_CASE(saveAndLoad)
+{
+    auto path = (std::filesystem::temp_directory_path() / "testCodeAnalysisCache.cache").string();
+    CodeAnalysisCache cache;
+    for (int i = 0; i < 10; ++i)
+    {
+        auto bytecode = code(i);
+        cache.getOrAnalyze(codeHash(bytecode), EVMC_PARIS, view(bytecode));
+    }
+    BOOST_CHECK_EQUAL(cache.save(path), 10);
+
+    CodeAnalysisCache loadedCache;
+    BOOST_CHECK_EQUAL(loadedCache.load(path, hashImpl), 10);
+    for (int i = 0; i < 10; ++i)
+    {
+        auto analysis = loadedCache.get(codeHash(code(i)), EVMC_PARIS);
+        BOOST_REQUIRE(analysis);
+        BOOST_CHECK(analysis->check_jumpdest(5));
+    }
+    BOOST_CHECK_EQUAL(loadedCache.load(path + ".notExists", hashImpl), 0);
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
@@ -0,0 +1,103 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file ExecutionStatePoolTest.cpp
+ */
+
+#include "vm/ExecutionStatePool.h"
+#include <evmone/execution_state.hpp>
+#include <boost/test/unit_test.hpp>
+#include <functional>
+#include <thread>
+#include <vector>
+
+using namespace bcos::executor;
+
+namespace bcos::test
+{
+struct MockState
+{
+    std::vector<uint8_t> memory;
+};
+
+BOOST_AUTO_TEST_SUITE(testExecutionStatePool)
+
+BOOST_AUTO_TEST_CASE(reuseState)
+{
+    ExecutionStatePool<MockState> pool;
+    MockState* first = nullptr;
+    {
+        auto state = pool.acquire();
+        first = std::addressof(*state);
+        BOOST_CHECK_EQUAL(pool.size(), 0);
+    }
+    BOOST_CHECK_EQUAL(pool.size(), 1);
+    {
+        auto state = pool.acquire();
+        BOOST_CHECK_EQUAL(std::addressof(*state), first);
+        // The nested call takes another state
+        auto nested = pool.acquire();
+        BOOST_CHECK_NE(std::addressof(*nested), first);
+    }
+    BOOST_CHECK_EQUAL(pool.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(boundedPool)
+{
+    ExecutionStatePool<MockState> pool;
+    // Nested calls deeper than the pool
+    std::function<void(size_t)> call = [&](size_t depth) {
+        auto state = pool.acquire();
+        if (depth < ExecutionStatePool<MockState>::MAX_STATES * 2)
+        {
+            call(depth + 1);
+        }
+    };
+    call(0);
+    BOOST_CHECK_EQUAL(pool.size(), ExecutionStatePool<MockState>::MAX_STATES);
+
+    // The state with the large memory is freed
+    ExecutionStatePool<MockState> pool2;
+    {
+        auto state = pool2.acquire();
+        state->memory.resize(ExecutionStatePool<MockState>::MAX_RETAINED_MEMORY + 1);
+    }
+    BOOST_CHECK_EQUAL(pool2.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(releaseOnAnotherThread)
+{
+    ExecutionStatePool<MockState> pool;
+    // The executive resumed on another thread, the state is freed instead of pooled
+    std::thread([&pool]() { auto state = pool.acquire(); }).join();
+    BOOST_CHECK_EQUAL(pool.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(evmoneState)
+{
+    auto& pool = ExecutionStatePool<evmone::ExecutionState>::local();
+    auto& samePool = ExecutionStatePool<evmone::ExecutionState>::local();
+    BOOST_CHECK_EQUAL(std::addressof(pool), std::addressof(samePool));
+    evmone::ExecutionState* first = nullptr;
+    {
+        auto state = pool.acquire();
+        first = std::addressof(*state);
+    }
+    auto state = pool.acquire();
+    BOOST_CHECK_EQUAL(std::addressof(*state), first);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
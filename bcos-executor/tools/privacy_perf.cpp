@@ -0,0 +1,188 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief perf for the batch interfaces of the privacy precompiled
+ * @file privacy_perf.cpp
+ */
+
+#include "precompiled/extension/GroupSigPrecompiled.h"
+#include "precompiled/extension/PaillierPrecompiled.h"
+#include "precompiled/extension/RingSigPrecompiled.h"
+#include <bcos-crypto/hash/Keccak256.h>
+#include <bcos-utilities/Common.h>
+#include <group_sig/algorithm/GroupSig.h>
+#include <group_sig/algorithm/RingSig.h>
+#include <json/json.h>
+#include <paillier/callpaillier.h>
+#include <fstream>
+#include <functional>
+#include <iostream>
+
+using namespace bcos;
+using namespace bcos::precompiled;
+
+const std::string PAILLIER_CMD = "paillier";
+const std::string RING_SIG_CMD = "ringsig";
+const std::string GROUP_SIG_CMD = "groupsig";
+
+void Usage(std::string const& _appName)
+{
+    std::cout << _appName << " [" << PAILLIER_CMD << "/" << RING_SIG_CMD << "/" << GROUP_SIG_CMD
+              << "] count inputFile" << std::endl;
+    std::cout << "inputFile: {\"paillier\": {\"cipher\": hex}, \"ringSig\": {\"signature\", "
+                 "\"message\", \"paramInfo\"}, \"groupSig\": {\"signature\", \"message\", "
+                 "\"gpkInfo\", \"paramInfo\"}}"
+              << std::endl;
+}
+
+double getTPS(int64_t _endT, int64_t _startT, size_t _count)
+{
+    return (1000.0 * (double)_count) / (double)(_endT - _startT);
+}
+
+void perf(std::string_view _name, size_t _count, std::function<void()> _serial,
+    std::function<void()> _batch)
+{
+    std::cout << std::endl;
+    std::cout << "----------- " << _name << " perf start -----------" << std::endl;
+    auto startT = utcTime();
+    _serial();
+    auto endT = utcTime();
+    std::cout << "serial, items: " << _count << ", timeCost: " << endT - startT << std::endl;
+    std::cout << "TPS of serial " << _name << ": " << getTPS(endT, startT, _count) << std::endl;
+
+    startT = utcTime();
+    _batch();
+    endT = utcTime();
+    std::cout << "batch, items: " << _count << ", timeCost: " << endT - startT << std::endl;
+    std::cout << "TPS of batch " << _name << ": " << getTPS(endT, startT, _count) << std::endl;
+    std::cout << "----------- " << _name << " perf end -----------" << std::endl;
+    std::cout << std::endl;
+}
+
+void paillierPerf(Json::Value const& _input, size_t _count)
+{
+    auto callPaillier = std::make_shared<CallPaillier>();
+    PaillierPrecompiled paillierPrecompiled(std::make_shared<crypto::Keccak256>());
+    std::vector<bytes> ciphers(_count, fromHex(_input["cipher"].asString()));
+
+    bytes serialResult;
+    bytes batchResult;
+    perf(
+        "paillierAdd", _count,
+        [&]() {
+            serialResult = ciphers[0];
+            for (size_t i = 1; i < ciphers.size(); ++i)
+            {
+                serialResult = callPaillier->paillierAdd(serialResult, ciphers[i]);
+            }
+        },
+        [&]() { batchResult = paillierPrecompiled.paillierAddBatch(ciphers); });
+    std::cout << "result matched: " << (serialResult == batchResult) << std::endl;
+}
+
+void ringSigPerf(Json::Value const& _input, size_t _count)
+{
+    std::vector<std::string> signatures(_count, _input["signature"].asString());
+    std::vector<std::string> messages(_count, _input["message"].asString());
+    auto paramInfo = _input["paramInfo"].asString();
+
+    bool result = true;
+    perf(
+        "ringSigVerify", _count,
+        [&]() {
+            for (size_t i = 0; i < _count; ++i)
+            {
+                result = RingSigApi::LinkableRingSig::ring_verify(
+                             signatures[i], messages[i], paramInfo) &&
+                         result;
+            }
+        },
+        [&]() {
+            result =
+                RingSigPrecompiled::ringSigVerifyBatch(signatures, messages, paramInfo) && result;
+        });
+    std::cout << "verify result: " << result << std::endl;
+}
+
+void groupSigPerf(Json::Value const& _input, size_t _count)
+{
+    std::vector<std::string> signatures(_count, _input["signature"].asString());
+    std::vector<std::string> messages(_count, _input["message"].asString());
+    auto gpkInfo = _input["gpkInfo"].asString();
+    auto paramInfo = _input["paramInfo"].asString();
+
+    bool result = true;
+    perf(
+        "groupSigVerify", _count,
+        [&]() {
+            for (size_t i = 0; i < _count; ++i)
+            {
+                result =
+                    GroupSigApi::group_verify(signatures[i], messages[i], gpkInfo, paramInfo) &&
+                    result;
+            }
+        },
+        [&]() {
+            result = GroupSigPrecompiled::groupSigVerifyBatch(
+                         signatures, messages, gpkInfo, paramInfo) &&
+                     result;
+        });
+    std::cout << "verify result: " << result << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc < 4)
+    {
+        Usage(argv[0]);
+        return -1;
+    }
+    auto cmd = argv[1];
+    size_t count = atoi(argv[2]);
+    if (count == 0)
+    {
+        Usage(argv[0]);
+        return -1;
+    }
+
+    std::ifstream inputFile(argv[3]);
+    Json::Value input;
+    Json::Reader reader;
+    if (!inputFile || !reader.parse(inputFile, input))
+    {
+        std::cout << "Invalid inputFile \"" << argv[3] << "\"" << std::endl;
+        return -1;
+    }
+
+    if (PAILLIER_CMD == cmd)
+    {
+        paillierPerf(input["paillier"], count);
+    }
+    else if (RING_SIG_CMD == cmd)
+    {
+        ringSigPerf(input["ringSig"], count);
+    }
+    else if (GROUP_SIG_CMD == cmd)
+    {
+        groupSigPerf(input["groupSig"], count);
+    }
+    else
+    {
+        std::cout << "Invalid subcommand \"" << cmd << "\"" << std::endl;
+        Usage(argv[0]);
+    }
+    return 0;
+}
@@ -43,6 +43,7 @@ enum GatewayMessageType : uint16_t
     RouterTableResponse = 0xb,
     RouterTableRequest = 0xc,
     ForwardMessage = 0xd,
+    CompressDictionaryIDs = 0xe,  // advertise the compress dictionaries after handshake
     All = 0xff
 };
 /**
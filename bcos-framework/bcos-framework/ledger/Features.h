@@ -61,6 +61,8 @@ public:
         feature_rpbft_term_weight,
         feature_raw_address,
         feature_rpbft_vrf_type_secp256k1,
+        feature_crypto_batch,
+        feature_dag_scheduler,
     };
 
 private:
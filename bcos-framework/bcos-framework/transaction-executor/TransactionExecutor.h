@@ -59,6 +59,30 @@ inline constexpr struct ExecuteStep
     }
 } executeStep{};
 
+inline constexpr struct ConflictKeys
+{
+    /**
+     * @brief The keys the transaction declares to conflict on, before it is executed. The
+     * transactions without a common key are independent and can be executed in any order.
+     *
+     * @param executor The executor instance.
+     * @param storage The storage instance.
+     * @param blockHeader The block header.
+     * @param transaction The transaction to analyse.
+     * @param args Additional arguments.
+     * @return A task that resolves to the keys, std::nullopt if the transaction doesn't declare
+     * them and may conflict with any transaction.
+     */
+    auto operator()(auto& executor, auto& storage, protocol::BlockHeader const& blockHeader,
+        protocol::Transaction const& transaction, auto&&... args) const
+        -> decltype(tag_invoke(*this, executor, storage, blockHeader, transaction,
+            std::forward<decltype(args)>(args)...))
+    {
+        return tag_invoke(*this, executor, storage, blockHeader, transaction,
+            std::forward<decltype(args)>(args)...);
+    }
+} conflictKeys{};
+
 template <auto& Tag>
 using tag_t = std::decay_t<decltype(Tag)>;
 
@@ -4,6 +4,7 @@
  */
 
 #include "bcos-gateway/Common.h"
+#include "bcos-gateway/libp2p/Common.h"
 #include "bcos-utilities/BoostLog.h"
 #include "bcos-utilities/Common.h"
 #include <bcos-framework/protocol/Protocol.h>
@@ -308,6 +309,13 @@ void GatewayConfig::initP2PConfig(const boost::property_tree::ptree& _pt, bool _
     m_enableRIPProtocol = _pt.get<bool>("p2p.enable_rip_protocol", true);
 
     m_enableCompress = _pt.get<bool>("p2p.enable_compression", true);
+    m_compressLevel = _pt.get<int>("p2p.compression_level", (int)c_zstdCompressLevel);
+    m_enableAdaptiveCompress = _pt.get<bool>("p2p.enable_adaptive_compression", false);
+    m_compressDictPath = _pt.get<std::string>("p2p.compression_dict_path", "");
+    m_compressSamplePath = _pt.get<std::string>("p2p.compression_sample_path", "");
+    constexpr static uint32_t defaultCompressMaxSamples = 1000;
+    m_compressMaxSamples =
+        _pt.get<uint32_t>("p2p.compression_max_samples", defaultCompressMaxSamples);
 
     constexpr static uint32_t defaultAllowMaxMsgSize = MAX_MESSAGE_LENGTH;
     m_allowMaxMsgSize = _pt.get<uint32_t>("p2p.allow_max_msg_size", defaultAllowMaxMsgSize);
@@ -345,6 +353,10 @@ void GatewayConfig::initP2PConfig(const boost::property_tree::ptree& _pt, bool _
                              << LOG_KV("p2p.listen_port", listenPort) << LOG_KV("p2p.sm_ssl", smSSL)
                              << LOG_KV("p2p.enable_rip_protocol", m_enableRIPProtocol)
                              << LOG_KV("p2p.enable_compression", m_enableCompress)
+                             << LOG_KV("p2p.compression_level", m_compressLevel)
+                             << LOG_KV("p2p.enable_adaptive_compression", m_enableAdaptiveCompress)
+                             << LOG_KV("p2p.compression_dict_path", m_compressDictPath)
+                             << LOG_KV("p2p.compression_sample_path", m_compressSamplePath)
                              << LOG_KV("p2p.allow_max_msg_size", m_allowMaxMsgSize)
                              << LOG_KV("p2p.session_recv_buffer_size", m_sessionRecvBufferSize)
                              << LOG_KV("p2p.session_max_read_data_size", m_maxReadDataSize)
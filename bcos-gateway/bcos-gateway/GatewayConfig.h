@@ -259,6 +259,19 @@ public:
     void setEnableCompress(bool _enableCompress) { m_enableCompress = _enableCompress; }
     bool enableCompress() const { return m_enableCompress; }
 
+    int compressLevel() const { return m_compressLevel; }
+    void setCompressLevel(int _compressLevel) { m_compressLevel = _compressLevel; }
+
+    bool enableAdaptiveCompress() const { return m_enableAdaptiveCompress; }
+    void setEnableAdaptiveCompress(bool _enableAdaptiveCompress)
+    {
+        m_enableAdaptiveCompress = _enableAdaptiveCompress;
+    }
+
+    std::string const& compressDictPath() const { return m_compressDictPath; }
+    std::string const& compressSamplePath() const { return m_compressSamplePath; }
+    uint32_t compressMaxSamples() const { return m_compressMaxSamples; }
+
     uint32_t allowMaxMsgSize() const { return m_allowMaxMsgSize; }
     void setAllowMaxMsgSize(uint32_t _allowMaxMsgSize) { m_allowMaxMsgSize = _allowMaxMsgSize; }
 
@@ -341,6 +354,15 @@ private:
     bool m_enableRIPProtocol{true};
     // enable compress
     bool m_enableCompress{true};
+    // zstd compress level
+    int m_compressLevel{1};
+    // skip the incompressible modules and lower the level when compress costs too much
+    bool m_enableAdaptiveCompress{false};
+    // the directory of the trained dictionaries named {moduleID}.dict
+    std::string m_compressDictPath;
+    // the directory to capture the payload samples for dictionary training, empty means disabled
+    std::string m_compressSamplePath;
+    uint32_t m_compressMaxSamples{1000};
     std::set<std::string> m_certWhitelist;
     // cert config for ssl connection
     CertConfig m_certConfig;
@@ -625,8 +625,14 @@ std::shared_ptr<Service> GatewayFactory::buildService(const GatewayConfig::Ptr&
     asioInterface->setClientContext(clientCtx);
     asioInterface->setType(ASIOInterface::ASIO_TYPE::SSL);
 
+    // Compress policy: trained dictionaries and adaptive compress level
+    auto compressPolicy = std::make_shared<CompressPolicy>(
+        _config->compressLevel(), _config->enableAdaptiveCompress());
+    compressPolicy->loadDictionaries(_config->compressDictPath());
+    compressPolicy->setSamplePath(_config->compressSamplePath(), _config->compressMaxSamples());
     // Message Factory
     auto messageFactory = std::make_shared<P2PMessageFactoryV2>();
+    messageFactory->setCompressPolicy(compressPolicy);
     // Session Factory
     auto sessionFactory = std::make_shared<SessionFactory>(pubHex, _config->sessionRecvBufferSize(),
         _config->allowMaxMsgSize(), _config->maxReadDataSize(), _config->maxSendDataSize(),
@@ -681,6 +687,7 @@ std::shared_ptr<Service> GatewayFactory::buildService(const GatewayConfig::Ptr&
                               << LOG_KV("myself pub id", pubHex);
     service->setMessageFactory(messageFactory);
     service->setKeyFactory(keyFactory);
+    service->setCompressPolicy(compressPolicy);
     return service;
 }
 
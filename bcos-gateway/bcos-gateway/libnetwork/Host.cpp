@@ -424,6 +424,50 @@ void Host::start()
             startAccept();
         }
         m_asioInterface->start();
+
+        m_requestTimeoutTimer = std::make_shared<bcos::Timer>(
+            *m_asioInterface->ioService(), REQUEST_TIMEOUT_TICK, "requestTimeout");
+        m_requestTimeoutTimer->registerTimeoutHandler([weakHost = weak_from_this()]() {
+            if (auto host = weakHost.lock())
+            {
+                host->expireRequests();
+            }
+        });
+        m_requestTimeoutTimer->start();
+    }
+}
+
+void Host::expireRequests()
+{
+    try
+    {
+        auto expired = m_requestTimeouts.advance(utcSteadyTime());
+        for (auto seq : expired)
+        {
+            if (!m_sessionCallbackManager)
+            {
+                break;
+            }
+            // the request has been responded
+            auto callback = m_sessionCallbackManager->getCallback(seq, true);
+            if (!callback || !callback->callback)
+            {
+                continue;
+            }
+            asyncTo([callback = std::move(callback)]() {
+                NetworkException e(P2PExceptionType::NetworkTimeout, "NetworkTimeout");
+                callback->callback(e, Message::Ptr());
+            });
+        }
+    }
+    catch (std::exception const& e)
+    {
+        HOST_LOG(WARNING) << LOG_DESC("expireRequests exception")
+                          << LOG_KV("message", boost::diagnostic_information(e));
+    }
+    if (m_run)
+    {
+        m_requestTimeoutTimer->restart();
     }
 }
 
@@ -577,6 +621,10 @@ void Host::stop()
     }
     // signal run() to prepare for shutdown and reset m_timer
     m_run = false;
+    if (m_requestTimeoutTimer)
+    {
+        m_requestTimeoutTimer->stop();
+    }
     if (m_asioInterface)
     {
         m_asioInterface->stop();
@@ -10,7 +10,9 @@
 #include <bcos-gateway/libnetwork/Message.h>  // for Message
 #include <bcos-gateway/libnetwork/PeerBlacklist.h>
 #include <bcos-gateway/libnetwork/PeerWhitelist.h>
+#include <bcos-gateway/libnetwork/TimingWheel.h>
 #include <bcos-utilities/Common.h>  // for Guard, Mutex
+#include <bcos-utilities/Timer.h>
 #include <oneapi/tbb/task_arena.h>
 #include <oneapi/tbb/task_group.h>
 #include <openssl/x509.h>
@@ -133,6 +135,12 @@ public:
     }
     virtual PeerBlackWhitelistInterface::Ptr peerWhitelist() { return m_peerWhitelist; }
 
+    // the request of the session times out after _timeout ms if no response received
+    virtual void addRequestTimeout(uint32_t _seq, uint32_t _timeout)
+    {
+        m_requestTimeouts.add(_seq, utcSteadyTime() + _timeout);
+    }
+
     template <class F>
     void asyncTo(F f)
     {
@@ -179,6 +187,9 @@ protected:
             callback,
         NodeIPEndpoint _nodeIPEndpoint, std::shared_ptr<boost::asio::deadline_timer> timerPtr);
 
+    // expire the timeout requests of all the sessions, called every tick of m_requestTimeouts
+    void expireRequests();
+
     void erasePendingConns(NodeIPEndpoint const& nodeIPEndpoint)
     {
         bcos::Guard lock(x_pendingConns);
@@ -202,6 +213,10 @@ protected:
     tbb::task_arena m_taskArena;
     tbb::task_group m_asyncGroup;
     std::shared_ptr<SessionCallbackManagerInterface> m_sessionCallbackManager;
+    // the timeouts of the requests, expired in bulk instead of one timer per request
+    constexpr static uint64_t REQUEST_TIMEOUT_TICK = 10;
+    TimingWheel m_requestTimeouts{REQUEST_TIMEOUT_TICK, utcSteadyTime()};
+    std::shared_ptr<bcos::Timer> m_requestTimeoutTimer;
 
     /// representing to the network state
     std::shared_ptr<ASIOInterface> m_asioInterface;
@@ -23,20 +23,41 @@
 #include <bcos-utilities/Common.h>
 #include <boost/asio/buffer.hpp>
 #include <any>
+#include <memory>
+#include <set>
 
 
 namespace bcos::gateway
 {
+// the priority classes of the session write queue, the smaller one is drained first
+enum class SendPriority : uint8_t
+{
+    Consensus = 0,  // the consensus and the gateway control messages
+    SyncStatus,     // the small block sync messages, e.g. the sync status
+    TxsGossip,      // the transaction sync messages
+    BlockData,      // the block sync messages carrying the blocks
+    AMOP,           // the amop messages and others
+    Count
+};
 
 struct EncodedMessage
 {
     bcos::bytes header;
-    bcos::bytes payload;
+    // the payload(compressed or not) is immutable after encoded, it is shared by the write queues
+    // of all the sessions that the message is sent to, so a broadcast message only be encoded once
+    std::shared_ptr<const bcos::bytes> payload;
     bool compress = true;
+    // the compress dictionaries that the peer can uncompress with, advertised after handshake
+    std::shared_ptr<const std::set<uint32_t>> compressDictIDs;
 
     inline std::size_t dataSize() const { return headerSize() + payloadSize(); }
     inline std::size_t headerSize() const { return header.size(); }
-    inline std::size_t payloadSize() const { return payload.size(); }
+    inline std::size_t payloadSize() const { return payload ? payload->size() : 0; }
+    inline bcos::bytesConstRef payloadRef() const
+    {
+        return payload ? bcos::bytesConstRef(payload->data(), payload->size()) :
+                         bcos::bytesConstRef();
+    }
 };
 
 class Message
@@ -59,6 +80,8 @@ public:
     virtual uint16_t packetType() const = 0;
     virtual uint16_t ext() const = 0;
     virtual bool isRespPacket() const = 0;
+    // the write queue class of the message, the control messages are sent first by default
+    virtual SendPriority sendPriority() const { return SendPriority::Consensus; }
 
     [[deprecated("Use encode(EncodedMessage& _buffer)")]] virtual bool encode(
         bcos::bytes& _buffer) = 0;
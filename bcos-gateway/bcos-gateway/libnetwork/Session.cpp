@@ -133,37 +133,18 @@ void Session::asyncSendMessage(Message::Ptr message, Options options, SessionCal
     {
         auto handler = std::make_shared<ResponseCallback>();
         handler->callback = callback;
+        handler->startTime = utcSteadyTime();
+        m_sessionCallbackManager->addCallback(message->seq(), handler);
         if (options.timeout > 0)
         {
-            handler->timeoutHandler.emplace(
-                m_server.get().asioInterface()->newTimer(options.timeout));
-            auto session = std::weak_ptr<Session>(shared_from_this());
-            auto seq = message->seq();
-            handler->timeoutHandler->async_wait(
-                [session, seq](const boost::system::error_code& _error) {
-                    try
-                    {
-                        auto s = session.lock();
-                        if (!s)
-                        {
-                            return;
-                        }
-                        s->onTimeout(_error, seq);
-                    }
-                    catch (std::exception const& e)
-                    {
-                        SESSION_LOG(WARNING) << LOG_DESC("async_wait exception")
-                                             << LOG_KV("message", boost::diagnostic_information(e));
-                    }
-                });
-            handler->startTime = utcSteadyTime();
+            m_server.get().addRequestTimeout(message->seq(), options.timeout);
         }
-
-        m_sessionCallbackManager->addCallback(message->seq(), handler);
     }
 
+    auto priority = message->sendPriority();
     EncodedMessage encodedMessage;
     encodedMessage.compress = m_enableCompress;
+    encodedMessage.compressDictIDs = compressDictIDs();
     message->encode(encodedMessage);
 
     if (c_fileLogLevel <= LogLevel::TRACE)
@@ -174,26 +155,26 @@ void Session::asyncSendMessage(Message::Ptr message, Options options, SessionCal
                            << LOG_KV("ext", message->ext());
     }
 
-    send(encodedMessage);
+    send(std::move(encodedMessage), priority);
 }
 
 std::size_t Session::writeQueueSize()
 {
-    return static_cast<std::size_t>(!m_writeQueue.empty());
+    return m_writeQueue.size();
 }
 
-void Session::send(EncodedMessage encodedMsg)
+void Session::send(EncodedMessage encodedMsg, SendPriority _priority)
 {
     if (!active() || !m_socket->isConnected())
     {
         return;
     }
 
-    m_writeQueue.push({.m_data = std::move(encodedMsg), .m_callback = {}});
+    m_writeQueue.push({.m_data = std::move(encodedMsg), .m_callback = {}}, _priority);
     write();
 }
 
-void send(Session& session, ::ranges::input_range auto&& payloads,
+void send(Session& session, SendPriority priority, ::ranges::input_range auto&& payloads,
     std::function<void(boost::system::error_code)> callback)
 {
     Payload payload{.m_data{Payload::MessageList{}}, .m_callback = std::move(callback)};
@@ -207,7 +188,7 @@ void send(Session& session, ::ranges::input_range auto&& payloads,
         vec.emplace_back(data.data(), data.size());
     }
 
-    session.m_writeQueue.push(std::move(payload));
+    session.m_writeQueue.push(std::move(payload), priority);
     session.write();
 }
 
@@ -241,20 +222,120 @@ void Session::onWrite(boost::system::error_code ec, std::size_t /*unused*/)
 }
 
 bool Session::tryPopSomeEncodedMsgs(
-    std::vector<Payload>& encodedMsgs, size_t _maxSendDataSize, size_t _maxSendMsgCount)  // NOLINT
+    std::vector<Payload>& encodedMsgs, size_t _maxSendDataSize)  // NOLINT
 {
-    // Desc: Try to send multi packets one time to improve the efficiency of sending
-    // data
-    size_t totalDataSize = 0;
+    // Desc: Try to send multi packets one time to improve the efficiency of sending data, the
+    // size limit keeps a large batch of low priority packets from delaying the consensus packets
+    return m_writeQueue.tryPopSome(encodedMsgs, _maxSendDataSize);
+}
+
+void SessionSendQueue::push(Payload _payload, SendPriority _priority)
+{
+    auto index = std::min(static_cast<size_t>(_priority), QUEUE_COUNT - 1);
+    m_size.fetch_add(1);
+    m_queues[index].push(std::move(_payload));
+}
+
+bool SessionSendQueue::empty() const
+{
+    return m_size.load() == 0;
+}
+
+bool SessionSendQueue::fetchHead(size_t _index)
+{
+    if (m_heads[_index])
+    {
+        return true;
+    }
     Payload payload;
-    // while (totalDataSize < _maxSendDataSize && m_writeQueue.try_pop(payload))
-    while (m_writeQueue.try_pop(payload))
+    if (!m_queues[_index].try_pop(payload))
     {
-        totalDataSize += payload.size();
-        encodedMsgs.emplace_back(std::move(payload));
+        // the idle queue can't save the deficit for later bursts
+        m_deficits[_index] = 0;
+        return false;
     }
+    m_heads[_index].emplace(std::move(payload));
+    return true;
+}
 
-    return totalDataSize > 0;
+bool SessionSendQueue::tryPopSome(std::vector<Payload>& _payloads, size_t _maxSendDataSize)
+{
+    size_t totalDataSize = 0;
+    size_t popped = 0;
+    bool pending = true;
+    while (pending && (popped == 0 || totalDataSize < _maxSendDataSize))
+    {
+        pending = false;
+        for (size_t index = 0; index < QUEUE_COUNT; ++index)
+        {
+            if (!fetchHead(index))
+            {
+                continue;
+            }
+            m_deficits[index] += QUANTUM * WEIGHTS[index];
+            while (m_heads[index] && (int64_t)m_heads[index]->size() <= m_deficits[index])
+            {
+                auto size = m_heads[index]->size();
+                m_deficits[index] -= (int64_t)size;
+                totalDataSize += size;
+                ++popped;
+                _payloads.emplace_back(std::move(*m_heads[index]));
+                m_heads[index].reset();
+                if (totalDataSize >= _maxSendDataSize)
+                {
+                    m_size.fetch_sub(popped);
+                    return true;
+                }
+                fetchHead(index);
+            }
+            // the head larger than the deficit waits for more rounds
+            pending = pending || m_heads[index].has_value();
+        }
+    }
+    m_size.fetch_sub(popped);
+    return popped > 0;
+}
+
+void Session::coalesceBuffers(
+    WriteBuffers const& _buffers, bcos::bytes& _writeBuffer, WriteBuffers& _output)
+{
+    size_t coalesceSize = 0;
+    for (auto const& buffer : _buffers)
+    {
+        if (buffer.size() < MAX_COALESCE_BUFFER_SIZE)
+        {
+            coalesceSize += buffer.size();
+        }
+    }
+    _writeBuffer.clear();
+    // reserve first, the output buffers point to _writeBuffer
+    _writeBuffer.reserve(coalesceSize);
+
+    bool lastCoalesced = false;
+    for (auto const& buffer : _buffers)
+    {
+        if (buffer.size() == 0)
+        {
+            continue;
+        }
+        if (buffer.size() >= MAX_COALESCE_BUFFER_SIZE)
+        {
+            _output.emplace_back(buffer);
+            lastCoalesced = false;
+            continue;
+        }
+        auto offset = _writeBuffer.size();
+        auto const* data = static_cast<const byte*>(buffer.data());
+        _writeBuffer.insert(_writeBuffer.end(), data, data + buffer.size());
+        if (lastCoalesced)
+        {
+            auto& last = _output.back();
+            last = boost::asio::const_buffer(last.data(), last.size() + buffer.size());
+            continue;
+        }
+        _output.emplace_back(_writeBuffer.data() + offset, buffer.size());
+        lastCoalesced = true;
+    }
 }
 
 void Session::write()
@@ -283,17 +364,19 @@ void Session::write()
         std::unique_ptr<std::atomic_bool, decltype([](std::atomic_bool* ptr) { *ptr = false; })>
             defer(std::addressof(m_writing));
 
-        if (!tryPopSomeEncodedMsgs(m_writingPayloads, m_maxSendDataSize, m_maxSendMsgCountS))
+        if (!tryPopSomeEncodedMsgs(m_writingPayloads, m_maxSendDataSize))
         {
             return;
         }
 
-        boost::container::small_vector<boost::asio::const_buffer, 16> buffers;
-        auto outputIt = std::back_inserter(buffers);
+        WriteBuffers payloadBuffers;
+        auto outputIt = std::back_inserter(payloadBuffers);
         for (auto& payload : m_writingPayloads)
         {
             payload.toConstBuffer(outputIt);
         }
+        WriteBuffers buffers;
+        coalesceBuffers(payloadBuffers, m_writeBuffer, buffers);
         defer.release();  // NOLINT
         m_server.get().asioInterface()->asyncWrite(m_socket, buffers,
             [self = std::weak_ptr<Session>(shared_from_this())](
@@ -651,11 +734,7 @@ void Session::onMessage(NetworkException const& e, Message::Ptr message)
                 return;
             }
 
-            // with callback
-            if (callbackPtr->timeoutHandler)
-            {
-                callbackPtr->timeoutHandler->cancel();
-            }
+            // with callback, the timeout of the request is ignored when it expires
             auto callback = callbackPtr->callback;
             if (!callback)
             {
@@ -671,25 +750,6 @@ void Session::onMessage(NetworkException const& e, Message::Ptr message)
     });
 }
 
-void Session::onTimeout(const boost::system::error_code& error, uint32_t seq)
-{
-    if (error)
-    {
-        // SESSION_LOG(TRACE) << "timer cancel" << error;
-        return;
-    }
-
-    ResponseCallback::Ptr callback = m_sessionCallbackManager->getCallback(seq, true);
-    if (!callback)
-    {
-        return;
-    }
-    m_server.get().asyncTo([callback = std::move(callback)]() {
-        NetworkException e(P2PExceptionType::NetworkTimeout, "NetworkTimeout");
-        callback->callback(e, Message::Ptr());
-    });
-}
-
 void Session::checkNetworkStatus()
 {
     m_idleCheckTimer->restart();
@@ -782,30 +842,13 @@ bcos::task::Task<Message::Ptr> bcos::gateway::Session::sendMessage(
                     handle.resume();
                 };
                 auto seq = m_message.get().seq();
+                handler->startTime = utcSteadyTime();
+                m_sessionCallbackManager.get().addCallback(seq, std::move(handler));
                 if (m_options.get().timeout > 0)
                 {
-                    handler->timeoutHandler.emplace(
-                        m_host.get().asioInterface()->newTimer(m_options.get().timeout));
-                    handler->timeoutHandler->async_wait(
-                        [self = m_self, seq](const boost::system::error_code& _error) {
-                            try
-                            {
-                                if (auto session = self.lock())
-                                {
-                                    session->onTimeout(_error, seq);
-                                }
-                            }
-                            catch (std::exception const& e)
-                            {
-                                SESSION_LOG(WARNING)
-                                    << LOG_DESC("async_wait exception")
-                                    << LOG_KV("message", boost::diagnostic_information(e));
-                            }
-                        });
-                    handler->startTime = utcSteadyTime();
+                    m_host.get().addRequestTimeout(seq, m_options.get().timeout);
                 }
-                m_sessionCallbackManager.get().addCallback(seq, std::move(handler));
-                ::send(*m_self.lock(), m_view.get(), {});
+                ::send(*m_self.lock(), m_message.get().sendPriority(), m_view.get(), {});
             }
             Message::Ptr await_resume()
             {
@@ -835,19 +878,21 @@ bcos::task::Task<Message::Ptr> bcos::gateway::Session::sendMessage(
         struct Awaitable
         {
             std::reference_wrapper<Session> m_self;
+            SendPriority m_priority;
             std::reference_wrapper<decltype(view)> m_view;
             NetworkException m_exception;
 
             constexpr static bool await_ready() noexcept { return false; }
             void await_suspend(std::coroutine_handle<> handle)
             {
-                ::send(m_self, m_view.get(), [this, handle](boost::system::error_code errorCode) {
-                    if (errorCode.failed())
-                    {
-                        m_exception = NetworkException(errorCode.value(), errorCode.message());
-                    }
-                    handle.resume();
-                });
+                ::send(m_self, m_priority, m_view.get(),
+                    [this, handle](boost::system::error_code errorCode) {
+                        if (errorCode.failed())
+                        {
+                            m_exception = NetworkException(errorCode.value(), errorCode.message());
+                        }
+                        handle.resume();
+                    });
             }
             void await_resume()
             {
@@ -857,7 +902,10 @@ bcos::task::Task<Message::Ptr> bcos::gateway::Session::sendMessage(
                 }
             }
         };
-        Awaitable awaitable{.m_self = *this, .m_view = view, .m_exception = {}};
+        Awaitable awaitable{.m_self = *this,
+            .m_priority = message.sendPriority(),
+            .m_view = view,
+            .m_exception = {}};
         co_await awaitable;
         co_return {};
     }
@@ -868,7 +916,7 @@ size_t bcos::gateway::Payload::size() const
     return std::visit(
         bcos::overloaded(
             [](const EncodedMessage& encodedMessage) -> size_t {
-                return encodedMessage.header.size() + encodedMessage.payload.size();
+                return encodedMessage.dataSize();
             },
             [](const boost::container::small_vector<bytesConstRef, 3>& refs) {
                 return ::ranges::accumulate(refs, size_t(0),
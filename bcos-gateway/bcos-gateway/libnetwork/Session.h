@@ -20,9 +20,11 @@
 #include <boost/asio/buffer.hpp>
 #include <boost/container/small_vector.hpp>
 #include <boost/heap/priority_queue.hpp>
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <range/v3/numeric/accumulate.hpp>
 #include <utility>
 #include <variant>
@@ -137,8 +139,9 @@ struct Payload
     {
         std::visit(bcos::overloaded(
                        [&](const EncodedMessage& encodedMessage) {
+                           auto payload = encodedMessage.payloadRef();
                            *output = {encodedMessage.header.data(), encodedMessage.header.size()};
-                           *output = {encodedMessage.payload.data(), encodedMessage.payload.size()};
+                           *output = {payload.data(), payload.size()};
                        },
                        [&](const MessageList& refs) {
                            for (const auto& ref : refs)
@@ -150,6 +153,40 @@ struct Payload
     }
 };
 
+/**
+ * @brief the write queue of the session, one queue for every SendPriority, drained by deficit
+ * round robin so the bulk block sync traffic can't starve the consensus messages, while the low
+ * priority queues still get their share of the bandwidth
+ *
+ * Note: push is thread safe, tryPopSome must be called by one writer at a time
+ */
+class SessionSendQueue
+{
+public:
+    constexpr static size_t QUEUE_COUNT = static_cast<size_t>(SendPriority::Count);
+    /// the bytes added to the deficit of a queue every round, multiplied by the queue weight
+    constexpr static int64_t QUANTUM = 16 * 1024;
+    /// the weights of the queues, index by SendPriority
+    constexpr static std::array<int64_t, QUEUE_COUNT> WEIGHTS = {16, 8, 4, 2, 1};
+
+    void push(Payload _payload, SendPriority _priority);
+    // pop the payloads until the total size reaches _maxSendDataSize, at least one payload is
+    // popped if any
+    bool tryPopSome(std::vector<Payload>& _payloads, size_t _maxSendDataSize);
+
+    bool empty() const;
+    size_t size() const { return m_size.load(); }
+
+private:
+    bool fetchHead(size_t _index);
+
+    std::array<tbb::concurrent_queue<Payload>, QUEUE_COUNT> m_queues;
+    std::atomic<size_t> m_size{0};
+    // the payload popped from the queue but not sent yet, only accessed by the writer
+    std::array<std::optional<Payload>, QUEUE_COUNT> m_heads;
+    std::array<int64_t, QUEUE_COUNT> m_deficits{};
+};
+
 class Session : public SessionFace,
                 public std::enable_shared_from_this<Session>,
                 public bcos::ObjectCounter<Session>
@@ -157,6 +194,15 @@ class Session : public SessionFace,
 public:
     constexpr static const std::size_t MIN_SESSION_RECV_BUFFER_SIZE =
         static_cast<std::size_t>(512 * 1024);
+    /// the ssl stream encrypts every buffer of the buffer sequence into separate tls records and
+    /// writes, so the buffers smaller than one tls record are copied into one contiguous buffer
+    constexpr static const std::size_t MAX_COALESCE_BUFFER_SIZE =
+        static_cast<std::size_t>(16 * 1024);
+
+    using WriteBuffers = boost::container::small_vector<boost::asio::const_buffer, 16>;
+    // coalesce the adjacent small buffers into _writeBuffer, the large ones are written directly
+    static void coalesceBuffers(
+        WriteBuffers const& _buffers, bcos::bytes& _writeBuffer, WriteBuffers& _output);
 
     Session(std::shared_ptr<SocketFace> socket, Host& server,
         size_t _recvBufferSize = MIN_SESSION_RECV_BUFFER_SIZE, bool _forceSize = false);
@@ -244,22 +290,32 @@ public:
     void setEnableCompress(bool _enableCompress) { m_enableCompress = _enableCompress; }
     bool enableCompress() const { return m_enableCompress; }
 
+    void setCompressDictIDs(std::shared_ptr<const std::set<uint32_t>> _dictIDs) override
+    {
+        Guard lock(x_info);
+        m_compressDictIDs = std::move(_dictIDs);
+    }
+    std::shared_ptr<const std::set<uint32_t>> compressDictIDs() const
+    {
+        Guard lock(x_info);
+        return m_compressDictIDs;
+    }
+
     SessionRecvBuffer& recvBuffer() { return m_recvBuffer; }
     const SessionRecvBuffer& recvBuffer() const { return m_recvBuffer; }
     /**
      * @brief The packets that can be sent are obtained based on the configured policy
      *
      * @param encodedMsgs
-     * @param _maxSendDataSize
-     * @param _maxSendMsgCount
+     * @param _maxSendDataSize the payloads popped one time are limited to this size, except that
+     * the first payload is always popped
      * @return bool
      */
-    bool tryPopSomeEncodedMsgs(
-        std::vector<Payload>& encodedMsgs, size_t _maxSendDataSize, size_t _maxSendMsgCount);
+    bool tryPopSomeEncodedMsgs(std::vector<Payload>& encodedMsgs, size_t _maxSendDataSize);
 
     virtual void checkNetworkStatus();
 
-    void send(EncodedMessage encodedMsg);
+    void send(EncodedMessage encodedMsg, SendPriority _priority = SendPriority::Consensus);
 
     void doRead();
 
@@ -272,11 +328,14 @@ public:
     // Maximum amount of data to be sent one time, default: 1M
     uint32_t m_maxSendDataSize = 1024 * 1024;
     // Maximum number of packets to be sent one time, default: 10
+    // Note: not used, the packets sent one time are limited by m_maxSendDataSize
     uint32_t m_maxSendMsgCountS = 10;
     //  Maximum size of message that is allowed to send or receive, default: 32M
     uint32_t m_allowMaxMsgSize = 32 * 1024 * 1024;
     //
     bool m_enableCompress = true;
+    // the compress dictionaries that the peer has
+    std::shared_ptr<const std::set<uint32_t>> m_compressDictIDs;
     // ------ for optimize send message parameters  end ---------------
 
     /// Drop the connection for the reason @a _reason.
@@ -285,8 +344,6 @@ public:
     /// Check error code after reading and drop peer if error code.
     bool checkRead(boost::system::error_code _ec);
 
-    void onTimeout(const boost::system::error_code& error, uint32_t seq);
-
     /// Perform a single round of the write operation. This could end up calling
     /// itself asynchronously.
     void onWrite(boost::system::error_code ec, std::size_t length);
@@ -300,7 +357,7 @@ public:
 
     MessageFactory::Ptr m_messageFactory;
 
-    tbb::concurrent_queue<Payload> m_writeQueue;
+    SessionSendQueue m_writeQueue;
     std::atomic_bool m_writing = false;
 
     mutable bcos::Mutex x_info;
@@ -322,6 +379,8 @@ public:
     std::string m_hostNodeID;
 
     std::vector<Payload> m_writingPayloads;
+    // the coalesced small buffers of m_writingPayloads
+    bcos::bytes m_writeBuffer;
 };
 
 class SessionFactory
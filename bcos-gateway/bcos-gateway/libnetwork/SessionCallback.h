@@ -8,8 +8,8 @@
 #pragma once
 #include "bcos-gateway/libnetwork/Common.h"
 #include <bcos-gateway/libnetwork/Message.h>
-#include <boost/asio/deadline_timer.hpp>
 #include <array>
+#include <functional>
 #include <mutex>
 #include <unordered_map>
 
@@ -24,7 +24,6 @@ struct ResponseCallback : public std::enable_shared_from_this<ResponseCallback>
 
     uint64_t startTime;
     SessionCallbackFunc callback;
-    std::optional<boost::asio::deadline_timer> timeoutHandler;
 };
 
 using SessionResponseCallback = ResponseCallback;
@@ -60,5 +60,8 @@ public:
     virtual bool active() const = 0;
 
     virtual std::size_t writeQueueSize() = 0;
+
+    // the compress dictionaries advertised by the peer
+    virtual void setCompressDictIDs(std::shared_ptr<const std::set<uint32_t>> _dictIDs) = 0;
 };
 }  // namespace bcos::gateway
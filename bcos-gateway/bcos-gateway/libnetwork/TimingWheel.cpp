@@ -0,0 +1,86 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file TimingWheel.cpp
+ */
+#include <bcos-gateway/libnetwork/TimingWheel.h>
+
+using namespace bcos;
+using namespace bcos::gateway;
+
+void TimingWheel::add(uint32_t _seq, uint64_t _expireMs)
+{
+    // round up, the request never expires earlier than its timeout
+    auto expireTick = (_expireMs + m_tickMs - 1) / m_tickMs;
+    m_size.fetch_add(1);
+    m_pending.push(Entry{.seq = _seq, .expireTick = expireTick});
+}
+
+std::vector<uint32_t> TimingWheel::advance(uint64_t _nowMs)
+{
+    std::vector<uint32_t> expired;
+    Entry entry;
+    while (m_pending.try_pop(entry))
+    {
+        insert(entry, expired);
+    }
+
+    auto nowTick = _nowMs / m_tickMs;
+    while (m_currentTick < nowTick)
+    {
+        ++m_currentTick;
+        if (m_currentTick % NEAR_SLOTS == 0)
+        {
+            cascade(expired);
+        }
+        auto& slot = m_nearSlots[m_currentTick % NEAR_SLOTS];
+        for (auto const& it : slot)
+        {
+            expired.emplace_back(it.seq);
+        }
+        slot.clear();
+    }
+    m_size.fetch_sub(expired.size());
+    return expired;
+}
+
+void TimingWheel::insert(Entry _entry, std::vector<uint32_t>& _expired)
+{
+    if (_entry.expireTick <= m_currentTick)
+    {
+        _expired.emplace_back(_entry.seq);
+        return;
+    }
+    if (_entry.expireTick - m_currentTick < NEAR_SLOTS)
+    {
+        m_nearSlots[_entry.expireTick % NEAR_SLOTS].emplace_back(_entry);
+        return;
+    }
+    // the far slot is cascaded to the near slots when the wheel reaches the beginning of it, the
+    // timeout beyond the far slots waits in the last one and is cascaded again
+    auto currentRound = m_currentTick / NEAR_SLOTS;
+    auto expireRound = std::min(_entry.expireTick / NEAR_SLOTS, currentRound + FAR_SLOTS - 1);
+    m_farSlots[expireRound % FAR_SLOTS].emplace_back(_entry);
+}
+
+void TimingWheel::cascade(std::vector<uint32_t>& _expired)
+{
+    std::vector<Entry> entries;
+    entries.swap(m_farSlots[(m_currentTick / NEAR_SLOTS) % FAR_SLOTS]);
+    for (auto const& entry : entries)
+    {
+        insert(entry, _expired);
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief two level hierarchical timing wheel to expire the session requests in bulk
+ * @file TimingWheel.h
+ */
+#pragma once
+
+#include <oneapi/tbb/concurrent_queue.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace bcos::gateway
+{
+/**
+ * @brief the timeouts of the request sequences, the senders add the timeouts without lock and
+ * one ticking thread advances the wheel and collects the expired sequences.
+ *
+ * Note: the sequences whose response arrived are not removed from the wheel, the owner ignores
+ * them when they expire
+ */
+class TimingWheel
+{
+public:
+    /// the first level covers 256 ticks
+    constexpr static uint64_t NEAR_SLOTS = 256;
+    /// the second level covers 64 * 256 ticks, the longer timeouts are cascaded repeatedly
+    constexpr static uint64_t FAR_SLOTS = 64;
+
+    TimingWheel(uint64_t _tickMs, uint64_t _nowMs)
+      : m_tickMs(_tickMs == 0 ? 1 : _tickMs), m_currentTick(_nowMs / m_tickMs)
+    {}
+    TimingWheel(const TimingWheel&) = delete;
+    TimingWheel(TimingWheel&&) = delete;
+    TimingWheel& operator=(const TimingWheel&) = delete;
+    TimingWheel& operator=(TimingWheel&&) = delete;
+    ~TimingWheel() = default;
+
+    uint64_t tickMs() const { return m_tickMs; }
+    // the number of the sequences not expired
+    size_t size() const { return m_size.load(); }
+
+    // thread safe
+    void add(uint32_t _seq, uint64_t _expireMs);
+    // advance the wheel to _nowMs and return the expired sequences, called by one thread at a time
+    std::vector<uint32_t> advance(uint64_t _nowMs);
+
+private:
+    struct Entry
+    {
+        uint32_t seq;
+        uint64_t expireTick;
+    };
+
+    void insert(Entry _entry, std::vector<uint32_t>& _expired);
+    void cascade(std::vector<uint32_t>& _expired);
+
+    uint64_t m_tickMs;
+    uint64_t m_currentTick;
+    std::atomic<size_t> m_size{0};
+    tbb::concurrent_queue<Entry> m_pending;
+    std::array<std::vector<Entry>, NEAR_SLOTS> m_nearSlots;
+    std::array<std::vector<Entry>, FAR_SLOTS> m_farSlots;
+};
+}  // namespace bcos::gateway
@@ -0,0 +1,233 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file CompressPolicy.cpp
+ */
+#include <bcos-gateway/libp2p/Common.h>
+#include <bcos-gateway/libp2p/CompressPolicy.h>
+#include <bcos-utilities/FileUtility.h>
+#include <boost/asio/detail/socket_ops.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <fstream>
+
+using namespace bcos;
+using namespace bcos::gateway;
+
+void CompressPolicy::loadDictionaries(std::string const& _dictPath)
+{
+    if (_dictPath.empty() || !boost::filesystem::is_directory(_dictPath))
+    {
+        P2PMSG_LOG(INFO) << LOG_DESC("loadDictionaries: no compress dictionary")
+                         << LOG_KV("path", _dictPath);
+        return;
+    }
+    for (auto const& entry : boost::filesystem::directory_iterator(_dictPath))
+    {
+        auto const& path = entry.path();
+        if (!boost::filesystem::is_regular_file(path) ||
+            path.extension().string() != DICTIONARY_SUFFIX)
+        {
+            continue;
+        }
+        try
+        {
+            auto moduleID = boost::lexical_cast<uint16_t>(path.stem().string());
+            auto content = readContents(path);
+            if (!content || content->empty())
+            {
+                continue;
+            }
+            auto dictionary = std::make_shared<ZstdDictionary>(std::move(*content));
+            addDictionary(moduleID, std::move(dictionary));
+        }
+        catch (std::exception const& e)
+        {
+            P2PMSG_LOG(WARNING) << LOG_DESC("loadDictionaries: ignore invalid dictionary")
+                                << LOG_KV("file", path.string())
+                                << LOG_KV("msg", boost::diagnostic_information(e));
+        }
+    }
+}
+
+bool CompressPolicy::addDictionary(uint16_t _moduleID, ZstdDictionary::Ptr _dictionary)
+{
+    // the dictionary without id can't be recognized by the peer
+    if (!_dictionary || _dictionary->id() == 0 || !_dictionary->decompressDict())
+    {
+        P2PMSG_LOG(WARNING) << LOG_DESC("addDictionary: invalid dictionary")
+                            << LOG_KV("moduleID", _moduleID);
+        return false;
+    }
+    P2PMSG_LOG(INFO) << LOG_DESC("addDictionary") << LOG_KV("moduleID", _moduleID)
+                     << LOG_KV("dictID", _dictionary->id())
+                     << LOG_KV("size", _dictionary->content().size());
+    std::unique_lock lock(x_dictionaries);
+    m_dictionaries[_dictionary->id()] = _dictionary;
+    m_moduleDictionaries[_moduleID] = std::move(_dictionary);
+    return true;
+}
+
+ZstdDictionary::Ptr CompressPolicy::dictionary(uint16_t _moduleID) const
+{
+    std::shared_lock lock(x_dictionaries);
+    auto it = m_moduleDictionaries.find(_moduleID);
+    if (it == m_moduleDictionaries.end())
+    {
+        return nullptr;
+    }
+    return it->second;
+}
+
+ZstdDictionary::Ptr CompressPolicy::dictionaryByID(uint32_t _dictID) const
+{
+    std::shared_lock lock(x_dictionaries);
+    auto it = m_dictionaries.find(_dictID);
+    if (it == m_dictionaries.end())
+    {
+        return nullptr;
+    }
+    return it->second;
+}
+
+std::vector<uint32_t> CompressPolicy::dictionaryIDs() const
+{
+    std::shared_lock lock(x_dictionaries);
+    std::vector<uint32_t> dictIDs;
+    dictIDs.reserve(m_dictionaries.size());
+    for (auto const& it : m_dictionaries)
+    {
+        dictIDs.emplace_back(it.first);
+    }
+    return dictIDs;
+}
+
+CompressStat& CompressPolicy::stat(uint16_t _moduleID)
+{
+    {
+        std::shared_lock lock(x_stats);
+        auto it = m_stats.find(_moduleID);
+        if (it != m_stats.end())
+        {
+            return *it->second;
+        }
+    }
+    std::unique_lock lock(x_stats);
+    auto [it, _] = m_stats.try_emplace(_moduleID, std::make_unique<CompressStat>());
+    return *it->second;
+}
+
+std::optional<int> CompressPolicy::compressLevel(uint16_t _moduleID)
+{
+    if (!m_adaptive)
+    {
+        return m_compressLevel;
+    }
+    auto& moduleStat = stat(_moduleID);
+    auto messages = moduleStat.messages.fetch_add(1);
+    // the payload of the module is almost incompressible, skip it except for the probe messages
+    if (moduleStat.ratio.load() > SKIP_RATIO && (messages % PROBE_INTERVAL) != 0)
+    {
+        return std::nullopt;
+    }
+    if (moduleStat.costPerKB.load() > MAX_COST_PER_KB)
+    {
+        return std::min(m_compressLevel, MIN_COMPRESS_LEVEL);
+    }
+    return m_compressLevel;
+}
+
+void CompressPolicy::onCompress(
+    uint16_t _moduleID, size_t _rawSize, size_t _compressedSize, uint64_t _costNs)
+{
+    if (!m_adaptive || _rawSize == 0)
+    {
+        return;
+    }
+    auto& moduleStat = stat(_moduleID);
+    auto ratio = (uint32_t)std::min<uint64_t>(_compressedSize * 1000 / _rawSize, 1000);
+    auto costPerKB = _costNs * 1024 / _rawSize;
+    // ewma with weight 1/8, the races between the threads only lose some samples
+    auto lastRatio = moduleStat.ratio.load();
+    moduleStat.ratio.store(lastRatio == 0 ? ratio : (lastRatio * 7 + ratio) / 8);
+    auto lastCost = moduleStat.costPerKB.load();
+    moduleStat.costPerKB.store(lastCost == 0 ? costPerKB : (lastCost * 7 + costPerKB) / 8);
+}
+
+void CompressPolicy::setSamplePath(std::string _samplePath, uint32_t _maxSamplesPerModule)
+{
+    m_samplePath = std::move(_samplePath);
+    m_maxSamplesPerModule = _maxSamplesPerModule;
+    if (!m_samplePath.empty() && !m_sampleWriter)
+    {
+        m_sampleWriter = std::make_unique<ThreadPool>("compressSample", 1);
+    }
+}
+
+void CompressPolicy::trySample(uint16_t _moduleID, bytesConstRef _payload)
+{
+    if (m_samplePath.empty() || !m_sampleWriter)
+    {
+        return;
+    }
+    auto& moduleStat = stat(_moduleID);
+    auto index = moduleStat.samples.fetch_add(1);
+    if (index >= m_maxSamplesPerModule)
+    {
+        return;
+    }
+    auto sample = std::make_shared<bytes>(_payload.begin(), _payload.end());
+    m_sampleWriter->enqueue([samplePath = m_samplePath, _moduleID, index, sample]() {
+        try
+        {
+            auto dir = boost::filesystem::path(samplePath) / std::to_string(_moduleID);
+            boost::filesystem::create_directories(dir);
+            std::ofstream sampleFile((dir / (std::to_string(index) + ".bin")).string(),
+                std::ios::binary | std::ios::trunc);
+            sampleFile.write((const char*)sample->data(), (std::streamsize)sample->size());
+        }
+        catch (std::exception const& e)
+        {
+            P2PMSG_LOG(WARNING) << LOG_DESC("trySample: write sample failed")
+                                << LOG_KV("moduleID", _moduleID)
+                                << LOG_KV("msg", boost::diagnostic_information(e));
+        }
+    });
+}
+
+bytes CompressPolicy::encodeDictionaryIDs(std::vector<uint32_t> const& _dictIDs)
+{
+    bytes data;
+    data.reserve(_dictIDs.size() * sizeof(uint32_t));
+    for (auto dictID : _dictIDs)
+    {
+        uint32_t networkDictID = boost::asio::detail::socket_ops::host_to_network_long(dictID);
+        data.insert(data.end(), (byte*)&networkDictID, (byte*)&networkDictID + sizeof(uint32_t));
+    }
+    return data;
+}
+
+std::vector<uint32_t> CompressPolicy::decodeDictionaryIDs(bytesConstRef _data)
+{
+    std::vector<uint32_t> dictIDs;
+    dictIDs.reserve(_data.size() / sizeof(uint32_t));
+    for (size_t offset = 0; offset + sizeof(uint32_t) <= _data.size(); offset += sizeof(uint32_t))
+    {
+        uint32_t networkDictID = 0;
+        memcpy(&networkDictID, _data.data() + offset, sizeof(uint32_t));
+        dictIDs.emplace_back(boost::asio::detail::socket_ops::network_to_host_long(networkDictID));
+    }
+    return dictIDs;
+}
@@ -0,0 +1,114 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the compress policy of the p2p message: per-module trained zstd dictionaries and the
+ * adaptive compress level
+ * @file CompressPolicy.h
+ */
+#pragma once
+
+#include <bcos-utilities/Common.h>
+#include <bcos-utilities/ThreadPool.h>
+#include <bcos-utilities/ZstdCompress.h>
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bcos::gateway
+{
+struct CompressStat
+{
+    // ewma of compressed size / raw size, in per mille, 0 means no sample yet
+    std::atomic<uint32_t> ratio{0};
+    // ewma of the compress cost per KB raw data, in nanoseconds
+    std::atomic<uint64_t> costPerKB{0};
+    // the number of messages that asked for the compress level
+    std::atomic<uint64_t> messages{0};
+    // the number of payload samples captured for dictionary training
+    std::atomic<uint32_t> samples{0};
+};
+
+class CompressPolicy
+{
+public:
+    using Ptr = std::shared_ptr<CompressPolicy>;
+
+    /// skip compressing the module whose compress ratio is higher than 900‰
+    constexpr static uint32_t SKIP_RATIO = 900;
+    /// a skipped module is still compressed every 64 messages to track the traffic change
+    constexpr static uint64_t PROBE_INTERVAL = 64;
+    /// fallback to a fast level when compress costs more than 20us per KB, the negative levels of
+    /// zstd are faster than the default level 1 with a lower ratio
+    constexpr static uint64_t MAX_COST_PER_KB = 20 * 1000;
+    constexpr static int MIN_COMPRESS_LEVEL = -3;
+    /// the dictionary file name is {moduleID}.dict
+    constexpr static std::string_view DICTIONARY_SUFFIX = ".dict";
+
+    CompressPolicy(int _compressLevel, bool _adaptive)
+      : m_compressLevel(_compressLevel), m_adaptive(_adaptive)
+    {}
+    CompressPolicy(const CompressPolicy&) = delete;
+    CompressPolicy(CompressPolicy&&) = delete;
+    CompressPolicy& operator=(const CompressPolicy&) = delete;
+    CompressPolicy& operator=(CompressPolicy&&) = delete;
+    virtual ~CompressPolicy() = default;
+
+    int compressLevel() const { return m_compressLevel; }
+    bool adaptive() const { return m_adaptive; }
+
+    // load the trained dictionaries named {moduleID}.dict in the given directory
+    void loadDictionaries(std::string const& _dictPath);
+    bool addDictionary(uint16_t _moduleID, ZstdDictionary::Ptr _dictionary);
+    ZstdDictionary::Ptr dictionary(uint16_t _moduleID) const;
+    ZstdDictionary::Ptr dictionaryByID(uint32_t _dictID) const;
+    std::vector<uint32_t> dictionaryIDs() const;
+
+    // the compress level of the module, nullopt means the payload should not be compressed
+    std::optional<int> compressLevel(uint16_t _moduleID);
+    // update the measured compress ratio and cost of the module
+    void onCompress(uint16_t _moduleID, size_t _rawSize, size_t _compressedSize, uint64_t _costNs);
+
+    // capture the payloads into {samplePath}/{moduleID}/ for dictionary training
+    void setSamplePath(std::string _samplePath, uint32_t _maxSamplesPerModule);
+    // the sample is written by the background thread, not blocking the sending thread
+    void trySample(uint16_t _moduleID, bytesConstRef _payload);
+
+    // the dictionary IDs advertised to the peer after handshake
+    static bytes encodeDictionaryIDs(std::vector<uint32_t> const& _dictIDs);
+    static std::vector<uint32_t> decodeDictionaryIDs(bytesConstRef _data);
+
+private:
+    CompressStat& stat(uint16_t _moduleID);
+
+    int m_compressLevel;
+    bool m_adaptive;
+
+    mutable std::shared_mutex x_dictionaries;
+    std::unordered_map<uint16_t, ZstdDictionary::Ptr> m_moduleDictionaries;
+    std::unordered_map<uint32_t, ZstdDictionary::Ptr> m_dictionaries;
+
+    std::shared_mutex x_stats;
+    std::unordered_map<uint16_t, std::unique_ptr<CompressStat>> m_stats;
+
+    std::string m_samplePath;
+    uint32_t m_maxSamplesPerModule = 0;
+    // destroyed first, the pending samples are dropped when stopped
+    std::unique_ptr<ThreadPool> m_sampleWriter;
+};
+}  // namespace bcos::gateway
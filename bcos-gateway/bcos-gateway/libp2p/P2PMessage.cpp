@@ -23,6 +23,8 @@
 #include <bcos-gateway/libp2p/P2PMessage.h>
 #include <bcos-utilities/ZstdCompress.h>
 #include <boost/asio/detail/socket_ops.hpp>
+#include <algorithm>
+#include <chrono>
 
 using namespace bcos;
 using namespace bcos::gateway;
@@ -168,9 +170,58 @@ int32_t P2PMessageOptions::decode(const bytesConstRef& _buffer)
     return offset;
 }
 
+SendPriority P2PMessage::sendPriority() const
+{
+    if (m_packetType == GatewayMessageType::AMOPMessageType)
+    {
+        return SendPriority::AMOP;
+    }
+    // the gateway control messages: heartbeat, handshake, router table...
+    if (!hasOptions())
+    {
+        return SendPriority::Consensus;
+    }
+    auto moduleID = m_options.moduleID();
+    switch (moduleID)
+    {
+    case bcos::protocol::ModuleID::PBFT:
+    case bcos::protocol::ModuleID::Raft:
+    // the consensus waits for the missed txs of the proposal
+    case bcos::protocol::ModuleID::ConsTxsSync:
+        return SendPriority::Consensus;
+    case bcos::protocol::ModuleID::BlockSync:
+        // the block sync status and the block requests are small, the blocks are not
+        return m_payload.size() <= MAX_SYNC_STATUS_PAYLOAD_SIZE ? SendPriority::SyncStatus :
+                                                                  SendPriority::BlockData;
+    case bcos::protocol::ModuleID::TxsSync:
+    case bcos::protocol::ModuleID::TREE_PUSH_TRANSACTION:
+        return SendPriority::TxsGossip;
+    case bcos::protocol::ModuleID::AMOP:
+        return SendPriority::AMOP;
+    default:
+        break;
+    }
+    if (moduleID >= bcos::protocol::ModuleID::SYNC_PUSH_TRANSACTION &&
+        moduleID <= bcos::protocol::ModuleID::SYNC_END)
+    {
+        return SendPriority::TxsGossip;
+    }
+    if (moduleID >= bcos::protocol::ModuleID::LIGHTNODE_GET_BLOCK &&
+        moduleID <= bcos::protocol::ModuleID::LIGHTNODE_END)
+    {
+        return SendPriority::BlockData;
+    }
+    return SendPriority::AMOP;
+}
+
 bool P2PMessage::encodeHeader(bytes& _buffer) const
 {
-    if (auto result = encodeHeaderImpl(_buffer); !result)
+    return encodeHeader(_buffer, m_ext);
+}
+
+bool P2PMessage::encodeHeader(bytes& _buffer, uint16_t _ext) const
+{
+    if (auto result = encodeHeaderImpl(_buffer, _ext); !result)
     {
         return result;
     }
@@ -183,7 +234,7 @@ bool P2PMessage::encodeHeader(bytes& _buffer) const
     return true;
 }
 
-bool bcos::gateway::P2PMessage::encodeHeaderImpl(bytes& _buffer) const
+bool bcos::gateway::P2PMessage::encodeHeaderImpl(bytes& _buffer, uint16_t _ext) const
 {
     auto offset = _buffer.size();
 
@@ -192,7 +243,7 @@ bool bcos::gateway::P2PMessage::encodeHeaderImpl(bytes& _buffer) const
     uint16_t version = boost::asio::detail::socket_ops::host_to_network_short(m_version);
     uint16_t packetType = boost::asio::detail::socket_ops::host_to_network_short(m_packetType);
     uint32_t seq = boost::asio::detail::socket_ops::host_to_network_long(m_seq);
-    uint16_t ext = boost::asio::detail::socket_ops::host_to_network_short(m_ext);
+    uint16_t ext = boost::asio::detail::socket_ops::host_to_network_short(_ext);
 
     _buffer.insert(_buffer.end(), (byte*)&length, (byte*)&length + 4);
     _buffer.insert(_buffer.end(), (byte*)&version, (byte*)&version + 2);
@@ -205,33 +256,22 @@ bool bcos::gateway::P2PMessage::encodeHeaderImpl(bytes& _buffer) const
 bool P2PMessage::encode(EncodedMessage& _buffer) const
 {
     bool isCompressSuccess = false;
-    if (_buffer.compress)
-    {
-        bcos::bytes compressData;
-        if (tryToCompressPayload(compressData))
-        {
-            isCompressSuccess = true;
-            // set compress flag
-            m_ext |= bcos::protocol::MessageExtFieldFlag::COMPRESS;
-            _buffer.payload = std::move(compressData);
-        }
-    }
-
-    // No data compression is performed
-    if (!isCompressSuccess)
-    {
-        _buffer.payload = m_payload;
-    }
+    _buffer.payload =
+        encodedPayload(_buffer.compress, isCompressSuccess, _buffer.compressDictIDs.get());
+    // the message maybe sent to sessions with different protocol version by several threads, the
+    // compress flag of the header follows the payload really sent, the message is not modified
+    uint16_t ext = isCompressSuccess ? (m_ext | bcos::protocol::MessageExtFieldFlag::COMPRESS) :
+                                       (m_ext & (~bcos::protocol::MessageExtFieldFlag::COMPRESS));
 
     bytes headerBuffer;
     // encode header
-    if (!encodeHeader(headerBuffer))
+    if (!encodeHeader(headerBuffer, ext))
     {
         return false;
     }
 
     *(uint32_t*)headerBuffer.data() = boost::asio::detail::socket_ops::host_to_network_long(
-        headerBuffer.size() + _buffer.payload.size());
+        headerBuffer.size() + _buffer.payloadSize());
 
     _buffer.header = std::move(headerBuffer);
     return true;
@@ -295,6 +335,85 @@ bool P2PMessage::tryToCompressPayload(bytes& compressData) const
     return isCompressSuccess;
 }
 
+std::shared_ptr<const bytes> P2PMessage::encodedPayload(
+    bool _compress, bool& _compressed, std::set<uint32_t> const* _acceptedDictIDs) const
+{
+    _compressed = false;
+    Guard lock(x_encodedPayload);
+    if (_compress && m_payload.size() > bcos::gateway::c_compressThreshold &&
+        m_version >= (uint16_t)(bcos::protocol::ProtocolVersion::V2))
+    {
+        // use the dictionary of the module only when the peer has the same dictionary
+        ZstdDictionary::Ptr dictionary;
+        if (m_compressPolicy && _acceptedDictIDs && !_acceptedDictIDs->empty())
+        {
+            dictionary = m_compressPolicy->dictionary(compressModuleID());
+            if (dictionary && !_acceptedDictIDs->contains(dictionary->id()))
+            {
+                dictionary = nullptr;
+            }
+        }
+        auto dictID = dictionary ? dictionary->id() : 0;
+        auto it = std::find_if(m_compressedPayloads.begin(), m_compressedPayloads.end(),
+            [dictID](auto const& compressed) { return compressed.first == dictID; });
+        if (it == m_compressedPayloads.end())
+        {
+            m_compressedPayloads.emplace_back(dictID, compressPayload(dictionary.get()));
+            it = std::prev(m_compressedPayloads.end());
+        }
+        if (it->second)
+        {
+            _compressed = true;
+            return it->second;
+        }
+    }
+    if (!m_rawPayload)
+    {
+        m_rawPayload = std::make_shared<const bytes>(m_payload);
+    }
+    return m_rawPayload;
+}
+
+std::shared_ptr<const bytes> P2PMessage::compressPayload(ZstdDictionary* _dictionary) const
+{
+    if (!m_compressPolicy)
+    {
+        auto compressData = std::make_shared<bytes>();
+        if (!tryToCompressPayload(*compressData))
+        {
+            return nullptr;
+        }
+        return compressData;
+    }
+
+    auto moduleID = compressModuleID();
+    m_compressPolicy->trySample(moduleID, ref(m_payload));
+    auto level = m_compressPolicy->compressLevel(moduleID);
+    if (!level.has_value())
+    {
+        return nullptr;
+    }
+    auto startT = std::chrono::steady_clock::now();
+    auto compressData = std::make_shared<bytes>();
+    bool isCompressSuccess =
+        _dictionary ? ZstdCompress::compress(ref(m_payload), *compressData, *level, *_dictionary) :
+                      ZstdCompress::compress(ref(m_payload), *compressData, *level);
+    if (!isCompressSuccess)
+    {
+        return nullptr;
+    }
+    auto costNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - startT)
+                      .count();
+    m_compressPolicy->onCompress(moduleID, m_payload.size(), compressData->size(), costNs);
+    // the compressed data is larger than the raw data, no need to send the compressed data
+    if (compressData->size() >= m_payload.size())
+    {
+        return nullptr;
+    }
+    return compressData;
+}
+
 int32_t P2PMessage::decodeHeader(const bytesConstRef& _buffer)
 {
     int32_t offset = 0;
@@ -366,12 +485,17 @@ int32_t P2PMessage::decode(const bytesConstRef& _buffer)
     auto data = _buffer.getCroppedData(offset, m_length - offset);
     // raw data cropped from buffer, maybe be compressed or not
 
+    resetEncodedPayload();
     // uncompress payload
     // payload has been compressed
     if ((m_ext & bcos::protocol::MessageExtFieldFlag::COMPRESS) ==
         bcos::protocol::MessageExtFieldFlag::COMPRESS)
     {
-        bool isUncompressSuccess = ZstdCompress::uncompress(data, m_payload);
+        bool isUncompressSuccess =
+            m_compressPolicy ?
+                ZstdCompress::uncompress(data, m_payload,
+                    [this](uint32_t _dictID) { return m_compressPolicy->dictionaryByID(_dictID); }) :
+                ZstdCompress::uncompress(data, m_payload);
         if (!isUncompressSuccess)
         {
             P2PMSG_LOG(ERROR) << LOG_DESC("ZstdCompress decode message error, uncompress failed")
@@ -23,8 +23,11 @@
 #include <bcos-framework/protocol/Protocol.h>
 #include <bcos-gateway/libnetwork/Common.h>
 #include <bcos-gateway/libnetwork/Message.h>
+#include <bcos-gateway/libp2p/CompressPolicy.h>
 #include <bcos-utilities/Common.h>
 #include <boost/throw_exception.hpp>
+#include <optional>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -125,6 +128,9 @@ public:
     constexpr static size_t RSA_PUBLIC_KEY_TRUNC = 8;
     constexpr static size_t RSA_PUBLIC_KEY_TRUNC_LENGTH = 26;
 
+    /// the block sync messages not larger than 4K are status/request messages, not block data
+    constexpr static size_t MAX_SYNC_STATUS_PAYLOAD_SIZE = 4 * 1024;
+
     P2PMessage() = default;
 
     // ~P2PMessage() override = default;
@@ -165,7 +171,11 @@ public:
     void setOptions(P2PMessageOptions _options) { m_options = std::move(_options); }
 
     bytesConstRef payload() const { return bcos::ref(m_payload); }
-    void setPayload(bytes _payload) { m_payload = std::move(_payload); }
+    void setPayload(bytes _payload)
+    {
+        m_payload = std::move(_payload);
+        resetEncodedPayload();
+    }
 
     void setRespPacket() { m_ext |= bcos::protocol::MessageExtFieldFlag::RESPONSE; }
     bool encode(bytes& _buffer) override;
@@ -175,10 +185,26 @@ public:
     {
         return (m_ext & bcos::protocol::MessageExtFieldFlag::RESPONSE) != 0;
     }
+    SendPriority sendPriority() const override;
 
     // compress payload if payload need to be compressed
     bool tryToCompressPayload(bytes& compressData) const;
 
+    // the encoded payload shared by all the sessions the message is sent to, the payload is
+    // compressed at most once(for every dictionary) no matter how many sessions the message is
+    // broadcast to
+    std::shared_ptr<const bytes> encodedPayload(bool _compress, bool& _compressed,
+        std::set<uint32_t> const* _acceptedDictIDs = nullptr) const;
+
+    // the moduleID used to choose the compress dictionary and level
+    uint16_t compressModuleID() const { return hasOptions() ? m_options.moduleID() : 0; }
+
+    CompressPolicy::Ptr const& compressPolicy() const { return m_compressPolicy; }
+    void setCompressPolicy(CompressPolicy::Ptr _compressPolicy)
+    {
+        m_compressPolicy = std::move(_compressPolicy);
+    }
+
     bool hasOptions() const
     {
         return (m_packetType == GatewayMessageType::PeerToPeerMessage) ||
@@ -217,14 +243,26 @@ public:
     bool encodeHeader(bytes& _buffer) const override;
 
 protected:
-    virtual bool encodeHeaderImpl(bytes& _buffer) const;
+    // encode the header with the given ext, the compress flag depends on the encoded payload
+    bool encodeHeader(bytes& _buffer, uint16_t _ext) const;
+    virtual bool encodeHeaderImpl(bytes& _buffer, uint16_t _ext) const;
     virtual int32_t decodeHeader(const bytesConstRef& _buffer);
 
+    void resetEncodedPayload()
+    {
+        Guard lock(x_encodedPayload);
+        m_rawPayload.reset();
+        m_compressedPayloads.clear();
+    }
+
+    // compress the payload with the level and dictionary chosen by the compress policy
+    std::shared_ptr<const bytes> compressPayload(ZstdDictionary* _dictionary) const;
+
     mutable uint32_t m_length = 0;
     uint16_t m_version = (uint16_t)(bcos::protocol::ProtocolVersion::V0);
     uint16_t m_packetType = 0;
     uint32_t m_seq = 0;
-    mutable uint16_t m_ext = 0;
+    uint16_t m_ext = 0;
 
     // the src p2pNodeID, for message forward, only encode into the P2PMessageV2
     std::string m_srcP2PNodeID;
@@ -234,6 +272,15 @@ protected:
     P2PMessageOptions m_options;  ///< options fields
     bytes m_payload;              ///< payload data
 
+    mutable bcos::Mutex x_encodedPayload;
+    // the raw payload shared with the write queue of sessions
+    mutable std::shared_ptr<const bytes> m_rawPayload;
+    // dictID => the compressed payload, dictID 0 means compressed without dictionary, nullptr
+    // means compress failed or skipped
+    mutable std::vector<std::pair<uint32_t, std::shared_ptr<const bytes>>> m_compressedPayloads;
+
+    CompressPolicy::Ptr m_compressPolicy;
+
     std::any m_extAttr = nullptr;  ///< message additional attributes
 };
 
@@ -246,8 +293,18 @@ public:
     Message::Ptr buildMessage() override
     {
         auto message = std::make_shared<P2PMessage>();
+        message->setCompressPolicy(m_compressPolicy);
         return message;
     }
+
+    CompressPolicy::Ptr const& compressPolicy() const { return m_compressPolicy; }
+    void setCompressPolicy(CompressPolicy::Ptr _compressPolicy)
+    {
+        m_compressPolicy = std::move(_compressPolicy);
+    }
+
+private:
+    CompressPolicy::Ptr m_compressPolicy;
 };
 
 inline std::ostream& operator<<(std::ostream& _out, const P2PMessage& _p2pMessage)
@@ -24,9 +24,9 @@
 using namespace bcos;
 using namespace bcos::gateway;
 
-bool P2PMessageV2::encodeHeaderImpl(bytes& _buffer) const
+bool P2PMessageV2::encodeHeaderImpl(bytes& _buffer, uint16_t _ext) const
 {
-    auto ret = P2PMessage::encodeHeaderImpl(_buffer);
+    auto ret = P2PMessage::encodeHeaderImpl(_buffer, _ext);
     if (m_version <= (uint16_t)(bcos::protocol::ProtocolVersion::V0))
     {
         return ret;
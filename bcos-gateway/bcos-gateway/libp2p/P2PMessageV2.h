@@ -35,7 +35,7 @@ public:
 
 protected:
     int32_t decodeHeader(const bytesConstRef& _buffer) override;
-    bool encodeHeaderImpl(bytes& _buffer) const override;
+    bool encodeHeaderImpl(bytes& _buffer, uint16_t _ext) const override;
 
     int16_t m_ttl = 10;
 };
@@ -48,7 +48,17 @@ public:
     Message::Ptr buildMessage() override
     {
         auto message = std::make_shared<P2PMessageV2>();
+        message->setCompressPolicy(m_compressPolicy);
         return message;
     }
+
+    CompressPolicy::Ptr const& compressPolicy() const { return m_compressPolicy; }
+    void setCompressPolicy(CompressPolicy::Ptr _compressPolicy)
+    {
+        m_compressPolicy = std::move(_compressPolicy);
+    }
+
+private:
+    CompressPolicy::Ptr m_compressPolicy;
 };
 }  // namespace bcos::gateway
@@ -45,6 +45,10 @@ Service::Service(std::string const& _nodeID) : m_nodeID(_nodeID)
     registerHandlerByMsgType(GatewayMessageType::Heartbeat,
         boost::bind(&Service::onReceiveHeartbeat, this, boost::placeholders::_1,
             boost::placeholders::_2, boost::placeholders::_3));
+
+    registerHandlerByMsgType(GatewayMessageType::CompressDictionaryIDs,
+        boost::bind(&Service::onReceiveCompressDictionaryIDs, this, boost::placeholders::_1,
+            boost::placeholders::_2, boost::placeholders::_3));
 }
 
 void Service::start()
@@ -693,6 +697,42 @@ void Service::Service::onReceiveHeartbeat(
                        << LOG_KV("endpoint", endpoint);
 }
 
+// send the compress dictionaries the node has, the peer compresses the payload with the
+// dictionaries only after receiving the message
+void Service::asyncSendCompressDictionaryIDs(P2PSession::Ptr _session)
+{
+    if (!m_compressPolicy)
+    {
+        return;
+    }
+    auto dictIDs = m_compressPolicy->dictionaryIDs();
+    if (dictIDs.empty())
+    {
+        return;
+    }
+    auto message = std::static_pointer_cast<P2PMessage>(messageFactory()->buildMessage());
+    message->setPacketType(GatewayMessageType::CompressDictionaryIDs);
+    message->setSeq(messageFactory()->newSeq());
+    message->setPayload(CompressPolicy::encodeDictionaryIDs(dictIDs));
+    SERVICE_LOG(INFO) << LOG_DESC("asyncSendCompressDictionaryIDs")
+                      << LOG_KV("peer", _session->p2pID()) << LOG_KV("dictionaries", dictIDs.size());
+    sendMessageToSession(_session, message, Options(), nullptr);
+}
+
+void Service::onReceiveCompressDictionaryIDs(
+    NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message)
+{
+    if (_error.errorCode() || !_session || !_message)
+    {
+        return;
+    }
+    auto dictIDs = CompressPolicy::decodeDictionaryIDs(_message->payload());
+    SERVICE_LOG(INFO) << LOG_DESC("onReceiveCompressDictionaryIDs")
+                      << LOG_KV("peer", _session->p2pID()) << LOG_KV("dictionaries", dictIDs.size());
+    _session->session()->setCompressDictIDs(
+        std::make_shared<const std::set<uint32_t>>(dictIDs.begin(), dictIDs.end()));
+}
+
 // receive the protocolInfo
 void Service::onReceiveProtocol(
     NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message)
@@ -732,6 +772,11 @@ void Service::onReceiveProtocol(
                           << LOG_KV("supportMinVersion", m_localProtocol->minVersion())
                           << LOG_KV("supportMaxVersion", m_localProtocol->maxVersion())
                           << LOG_KV("negotiatedVersion", version);
+        // the compressed payload is only supported since V2
+        if (version >= bcos::protocol::ProtocolVersion::V2)
+        {
+            asyncSendCompressDictionaryIDs(_session);
+        }
     }
     catch (std::exception const& e)
     {
@@ -159,6 +159,12 @@ public:
         m_onMessageHandler = std::move(_handler);
     }
 
+    CompressPolicy::Ptr const& compressPolicy() const { return m_compressPolicy; }
+    void setCompressPolicy(CompressPolicy::Ptr _compressPolicy)
+    {
+        m_compressPolicy = std::move(_compressPolicy);
+    }
+
     void updatePeerBlacklist(const std::set<std::string>& _strList, const bool _enable) override;
     void updatePeerWhitelist(const std::set<std::string>& _strList, const bool _enable) override;
 
@@ -173,6 +179,10 @@ protected:
         NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message);
     void onReceiveHeartbeat(
         NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message);
+    // advertise the compress dictionaries after handshake
+    void asyncSendCompressDictionaryIDs(P2PSession::Ptr _session);
+    void onReceiveCompressDictionaryIDs(
+        NetworkException _error, std::shared_ptr<P2PSession> _session, P2PMessage::Ptr _message);
 
     // handlers called when new-session
     void registerOnNewSession(std::function<void(P2PSession::Ptr)> _handler)
@@ -250,6 +260,8 @@ private:
     std::function<std::optional<bcos::Error>(SessionFace&, Message&)> m_beforeMessageHandler;
 
     std::function<std::optional<bcos::Error>(SessionFace::Ptr, Message::Ptr)> m_onMessageHandler;
+
+    CompressPolicy::Ptr m_compressPolicy;
     // bcos::LogLevel m_connectionLogLevel = bcos::LogLevel::WARNING;
 };
 
@@ -36,7 +36,8 @@ void RateLimiterManager::initP2pBasicMsgTypes()
     for (uint16_t type : {GatewayMessageType::Heartbeat, GatewayMessageType::Handshake,
              GatewayMessageType::RequestNodeStatus, GatewayMessageType::ResponseNodeStatus,
              GatewayMessageType::SyncNodeSeq, GatewayMessageType::RouterTableSyncSeq,
-             GatewayMessageType::RouterTableResponse, GatewayMessageType::RouterTableRequest})
+             GatewayMessageType::RouterTableResponse, GatewayMessageType::RouterTableRequest,
+             GatewayMessageType::CompressDictionaryIDs})
     {
         m_p2pBasicMsgTypes.at(type) = true;
     }
@@ -0,0 +1,197 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief loopback benchmark of the session write path over ssl: the message rate and the cpu cost
+ * per MB of writing the buffer sequence directly and writing the coalesced buffers, build with
+ * -DWITH_IO_URING=ON to measure the io_uring backend of boost.asio
+ * @file benchmarkTransport.cpp
+ */
+
+#include <bcos-gateway/libnetwork/Session.h>
+#include <benchmark/benchmark.h>
+#include <boost/asio.hpp>
+#include <boost/asio/ssl.hpp>
+#include <ctime>
+#include <future>
+#include <optional>
+#include <random>
+#include <thread>
+
+using namespace bcos;
+using namespace bcos::gateway;
+
+namespace
+{
+constexpr static size_t HEADER_SIZE = 14;
+constexpr static size_t READ_BUFFER_SIZE = 256 * 1024;
+
+uint64_t processCPUTime()
+{
+    timespec time{};
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &time);
+    return (uint64_t)time.tv_sec * 1000 * 1000 * 1000 + (uint64_t)time.tv_nsec;
+}
+
+struct LoopbackFixture
+{
+    boost::asio::io_context m_ioContext;
+    boost::asio::executor_work_guard<boost::asio::io_context::executor_type> m_work;
+    boost::asio::ssl::context m_serverContext;
+    boost::asio::ssl::context m_clientContext;
+    std::optional<boost::asio::ssl::stream<boost::asio::ip::tcp::socket>> m_server;
+    std::optional<boost::asio::ssl::stream<boost::asio::ip::tcp::socket>> m_client;
+    bytes m_readBuffer;
+    std::atomic<size_t> m_received{0};
+    std::thread m_ioThread;
+
+    LoopbackFixture()
+      : m_work(boost::asio::make_work_guard(m_ioContext)),
+        m_serverContext(boost::asio::ssl::context::tlsv12_server),
+        m_clientContext(boost::asio::ssl::context::tlsv12_client),
+        m_readBuffer(READ_BUFFER_SIZE)
+    {
+        std::string certPath = BENCHMARK_CERT_PATH;
+        m_serverContext.use_certificate_chain_file(certPath + "/node.crt");
+        m_serverContext.use_private_key_file(
+            certPath + "/node.key", boost::asio::ssl::context::pem);
+        m_clientContext.set_verify_mode(boost::asio::ssl::verify_none);
+
+        m_server.emplace(m_ioContext, m_serverContext);
+        m_client.emplace(m_ioContext, m_clientContext);
+        boost::asio::ip::tcp::acceptor acceptor(m_ioContext,
+            boost::asio::ip::tcp::endpoint(boost::asio::ip::make_address("127.0.0.1"), 0));
+        m_client->next_layer().connect(acceptor.local_endpoint());
+        acceptor.accept(m_server->next_layer());
+        m_client->next_layer().set_option(boost::asio::ip::tcp::no_delay(true));
+
+        std::thread serverHandshake(
+            [this]() { m_server->handshake(boost::asio::ssl::stream_base::server); });
+        m_client->handshake(boost::asio::ssl::stream_base::client);
+        serverHandshake.join();
+
+        startRead();
+        m_ioThread = std::thread([this]() { m_ioContext.run(); });
+    }
+    LoopbackFixture(const LoopbackFixture&) = delete;
+    LoopbackFixture(LoopbackFixture&&) = delete;
+    LoopbackFixture& operator=(const LoopbackFixture&) = delete;
+    LoopbackFixture& operator=(LoopbackFixture&&) = delete;
+    ~LoopbackFixture()
+    {
+        m_ioContext.stop();
+        m_ioThread.join();
+    }
+
+    void startRead()
+    {
+        m_server->async_read_some(boost::asio::buffer(m_readBuffer),
+            [this](boost::system::error_code _error, size_t _size) {
+                if (_error)
+                {
+                    return;
+                }
+                m_received.fetch_add(_size);
+                startRead();
+            });
+    }
+
+    void write(Session::WriteBuffers const& _buffers)
+    {
+        std::promise<boost::system::error_code> promise;
+        boost::asio::post(m_ioContext, [this, &_buffers, &promise]() {
+            boost::asio::async_write(*m_client, _buffers,
+                [&promise](boost::system::error_code _error, size_t) { promise.set_value(_error); });
+        });
+        if (auto error = promise.get_future().get())
+        {
+            BOOST_THROW_EXCEPTION(boost::system::system_error(error));
+        }
+    }
+
+    void waitReceived(size_t _size)
+    {
+        while (m_received.load() < _size)
+        {
+            std::this_thread::yield();
+        }
+    }
+};
+
+LoopbackFixture& fixture()
+{
+    static LoopbackFixture loopbackFixture;
+    return loopbackFixture;
+}
+
+// args: message size, messages per flush, coalesce the buffers or not
+void sessionWrite(benchmark::State& state)
+{
+    auto msgSize = (size_t)state.range(0);
+    auto batch = (size_t)state.range(1);
+    bool coalesce = state.range(2) != 0;
+
+    std::mt19937 random(msgSize);
+    std::vector<bytes> headers(batch, bytes(HEADER_SIZE));
+    std::vector<bytes> payloads(batch, bytes(msgSize));
+    for (auto& header : headers)
+    {
+        std::generate(header.begin(), header.end(), std::ref(random));
+    }
+    for (auto& payload : payloads)
+    {
+        std::generate(payload.begin(), payload.end(), std::ref(random));
+    }
+
+    auto& loopback = fixture();
+    auto received = loopback.m_received.load();
+    size_t sent = 0;
+    bytes writeBuffer;
+    auto cpuTime = processCPUTime();
+    for (auto _ : state)
+    {
+        Session::WriteBuffers buffers;
+        for (size_t i = 0; i < batch; ++i)
+        {
+            buffers.emplace_back(headers[i].data(), headers[i].size());
+            buffers.emplace_back(payloads[i].data(), payloads[i].size());
+        }
+        if (coalesce)
+        {
+            Session::WriteBuffers coalescedBuffers;
+            Session::coalesceBuffers(buffers, writeBuffer, coalescedBuffers);
+            loopback.write(coalescedBuffers);
+        }
+        else
+        {
+            loopback.write(buffers);
+        }
+        sent += batch * (HEADER_SIZE + msgSize);
+    }
+    loopback.waitReceived(received + sent);
+    cpuTime = processCPUTime() - cpuTime;
+
+    state.SetItemsProcessed((int64_t)(state.iterations() * batch));
+    state.SetBytesProcessed((int64_t)sent);
+    state.counters["cpu_ns_per_MB"] =
+        benchmark::Counter((double)cpuTime * 1024 * 1024 / (double)std::max<size_t>(sent, 1));
+}
+}  // namespace
+
+BENCHMARK(sessionWrite)
+    ->ArgsProduct({{128, 1024, 16 * 1024, 256 * 1024}, {1, 16, 64}, {0, 1}})
+    ->ArgNames({"msgSize", "batch", "coalesce"})
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
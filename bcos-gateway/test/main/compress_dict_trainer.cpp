@@ -0,0 +1,101 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief train the per-module zstd dictionaries from the payload samples captured by the gateway
+ * with p2p.compression_sample_path
+ * @file compress_dict_trainer.cpp
+ */
+#include "bcos-gateway/libp2p/CompressPolicy.h"
+#include "bcos-utilities/Common.h"
+#include "bcos-utilities/FileUtility.h"
+#include "bcos-utilities/ZstdCompress.h"
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+using namespace bcos;
+using namespace bcos::gateway;
+
+void usage()
+{
+    std::cerr << "./compress-dict-trainer -h/--help" << std::endl;
+    std::cerr << "  ./compress-dict-trainer ${sample_path} ${dict_path} [dict_size]" << std::endl;
+    std::cerr << "  sample_path: the p2p.compression_sample_path of the gateway" << std::endl;
+    std::cerr << "  dict_path: the output p2p.compression_dict_path, default dict_size: 112640"
+              << std::endl;
+}
+
+int main(int argc, const char** argv)
+{
+    if ((argc >= 2) && ((std::string(argv[1]) == "-h") || (std::string(argv[1]) == "--help")))
+    {
+        usage();
+        return -1;
+    }
+    if (argc < 3)
+    {
+        usage();
+        return -1;
+    }
+    // the zstd recommended dictionary size
+    constexpr static size_t defaultDictSize = 110 * 1024;
+    boost::filesystem::path samplePath = argv[1];
+    boost::filesystem::path dictPath = argv[2];
+    size_t dictSize = argc >= 4 ? boost::lexical_cast<size_t>(argv[3]) : defaultDictSize;
+    try
+    {
+        boost::filesystem::create_directories(dictPath);
+        for (auto const& moduleDir : boost::filesystem::directory_iterator(samplePath))
+        {
+            if (!boost::filesystem::is_directory(moduleDir.path()))
+            {
+                continue;
+            }
+            auto moduleID = boost::lexical_cast<uint16_t>(moduleDir.path().filename().string());
+            std::vector<bytes> samples;
+            for (auto const& sampleFile : boost::filesystem::directory_iterator(moduleDir.path()))
+            {
+                if (auto sample = readContents(sampleFile.path()); sample && !sample->empty())
+                {
+                    samples.emplace_back(std::move(*sample));
+                }
+            }
+            auto dictionary = ZstdCompress::trainDictionary(samples, dictSize);
+            if (dictionary.empty())
+            {
+                std::cerr << "* train dictionary failed, moduleID: " << moduleID
+                          << ", samples: " << samples.size() << std::endl;
+                continue;
+            }
+            auto fileName = std::to_string(moduleID);
+            fileName += CompressPolicy::DICTIONARY_SUFFIX;
+            auto dictFile = dictPath / fileName;
+            std::ofstream output(dictFile.string(), std::ios::binary | std::ios::trunc);
+            output.write((const char*)dictionary.data(), (std::streamsize)dictionary.size());
+            std::cout << "* train dictionary success, moduleID: " << moduleID
+                      << ", samples: " << samples.size() << ", dictSize: " << dictionary.size()
+                      << ", file: " << dictFile.string() << std::endl;
+        }
+    }
+    catch (std::exception const& e)
+    {
+        std::cerr << "* train dictionary failed, error: " << boost::diagnostic_information(e)
+                  << std::endl;
+        return -1;
+    }
+    return 0;
+}
@@ -0,0 +1,171 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for the compress policy of the p2p message
+ * @file CompressPolicyTest.cpp
+ */
+
+#include <bcos-gateway/libp2p/Common.h>
+#include <bcos-gateway/libp2p/CompressPolicy.h>
+#include <bcos-gateway/libp2p/P2PMessageV2.h>
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/filesystem.hpp>
+#include <boost/test/unit_test.hpp>
+#include <chrono>
+#include <thread>
+
+using namespace bcos;
+using namespace bcos::gateway;
+using namespace bcos::test;
+
+BOOST_FIXTURE_TEST_SUITE(CompressPolicyTest, TestPromptFixture)
+
+BOOST_AUTO_TEST_CASE(test_adaptiveCompressLevel)
+{
+    uint16_t moduleID = 1000;
+    CompressPolicy policy(3, true);
+    BOOST_CHECK_EQUAL(policy.compressLevel(moduleID).value(), 3);
+
+    // the compress cost is too high, fallback to a level faster than the default one
+    policy.onCompress(moduleID, 1024, 100, CompressPolicy::MAX_COST_PER_KB * 2);
+    BOOST_CHECK_EQUAL(policy.compressLevel(moduleID).value(), CompressPolicy::MIN_COMPRESS_LEVEL);
+    BOOST_CHECK_LT(CompressPolicy::MIN_COMPRESS_LEVEL, (int)c_zstdCompressLevel);
+
+    // the payload is incompressible, only the probe message is compressed
+    uint16_t incompressibleModuleID = 1001;
+    policy.onCompress(incompressibleModuleID, 1024, 1024, 0);
+    size_t compressed = 0;
+    for (size_t i = 0; i < CompressPolicy::PROBE_INTERVAL * 2; ++i)
+    {
+        if (policy.compressLevel(incompressibleModuleID).has_value())
+        {
+            compressed++;
+        }
+    }
+    BOOST_CHECK_EQUAL(compressed, 2);
+
+    // the fixed level is always used when the adaptive policy is disabled
+    CompressPolicy fixedPolicy(3, false);
+    fixedPolicy.onCompress(moduleID, 1024, 1024, CompressPolicy::MAX_COST_PER_KB * 2);
+    BOOST_CHECK_EQUAL(fixedPolicy.compressLevel(moduleID).value(), 3);
+}
+
+BOOST_AUTO_TEST_CASE(test_sample)
+{
+    auto samplePath =
+        boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+    uint16_t moduleID = 1000;
+    {
+        CompressPolicy policy(1, false);
+        policy.setSamplePath(samplePath.string(), 2);
+        bytes payload(128, 'a');
+        for (size_t i = 0; i < 4; ++i)
+        {
+            policy.trySample(moduleID, ref(payload));
+        }
+
+        // the samples are written by the background thread
+        auto dir = samplePath / std::to_string(moduleID);
+        for (size_t i = 0; i < 100 && !(boost::filesystem::exists(dir / "0.bin") &&
+                                         boost::filesystem::exists(dir / "1.bin"));
+             ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+        BOOST_CHECK(boost::filesystem::exists(dir / "0.bin"));
+        BOOST_CHECK(boost::filesystem::exists(dir / "1.bin"));
+        BOOST_CHECK(!boost::filesystem::exists(dir / "2.bin"));
+    }
+    boost::filesystem::remove_all(samplePath);
+}
+
+BOOST_AUTO_TEST_CASE(test_dictionaryIDsCodec)
+{
+    std::vector<uint32_t> dictIDs{1, 0x12345678, 0xffffffff};
+    auto data = CompressPolicy::encodeDictionaryIDs(dictIDs);
+    BOOST_CHECK_EQUAL(data.size(), dictIDs.size() * sizeof(uint32_t));
+    BOOST_CHECK(CompressPolicy::decodeDictionaryIDs(ref(data)) == dictIDs);
+    BOOST_CHECK(CompressPolicy::decodeDictionaryIDs(bytesConstRef()).empty());
+}
+
+BOOST_AUTO_TEST_CASE(test_compressWithDictionary)
+{
+    std::vector<bytes> samples;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        std::string sample = "vote: {view: " + std::to_string(i) +
+                             ", index: " + std::to_string(i * 13) +
+                             ", hash: " + std::to_string(i * 104729) + "}";
+        samples.emplace_back(sample.begin(), sample.end());
+    }
+    auto policy = std::make_shared<CompressPolicy>(1, false);
+    uint16_t moduleID = 1000;
+    auto dictionary =
+        std::make_shared<ZstdDictionary>(ZstdCompress::trainDictionary(samples, 4096));
+    BOOST_CHECK(policy->addDictionary(moduleID, dictionary));
+    BOOST_CHECK(policy->dictionary(moduleID) == dictionary);
+    BOOST_CHECK(policy->dictionaryByID(dictionary->id()) == dictionary);
+
+    auto factory = std::make_shared<P2PMessageFactoryV2>();
+    factory->setCompressPolicy(policy);
+    auto msg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    msg->setVersion(2);
+    msg->setPacketType(GatewayMessageType::PeerToPeerMessage);
+    P2PMessageOptions options;
+    options.setGroupID("group0");
+    options.setSrcNodeID(bytes(64, 'a'));
+    options.mutableDstNodeIDs().push_back(bytes(64, 'b'));
+    options.setModuleID(moduleID);
+    msg->setOptions(options);
+    bytes payload;
+    for (size_t i = 0; i < 40; ++i)
+    {
+        payload.insert(payload.end(), samples.at(i * 23).begin(), samples.at(i * 23).end());
+    }
+    msg->setPayload(payload);
+
+    // the peer has the dictionary
+    EncodedMessage encoded;
+    encoded.compressDictIDs = std::make_shared<const std::set<uint32_t>>(
+        std::set<uint32_t>{dictionary->id()});
+    BOOST_CHECK(msg->encode(encoded));
+    BOOST_CHECK_EQUAL(ZstdCompress::dictionaryID(encoded.payloadRef()), dictionary->id());
+
+    // the peer without the dictionary
+    EncodedMessage plainEncoded;
+    BOOST_CHECK(msg->encode(plainEncoded));
+    BOOST_CHECK_EQUAL(ZstdCompress::dictionaryID(plainEncoded.payloadRef()), 0);
+
+    // the compress flag is set in the header of the encoding only, the message is unchanged
+    auto headerExt = [](EncodedMessage const& _encoded) {
+        uint16_t ext = 0;
+        memcpy(&ext, _encoded.header.data() + 12, sizeof(ext));
+        return boost::asio::detail::socket_ops::network_to_host_short(ext);
+    };
+    EncodedMessage rawEncoded;
+    rawEncoded.compress = false;
+    BOOST_CHECK(msg->encode(rawEncoded));
+    BOOST_CHECK((headerExt(encoded) & bcos::protocol::MessageExtFieldFlag::COMPRESS) != 0);
+    BOOST_CHECK((headerExt(rawEncoded) & bcos::protocol::MessageExtFieldFlag::COMPRESS) == 0);
+    BOOST_CHECK((msg->ext() & bcos::protocol::MessageExtFieldFlag::COMPRESS) == 0);
+
+    bytes buffer(encoded.header.begin(), encoded.header.end());
+    buffer.insert(buffer.end(), encoded.payload->begin(), encoded.payload->end());
+    auto decodeMsg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    BOOST_CHECK_EQUAL(decodeMsg->decode(ref(buffer)), (int32_t)buffer.size());
+    BOOST_CHECK(decodeMsg->payload().toBytes() == payload);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -474,6 +474,46 @@ BOOST_AUTO_TEST_CASE(test_P2PMessage_compress)
     */
 }
 
+BOOST_AUTO_TEST_CASE(test_P2PMessage_sharedEncodedPayload)
+{
+    auto factory = std::make_shared<P2PMessageFactoryV2>();
+    auto msg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    msg->setVersion(2);
+    msg->setSeq(0x12345678);
+    msg->setPacketType(GatewayMessageType::Heartbeat);
+    msg->setPayload(bytes(10000, 'a'));
+
+    // the payload is compressed once and shared by all the encoded messages
+    EncodedMessage encoded1;
+    EncodedMessage encoded2;
+    BOOST_CHECK(msg->encode(encoded1));
+    BOOST_CHECK(msg->encode(encoded2));
+    BOOST_CHECK(encoded1.payload);
+    BOOST_CHECK_EQUAL(encoded1.payload.get(), encoded2.payload.get());
+    BOOST_CHECK_LT(encoded1.payloadSize(), msg->payload().size());
+    BOOST_CHECK(encoded1.header == encoded2.header);
+
+    bytes buffer(encoded1.header.begin(), encoded1.header.end());
+    buffer.insert(buffer.end(), encoded1.payload->begin(), encoded1.payload->end());
+    auto decodeMsg = std::static_pointer_cast<P2PMessage>(factory->buildMessage());
+    BOOST_CHECK_EQUAL(decodeMsg->decode(bytesConstRef(buffer.data(), buffer.size())),
+        (int32_t)buffer.size());
+    BOOST_CHECK(decodeMsg->payload().toBytes() == msg->payload().toBytes());
+
+    // session without compress shares the raw payload, and the compress flag is cleared
+    EncodedMessage rawEncoded;
+    rawEncoded.compress = false;
+    BOOST_CHECK(msg->encode(rawEncoded));
+    BOOST_CHECK_EQUAL(rawEncoded.payloadSize(), msg->payload().size());
+    BOOST_CHECK_EQUAL((msg->ext() & bcos::protocol::MessageExtFieldFlag::COMPRESS), 0);
+
+    // reset payload should invalidate the shared payload
+    msg->setPayload(bytes(10, 'b'));
+    EncodedMessage encoded3;
+    BOOST_CHECK(msg->encode(encoded3));
+    BOOST_CHECK_EQUAL(encoded3.payloadSize(), 10);
+}
+
 BOOST_AUTO_TEST_CASE(test_P2PMessage_attr)
 {
     auto attr = std::make_shared<GatewayMessageExtAttributes>();
@@ -480,4 +480,126 @@ BOOST_AUTO_TEST_CASE(SessionRecvBufferTest)
     }
 }
 
+BOOST_AUTO_TEST_CASE(SessionSendQueueTest)
+{
+    auto buildPayload = [](size_t _size, uint8_t _tag) {
+        EncodedMessage encodedMessage;
+        encodedMessage.header.assign(1, _tag);
+        encodedMessage.payload = std::make_shared<const bytes>(_size - 1, _tag);
+        return Payload{.m_data = std::move(encodedMessage), .m_callback = {}};
+    };
+    auto tagOf = [](const Payload& _payload) {
+        return std::get<EncodedMessage>(_payload.m_data).header[0];
+    };
+
+    SessionSendQueue queue;
+    BOOST_CHECK(queue.empty());
+    std::vector<Payload> payloads;
+    BOOST_CHECK(!queue.tryPopSome(payloads, 1024 * 1024));
+
+    // 100 blocks of 256K queued before the consensus messages
+    size_t blockSize = 256 * 1024;
+    for (size_t i = 0; i < 100; ++i)
+    {
+        queue.push(buildPayload(blockSize, 4), SendPriority::BlockData);
+    }
+    for (size_t i = 0; i < 10; ++i)
+    {
+        queue.push(buildPayload(512, 1), SendPriority::Consensus);
+    }
+    queue.push(buildPayload(128, 5), SendPriority::AMOP);
+    BOOST_CHECK_EQUAL(queue.size(), 111);
+
+    size_t popped = 0;
+    bool amopSent = false;
+    auto onPopped = [&](std::vector<Payload>& _payloads) {
+        for (auto& payload : _payloads)
+        {
+            amopSent = amopSent || tagOf(payload) == 5;
+        }
+        popped += _payloads.size();
+    };
+
+    // the consensus messages are sent first, and the batch is limited by the size
+    size_t maxSendDataSize = 1024 * 1024;
+    BOOST_CHECK(queue.tryPopSome(payloads, maxSendDataSize));
+    BOOST_CHECK(payloads.size() > 10);
+    for (size_t i = 0; i < 10; ++i)
+    {
+        BOOST_CHECK_EQUAL(tagOf(payloads[i]), 1);
+    }
+    size_t totalSize = 0;
+    for (size_t i = 0; i + 1 < payloads.size(); ++i)
+    {
+        totalSize += payloads[i].size();
+    }
+    BOOST_CHECK(totalSize < maxSendDataSize);
+    onPopped(payloads);
+
+    // the new consensus message is not queued after the remaining blocks
+    queue.push(buildPayload(512, 1), SendPriority::Consensus);
+    payloads.clear();
+    BOOST_CHECK(queue.tryPopSome(payloads, maxSendDataSize));
+    BOOST_CHECK_EQUAL(tagOf(payloads[0]), 1);
+    onPopped(payloads);
+
+    // all the payloads are drained finally, the amop message is not starved
+    payloads.clear();
+    while (queue.tryPopSome(payloads, maxSendDataSize))
+    {
+        onPopped(payloads);
+        payloads.clear();
+    }
+    BOOST_CHECK(amopSent);
+    BOOST_CHECK_EQUAL(popped, 112);
+    BOOST_CHECK(queue.empty());
+
+    // the payload larger than the batch size is still sent
+    queue.push(buildPayload(4 * maxSendDataSize, 5), SendPriority::AMOP);
+    payloads.clear();
+    BOOST_CHECK(queue.tryPopSome(payloads, maxSendDataSize));
+    BOOST_CHECK_EQUAL(payloads.size(), 1);
+    BOOST_CHECK(queue.empty());
+}
+
+BOOST_AUTO_TEST_CASE(coalesceBuffersTest)
+{
+    bytes header1(14, 1);
+    bytes payload1(100, 2);
+    bytes header2(14, 3);
+    bytes payload2(Session::MAX_COALESCE_BUFFER_SIZE, 4);
+    bytes header3(14, 5);
+    bytes payload3(10, 6);
+
+    Session::WriteBuffers buffers;
+    for (auto* data : {&header1, &payload1, &header2, &payload2, &header3, &payload3})
+    {
+        buffers.emplace_back(data->data(), data->size());
+    }
+    buffers.emplace_back(nullptr, 0);
+
+    bytes writeBuffer;
+    Session::WriteBuffers output;
+    Session::coalesceBuffers(buffers, writeBuffer, output);
+    // [header1 payload1 header2] [payload2] [header3 payload3]
+    BOOST_CHECK_EQUAL(output.size(), 3);
+    BOOST_CHECK_EQUAL(output[0].size(), 128);
+    BOOST_CHECK(output[1].data() == payload2.data());
+    BOOST_CHECK_EQUAL(output[2].size(), 24);
+    BOOST_CHECK_EQUAL(writeBuffer.size(), 152);
+
+    bytes expected;
+    for (auto const& buffer : output)
+    {
+        auto const* data = static_cast<const byte*>(buffer.data());
+        expected.insert(expected.end(), data, data + buffer.size());
+    }
+    bytes origin;
+    for (auto* data : {&header1, &payload1, &header2, &payload2, &header3, &payload3})
+    {
+        origin.insert(origin.end(), data->begin(), data->end());
+    }
+    BOOST_CHECK(expected == origin);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
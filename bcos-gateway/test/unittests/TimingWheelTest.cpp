@@ -0,0 +1,95 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief test for the timing wheel of the session requests
+ * @file TimingWheelTest.cpp
+ */
+
+#include <bcos-gateway/libnetwork/TimingWheel.h>
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/test/unit_test.hpp>
+#include <set>
+
+using namespace bcos;
+using namespace bcos::gateway;
+using namespace bcos::test;
+
+BOOST_FIXTURE_TEST_SUITE(TimingWheelTest, TestPromptFixture)
+
+BOOST_AUTO_TEST_CASE(expireNearAndFar)
+{
+    uint64_t now = 1000000;
+    TimingWheel wheel(10, now);
+    // near slots
+    wheel.add(1, now + 5);
+    wheel.add(2, now + 100);
+    // far slots
+    wheel.add(3, now + 10 * 1000);
+    // beyond the far slots, cascaded more than once
+    wheel.add(4, now + 600 * 1000);
+    // expired already
+    wheel.add(5, now - 100);
+    BOOST_CHECK_EQUAL(wheel.size(), 5);
+
+    auto expired = wheel.advance(now);
+    BOOST_CHECK(expired == std::vector<uint32_t>{5});
+
+    expired = wheel.advance(now + 10);
+    BOOST_CHECK(expired == std::vector<uint32_t>{1});
+    // never expire earlier than the timeout
+    expired = wheel.advance(now + 99);
+    BOOST_CHECK(expired.empty());
+    expired = wheel.advance(now + 100);
+    BOOST_CHECK(expired == std::vector<uint32_t>{2});
+
+    expired = wheel.advance(now + 9990);
+    BOOST_CHECK(expired.empty());
+    expired = wheel.advance(now + 10 * 1000);
+    BOOST_CHECK(expired == std::vector<uint32_t>{3});
+
+    expired = wheel.advance(now + 599 * 1000);
+    BOOST_CHECK(expired.empty());
+    BOOST_CHECK_EQUAL(wheel.size(), 1);
+    expired = wheel.advance(now + 601 * 1000);
+    BOOST_CHECK(expired == std::vector<uint32_t>{4});
+    BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(expireInBulk)
+{
+    uint64_t now = 123456;
+    TimingWheel wheel(10, now);
+    std::set<uint32_t> seqs;
+    for (uint32_t seq = 0; seq < 10000; ++seq)
+    {
+        wheel.add(seq, now + (seq % 5000) * 7);
+        seqs.insert(seq);
+    }
+
+    for (uint64_t time = now; time <= now + 5000 * 7 + 100; time += 33)
+    {
+        for (auto seq : wheel.advance(time))
+        {
+            // expired in time
+            BOOST_CHECK(now + (seq % 5000) * 7 <= time);
+            BOOST_CHECK(now + (seq % 5000) * 7 + 10 + 33 > time);
+            BOOST_CHECK_EQUAL(seqs.erase(seq), 1);
+        }
+    }
+    BOOST_CHECK(seqs.empty());
+    BOOST_CHECK_EQUAL(wheel.size(), 0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -74,6 +74,10 @@ std::shared_ptr<bcos::boostssl::ws::WsConfig> RpcFactory::initConfig(
     wsConfig->setListenPort(_nodeConfig->rpcListenPort());
     wsConfig->setThreadPoolSize(_nodeConfig->rpcThreadPoolSize());
     wsConfig->setDisableSsl(_nodeConfig->rpcDisableSsl());
+    wsConfig->setMaxWriteQueueSize(_nodeConfig->rpcWriteQueueSize());
+    wsConfig->setWriteQueuePolicy(_nodeConfig->rpcWriteQueueOverflowDisconnect() ?
+                                      boostssl::ws::WsWriteQueuePolicy::Disconnect :
+                                      boostssl::ws::WsWriteQueuePolicy::DropMessage);
     if (_nodeConfig->rpcDisableSsl())
     {
         RPC_LOG(INFO) << LOG_BADGE("initConfig") << LOG_DESC("rpc work in disable ssl model")
@@ -331,6 +335,10 @@ std::shared_ptr<bcos::boostssl::ws::WsConfig> RpcFactory::initWeb3RpcServiceConf
     wsConfig->setListenPort(_nodeConfig->web3RpcListenPort());
     wsConfig->setThreadPoolSize(_nodeConfig->web3RpcThreadSize());
     wsConfig->setDisableSsl(true);
+    wsConfig->setMaxWriteQueueSize(_nodeConfig->rpcWriteQueueSize());
+    wsConfig->setWriteQueuePolicy(_nodeConfig->rpcWriteQueueOverflowDisconnect() ?
+                                      boostssl::ws::WsWriteQueuePolicy::Disconnect :
+                                      boostssl::ws::WsWriteQueuePolicy::DropMessage);
     RPC_LOG(INFO) << LOG_BADGE("initWeb3RpcServiceConfig")
                   << LOG_KV("listenIP", wsConfig->listenIP())
                   << LOG_KV("listenPort", wsConfig->listenPort())
@@ -358,9 +366,22 @@ bcos::rpc::JsonRpcImpl_2_0::Ptr RpcFactory::buildJsonRpc(int sendTxTimeout,
     auto filterSystem =
         std::make_shared<JsonRpcFilterSystem>(_groupManager, m_nodeConfig->groupId(),
             m_nodeConfig->rpcFilterTimeout(), m_nodeConfig->rpcMaxProcessBlock());
+    if (m_nodeConfig->rpcFilterIndexSections() > 0)
+    {
+        filterSystem->setLogIndex(std::make_shared<LogIndex>(
+            m_nodeConfig->rpcFilterIndexSections(), m_nodeConfig->rpcFilterInvertedIndex()));
+    }
     auto jsonRpcInterface = std::make_shared<bcos::rpc::JsonRpcImpl_2_0>(
         _groupManager, m_gateway, _wsService, filterSystem);
     jsonRpcInterface->setSendTxTimeout(sendTxTimeout);
+    jsonRpcInterface->setBatchConfig({.maxSize = m_nodeConfig->rpcBatchMaxSize(),
+        .maxConcurrency = m_nodeConfig->rpcBatchMaxConcurrency(),
+        .timeout = m_nodeConfig->rpcBatchTimeout()});
+    if (m_nodeConfig->rpcResponseCacheSize() > 0)
+    {
+        jsonRpcInterface->setResponseCache(
+            std::make_shared<ResponseCache>(m_nodeConfig->rpcResponseCacheSize()));
+    }
     auto httpServer = _wsService->httpServer();
     if (httpServer)
     {
@@ -376,8 +397,16 @@ bcos::rpc::Web3JsonRpcImpl::Ptr RpcFactory::buildWeb3JsonRpc(
     auto web3FilterSystem =
         std::make_shared<Web3FilterSystem>(_groupManager, m_nodeConfig->groupId(),
             m_nodeConfig->web3FilterTimeout(), m_nodeConfig->web3MaxProcessBlock());
+    if (m_nodeConfig->web3FilterIndexSections() > 0)
+    {
+        web3FilterSystem->setLogIndex(std::make_shared<LogIndex>(
+            m_nodeConfig->web3FilterIndexSections(), m_nodeConfig->web3FilterInvertedIndex()));
+    }
     auto web3JsonRpc = std::make_shared<Web3JsonRpcImpl>(
         m_nodeConfig->groupId(), std::move(_groupManager), m_gateway, _wsService, web3FilterSystem);
+    web3JsonRpc->setBatchConfig({.maxSize = m_nodeConfig->web3BatchMaxSize(),
+        .maxConcurrency = m_nodeConfig->web3BatchMaxConcurrency(),
+        .timeout = m_nodeConfig->web3BatchTimeout()});
     auto httpServer = _wsService->httpServer();
     if (httpServer)
     {
@@ -432,6 +461,8 @@ Rpc::Ptr RpcFactory::buildLocalRpc(
         auto web3WsService = buildWsService(std::move(web3Config));
         auto web3JsonRpc =
             buildWeb3JsonRpc(m_nodeConfig->sendTxTimeout(), web3WsService, groupManager);
+        // the cache is invalidated by the block number notified to the rpc
+        web3JsonRpc->setResponseCache(rpc->jsonRpcImpl()->responseCache());
         rpc->setWeb3Service(std::move(web3WsService));
         rpc->setWeb3JsonRpcImpl(std::move(web3JsonRpc));
     }
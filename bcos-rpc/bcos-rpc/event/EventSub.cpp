@@ -36,7 +36,9 @@ using namespace bcos;
 using namespace bcos::event;
 
 EventSub::EventSub(std::shared_ptr<boostssl::ws::WsService> _wsService)
-  : bcos::Worker("t_event_sub"), m_wsService(_wsService)
+  : bcos::Worker("t_event_sub"),
+    m_blockCache(std::make_shared<EventSubBlockCache>()),
+    m_wsService(_wsService)
 {
     m_wsService->registerMsgHandler(bcos::protocol::MessageType::EVENT_SUBSCRIBE,
         boost::bind(&EventSub::onRecvSubscribeEvent, this, boost::placeholders::_1,
@@ -240,17 +242,52 @@ void EventSub::subscribeEventSub(EventSubTask::Ptr _task)
 {
     EVENT_SUB(INFO) << LOG_BADGE("subscribeEventSub") << LOG_KV("id", _task->id())
                     << LOG_KV("startBlk", _task->state()->currentBlockNumber());
-    std::unique_lock lock(x_addTasks);
-    m_addTasks.push_back(_task);
-    m_addTaskCount++;
+    {
+        std::unique_lock lock(x_addTasks);
+        m_addTasks.push_back(_task);
+        m_addTaskCount++;
+    }
+    notifyWorker();
 }
 
 void EventSub::unsubscribeEventSub(const std::string& _id)
 {
     EVENT_SUB(INFO) << LOG_BADGE("unsubscribeEventSub") << LOG_KV("id", _id);
-    std::unique_lock lock(x_cancelTasks);
-    m_cancelTasks.push_back(_id);
-    m_cancelTaskCount++;
+    {
+        std::unique_lock lock(x_cancelTasks);
+        m_cancelTasks.push_back(_id);
+        m_cancelTaskCount++;
+    }
+    notifyWorker();
+}
+
+void EventSub::notifyWorker()
+{
+    {
+        std::lock_guard lock(x_signal);
+        m_notified = true;
+    }
+    m_signal.notify_one();
+}
+
+void EventSub::onNewBlock(const std::string& _group, bcos::protocol::BlockNumber _blockNumber)
+{
+    // the tasks following the chain head find the block loaded, no task loads it again
+    if (m_taskCount.load() > 0 && m_groupManager)
+    {
+        auto nodeService = m_groupManager->getNodeService(_group, "");
+        if (nodeService)
+        {
+            m_blockCache->asyncGetBlockLogs(_group, nodeService->ledger(), _blockNumber,
+                [self = weak_from_this()](Error::Ptr, EventBlockLogs::ConstPtr) {
+                    if (auto eventSub = self.lock())
+                    {
+                        eventSub->notifyWorker();
+                    }
+                });
+        }
+    }
+    notifyWorker();
 }
 
 void EventSub::executeWorker()
@@ -306,6 +343,7 @@ void EventSub::executeAddTasks()
     }
     m_addTaskCount.store(0);
     m_addTasks.clear();
+    m_taskCount.store(m_tasks.size());
 
     auto taskCount = m_tasks.size();
     EVENT_SUB(INFO) << LOG_BADGE("executeAddTasks") << LOG_DESC("event subscribe tasks ")
@@ -335,6 +373,7 @@ void EventSub::executeCancelTasks()
     }
     m_cancelTaskCount.store(0);
     m_cancelTasks.clear();
+    m_taskCount.store(m_tasks.size());
 
     auto taskCount = m_tasks.size();
     EVENT_SUB(INFO) << LOG_BADGE("executeCancelTasks") << LOG_DESC("event subscribe tasks ")
@@ -403,6 +442,8 @@ int64_t EventSub::executeEventSubTask(EventSubTask::Ptr _task, int64_t _blockNum
             if (_blockNumber > m_endBlockNumber)
             {  // all block has been proccessed
                 m_task->freeWork();
+                // continue with the next batch
+                m_eventSub->notifyWorker();
                 return;
             }
 
@@ -490,7 +531,6 @@ int64_t EventSub::executeEventSubTask(EventSubTask::Ptr _task)
 void EventSub::processNextBlock(
     int64_t _blockNumber, EventSubTask::Ptr _task, std::function<void(Error::Ptr _error)> _callback)
 {
-    auto self = std::weak_ptr<EventSub>(shared_from_this());
     auto matcher = m_matcher;
 
     std::string group = _task->group();
@@ -506,16 +546,14 @@ void EventSub::processNextBlock(
         return;
     }
 
-    auto ledger = nodeService->ledger();
-    ledger->asyncGetBlockDataByNumber(_blockNumber,
-        bcos::ledger::RECEIPTS | bcos::ledger::TRANSACTIONS,
-        [matcher, _task, _blockNumber, _callback, self](
-            Error::Ptr _error, protocol::Block::Ptr _block) {
+    // the tasks processing the same block share one load of the block
+    m_blockCache->asyncGetBlockLogs(group, nodeService->ledger(), _blockNumber,
+        [matcher, _task, _blockNumber, _callback](
+            Error::Ptr _error, EventBlockLogs::ConstPtr _blockLogs) {
             if (_error && _error->errorCode() != bcos::protocol::CommonError::SUCCESS)
             {
                 // Note: wait for next time
-                EVENT_SUB(ERROR) << LOG_BADGE("processNextBlock")
-                                 << LOG_DESC("asyncGetBlockDataByNumber")
+                EVENT_SUB(ERROR) << LOG_BADGE("processNextBlock") << LOG_DESC("asyncGetBlockLogs")
                                  << LOG_KV("id", _task->id()) << LOG_KV("blockNumber", _blockNumber)
                                  << LOG_KV("code", _error->errorCode())
                                  << LOG_KV("message", _error->errorMessage());
@@ -524,11 +562,10 @@ void EventSub::processNextBlock(
             }
 
             Json::Value jResp(Json::arrayValue);
-            auto count = matcher->matches(_task->params(), _block, jResp);
+            auto count = matcher->matches(_task->params(), *_blockLogs, jResp);
             if (count)
             {
-                EVENT_SUB(TRACE) << LOG_BADGE("processNextBlock")
-                                 << LOG_DESC("asyncGetBlockDataByNumber")
+                EVENT_SUB(TRACE) << LOG_BADGE("processNextBlock") << LOG_DESC("asyncGetBlockLogs")
                                  << LOG_KV("blockNumber", _blockNumber) << LOG_KV("id", _task->id())
                                  << LOG_KV("count", count);
 
@@ -546,6 +583,9 @@ void EventSub::executeEventSubTasks()
         executeEventSubTask(task.second);
     }
 
-    // limiting speed
-    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    // limiting speed, wait until there is something to do
+    std::unique_lock lock(x_signal);
+    m_signal.wait_for(
+        lock, std::chrono::milliseconds(MAX_WAIT_MS), [this]() { return m_notified; });
+    m_notified = false;
 }
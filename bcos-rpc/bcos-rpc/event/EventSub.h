@@ -22,10 +22,12 @@
 
 #include <bcos-framework/ledger/LedgerInterface.h>
 #include <bcos-framework/protocol/ProtocolTypeDef.h>
+#include <bcos-rpc/event/EventSubBlockCache.h>
 #include <bcos-rpc/event/EventSubTask.h>
 #include <bcos-rpc/groupmgr/GroupManager.h>
 #include <bcos-utilities/Worker.h>
 #include <atomic>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <shared_mutex>
@@ -52,6 +54,8 @@ class EventSub : bcos::Worker, public std::enable_shared_from_this<EventSub>
 public:
     using Ptr = std::shared_ptr<EventSub>;
     using ConstPtr = std::shared_ptr<const EventSub>;
+    /// the max interval of checking the connection of the tasks
+    constexpr static int64_t MAX_WAIT_MS = 10;
     EventSub(std::shared_ptr<boostssl::ws::WsService> _wsService);
     virtual ~EventSub() { stop(); }
 
@@ -61,6 +65,10 @@ public:
 
     void executeWorker() override;
 
+    // the new block is committed: load its logs once for all the tasks and wake up the worker
+    void onNewBlock(const std::string& _group, bcos::protocol::BlockNumber _blockNumber);
+    void notifyWorker();
+
 public:
     virtual void onRecvSubscribeEvent(std::shared_ptr<bcos::boostssl::MessageFace> _msg,
         std::shared_ptr<bcos::boostssl::ws::WsSession> _session);
@@ -118,6 +126,8 @@ public:
         m_maxBlockProcessPerLoop = _maxBlockProcessPerLoop;
     }
 
+    EventSubBlockCache::Ptr blockCache() const { return m_blockCache; }
+
     bcos::rpc::GroupManager::Ptr groupManager() { return m_groupManager; }
     void setGroupManager(bcos::rpc::GroupManager::Ptr _groupManager)
     {
@@ -140,6 +150,8 @@ private:
     std::shared_ptr<EventSubMatcher> m_matcher;
     // message factory
     std::shared_ptr<bcos::boostssl::MessageFaceFactory> m_messageFactory;
+    // the block logs shared by the tasks
+    EventSubBlockCache::Ptr m_blockCache;
 
 private:
     std::shared_ptr<boostssl::ws::WsService> m_wsService;
@@ -162,6 +174,13 @@ private:
 
     // all subscribe event tasks
     std::unordered_map<std::string, EventSubTask::Ptr> m_tasks;
+    // the size of m_tasks, read by the other threads
+    std::atomic<size_t> m_taskCount{0};
+
+    // the worker waits for the new block, the task changes or the finished batch of the tasks
+    std::mutex x_signal;
+    std::condition_variable m_signal;
+    bool m_notified = false;
 
     //
     int64_t m_maxBlockProcessPerLoop = 10;
@@ -0,0 +1,145 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file EventSubBlockCache.cpp
+ */
+
+#include <bcos-framework/protocol/CommonError.h>
+#include <bcos-rpc/event/EventSubBlockCache.h>
+#include <bcos-utilities/BoostLog.h>
+#include <bcos-utilities/DataConvertUtility.h>
+
+using namespace bcos;
+using namespace bcos::event;
+
+EventBlockLogs::EventBlockLogs(protocol::BlockNumber _number, protocol::Block const& _block)
+  : m_number(_number)
+{
+    for (std::size_t txIndex = 0; txIndex < _block.transactionsSize(); txIndex++)
+    {
+        auto receipt = _block.receipt(txIndex);
+        auto txHash = _block.transaction(txIndex)->hash().hexPrefixed();
+        std::size_t logIndex = 0;
+        for (const auto& logEntry : receipt->logEntries())
+        {
+            Json::Value jResp;
+            jResp["blockNumber"] = receipt->blockNumber();
+            jResp["address"] = std::string(logEntry.address());
+            jResp["data"] = toHexStringWithPrefix(logEntry.data());
+            jResp["logIndex"] = (uint64_t)logIndex;
+            jResp["transactionHash"] = txHash;
+            jResp["transactionIndex"] = (uint64_t)txIndex;
+            jResp["topics"] = Json::Value(Json::arrayValue);
+            for (const auto& topic : logEntry.topics())
+            {
+                jResp["topics"].append(topic.hexPrefixed());
+            }
+
+            m_addressLogs[std::string(logEntry.address())].push_back((uint32_t)m_logs.size());
+            if (!logEntry.topics().empty())
+            {
+                m_topicLogs[logEntry.topics()[0].hex()].push_back((uint32_t)m_logs.size());
+            }
+            m_logs.push_back(EventLog{.logEntry = logEntry, .result = std::move(jResp)});
+            logIndex += 1;
+        }
+    }
+}
+
+void EventSubBlockCache::asyncGetBlockLogs(const std::string& _group,
+    bcos::ledger::LedgerInterface::Ptr _ledger, protocol::BlockNumber _number, Callback _callback)
+{
+    auto key = Key(_group, _number);
+    {
+        std::unique_lock lock(x_blocks);
+        auto it = m_blocks.find(key);
+        if (it != m_blocks.end())
+        {
+            auto blockLogs = it->second;
+            lock.unlock();
+            _callback(nullptr, std::move(blockLogs));
+            return;
+        }
+        auto [pending, first] = m_pending.try_emplace(key);
+        pending->second.emplace_back(std::move(_callback));
+        if (!first)
+        {
+            // the block is being loaded by the other task
+            return;
+        }
+    }
+
+    _ledger->asyncGetBlockDataByNumber(_number,
+        bcos::ledger::RECEIPTS | bcos::ledger::TRANSACTIONS,
+        [self = weak_from_this(), key](Error::Ptr _error, protocol::Block::Ptr _block) {
+            if (auto cache = self.lock())
+            {
+                cache->onBlockLoaded(key, std::move(_error), std::move(_block));
+            }
+        });
+}
+
+void EventSubBlockCache::onBlockLoaded(
+    const Key& _key, Error::Ptr _error, protocol::Block::Ptr _block)
+{
+    EventBlockLogs::ConstPtr blockLogs;
+    if ((!_error || _error->errorCode() == bcos::protocol::CommonError::SUCCESS) && !_block)
+    {
+        _error = BCOS_ERROR_PTR(-1, "block not found");
+    }
+    if (!_error || _error->errorCode() == bcos::protocol::CommonError::SUCCESS)
+    {
+        try
+        {
+            blockLogs = std::make_shared<EventBlockLogs>(_key.second, *_block);
+        }
+        catch (std::exception const& e)
+        {
+            EVENT_SUB(WARNING) << LOG_BADGE("onBlockLoaded") << LOG_DESC("decode block failed")
+                               << LOG_KV("group", _key.first) << LOG_KV("blockNumber", _key.second)
+                               << LOG_KV("msg", boost::diagnostic_information(e));
+            _error = BCOS_ERROR_PTR(-1, "decode block failed");
+        }
+    }
+
+    std::vector<Callback> callbacks;
+    {
+        std::lock_guard lock(x_blocks);
+        auto it = m_pending.find(_key);
+        if (it != m_pending.end())
+        {
+            callbacks.swap(it->second);
+            m_pending.erase(it);
+        }
+        // only the loaded block is cached, the failed one is loaded again by the next request
+        if (blockLogs && m_blocks.emplace(_key, blockLogs).second)
+        {
+            m_loadedOrder.push_back(_key);
+            while (m_loadedOrder.size() > m_capacity)
+            {
+                m_blocks.erase(m_loadedOrder.front());
+                m_loadedOrder.pop_front();
+            }
+        }
+    }
+
+    EVENT_SUB(TRACE) << LOG_BADGE("onBlockLoaded") << LOG_KV("group", _key.first)
+                     << LOG_KV("blockNumber", _key.second) << LOG_KV("waiting", callbacks.size())
+                     << LOG_KV("logs", blockLogs ? blockLogs->logs().size() : 0);
+    for (auto& callback : callbacks)
+    {
+        callback(_error, blockLogs);
+    }
+}
@@ -0,0 +1,121 @@
+/*
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the logs of the recent blocks decoded once and shared by all the event sub tasks
+ * @file EventSubBlockCache.h
+ */
+#pragma once
+#include <bcos-framework/ledger/LedgerInterface.h>
+#include <bcos-framework/protocol/Block.h>
+#include <bcos-framework/protocol/LogEntry.h>
+#include <bcos-framework/protocol/ProtocolTypeDef.h>
+#include <bcos-rpc/event/Common.h>
+#include <json/json.h>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bcos
+{
+namespace event
+{
+struct EventLog
+{
+    bcos::protocol::LogEntry logEntry;
+    // the json pushed to the client
+    Json::Value result;
+};
+
+class EventBlockLogs
+{
+public:
+    using Ptr = std::shared_ptr<EventBlockLogs>;
+    using ConstPtr = std::shared_ptr<const EventBlockLogs>;
+
+    // the block must be loaded with the receipts and the transactions
+    EventBlockLogs(bcos::protocol::BlockNumber _number, bcos::protocol::Block const& _block);
+
+    bcos::protocol::BlockNumber number() const { return m_number; }
+    const std::vector<EventLog>& logs() const { return m_logs; }
+    // the indexes of the logs emitted by the address in order, nullptr if none
+    const std::vector<uint32_t>* addressLogs(const std::string& _address) const
+    {
+        auto it = m_addressLogs.find(_address);
+        return it == m_addressLogs.end() ? nullptr : &it->second;
+    }
+    // the indexes of the logs with the first topic in order, nullptr if none
+    const std::vector<uint32_t>* topicLogs(const std::string& _topic) const
+    {
+        auto it = m_topicLogs.find(_topic);
+        return it == m_topicLogs.end() ? nullptr : &it->second;
+    }
+
+private:
+    bcos::protocol::BlockNumber m_number;
+    std::vector<EventLog> m_logs;
+    std::unordered_map<std::string, std::vector<uint32_t>> m_addressLogs;
+    // keyed by the hex of the first topic without prefix, as the topics of the params
+    std::unordered_map<std::string, std::vector<uint32_t>> m_topicLogs;
+};
+
+class EventSubBlockCache : public std::enable_shared_from_this<EventSubBlockCache>
+{
+public:
+    using Ptr = std::shared_ptr<EventSubBlockCache>;
+    using Callback = std::function<void(Error::Ptr, EventBlockLogs::ConstPtr)>;
+
+    // the tasks following the chain head or catching up the same range share the recent blocks
+    constexpr static size_t DEFAULT_CAPACITY = 256;
+
+    explicit EventSubBlockCache(size_t _capacity = DEFAULT_CAPACITY)
+      : m_capacity(std::max<size_t>(_capacity, 1))
+    {}
+    virtual ~EventSubBlockCache() = default;
+
+    /**
+     * @brief: get the logs of the block, the block is loaded once for the concurrent requests
+     * @param _group: the group of the block
+     * @param _ledger: the ledger to load the block when not cached
+     * @param _number: the block number
+     * @param _callback: called with the shared logs of the block or the load error
+     */
+    void asyncGetBlockLogs(const std::string& _group, bcos::ledger::LedgerInterface::Ptr _ledger,
+        bcos::protocol::BlockNumber _number, Callback _callback);
+
+    size_t size() const
+    {
+        std::lock_guard lock(x_blocks);
+        return m_blocks.size();
+    }
+
+private:
+    using Key = std::pair<std::string, bcos::protocol::BlockNumber>;
+    void onBlockLoaded(const Key& _key, Error::Ptr _error, bcos::protocol::Block::Ptr _block);
+
+    size_t m_capacity;
+    mutable std::mutex x_blocks;
+    std::map<Key, EventBlockLogs::ConstPtr> m_blocks;
+    // the loaded order of the cached blocks, the earliest is evicted first
+    std::deque<Key> m_loadedOrder;
+    // the callbacks waiting for the blocks being loaded
+    std::map<Key, std::vector<Callback>> m_pending;
+};
+}  // namespace event
+}  // namespace bcos
@@ -21,6 +21,8 @@
 #include <bcos-rpc/event/Common.h>
 #include <bcos-rpc/event/EventSubMatcher.h>
 #include <bcos-utilities/BoostLog.h>
+#include <algorithm>
+#include <optional>
 
 using namespace bcos;
 using namespace bcos::event;
@@ -72,6 +74,67 @@ uint32_t EventSubMatcher::matches(EventSubParams::ConstPtr _params,
     return count;
 }
 
+uint32_t EventSubMatcher::matches(
+    EventSubParams::ConstPtr _params, const EventBlockLogs& _blockLogs, Json::Value& _result)
+{
+    uint32_t count = 0;
+    const auto& logs = _blockLogs.logs();
+    auto matchLog = [&](uint32_t _index) {
+        if (matches(_params, logs[_index].logEntry))
+        {
+            count++;
+            _result.append(logs[_index].result);
+        }
+    };
+
+    // route by the subscribed addresses or the first topics, whichever has fewer logs, every log
+    // has one address and at most one first topic so the routed indexes have no duplicates
+    auto route = [](const std::set<std::string>& _keys, auto&& _getLogs) {
+        std::vector<uint32_t> indexes;
+        for (const auto& key : _keys)
+        {
+            if (const auto* keyLogs = _getLogs(key))
+            {
+                indexes.insert(indexes.end(), keyLogs->begin(), keyLogs->end());
+            }
+        }
+        return indexes;
+    };
+    std::optional<std::vector<uint32_t>> indexes;
+    if (!_params->addresses().empty())
+    {
+        indexes = route(_params->addresses(),
+            [&](const std::string& _address) { return _blockLogs.addressLogs(_address); });
+    }
+    const auto& topics = _params->topics();
+    if (!topics.empty() && !topics[0].empty())
+    {
+        auto topicIndexes = route(
+            topics[0], [&](const std::string& _topic) { return _blockLogs.topicLogs(_topic); });
+        if (!indexes || topicIndexes.size() < indexes->size())
+        {
+            indexes = std::move(topicIndexes);
+        }
+    }
+
+    if (!indexes)
+    {
+        for (uint32_t index = 0; index < logs.size(); index++)
+        {
+            matchLog(index);
+        }
+        return count;
+    }
+
+    // push the logs in the order of the block
+    std::sort(indexes->begin(), indexes->end());
+    for (auto index : *indexes)
+    {
+        matchLog(index);
+    }
+    return count;
+}
+
 bool EventSubMatcher::matches(
     EventSubParams::ConstPtr _params, const bcos::protocol::LogEntry& _logEntry)
 {
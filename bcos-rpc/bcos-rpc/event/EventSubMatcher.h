@@ -22,6 +22,7 @@
 #include <bcos-framework/protocol/LogEntry.h>
 #include <bcos-framework/protocol/ProtocolTypeDef.h>
 #include <bcos-framework/protocol/TransactionReceipt.h>
+#include <bcos-rpc/event/EventSubBlockCache.h>
 #include <bcos-rpc/event/EventSubParams.h>
 #include <json/json.h>
 
@@ -47,6 +48,10 @@ public:
         bcos::protocol::Transaction::ConstPtr _tx, std::size_t _txIndex, Json::Value& _result);
     uint32_t matches(EventSubParams::ConstPtr _params, bcos::protocol::Block::ConstPtr _block,
         Json::Value& _result);
+    // match the shared logs of the block, only the logs routed by the addresses or the first
+    // topics of the params are checked
+    uint32_t matches(EventSubParams::ConstPtr _params, const EventBlockLogs& _blockLogs,
+        Json::Value& _result);
 };
 
 }  // namespace event
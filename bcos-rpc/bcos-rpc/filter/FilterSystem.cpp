@@ -130,7 +130,8 @@ task::Task<std::string> FilterSystem::newFilter(std::string_view groupId, Filter
     co_return toQuantity(id);
 }
 
-task::Task<Json::Value> FilterSystem::getFilterChangeImpl(std::string_view groupId, u256 filterID)
+task::Task<void> FilterSystem::getFilterChangeImpl(
+    std::string_view groupId, u256 filterID, JsonWriter& writer)
 {
     auto filter = getFilterByID(groupId, filterID);
     if (filter == nullptr)
@@ -143,32 +144,31 @@ task::Task<Json::Value> FilterSystem::getFilterChangeImpl(std::string_view group
     FILTER_LOG(TRACE) << LOG_BADGE("getFilterChangeImpl") << LOG_KV("id", filterID)
                       << LOG_KV("subType", filter->type());
 
-    Json::Value jValue(Json::arrayValue);
     switch (filter->type())
     {
     case PendingTransactionsSubscription:
     {
-        jValue = co_await getPendingTxChangeImpl(groupId, filter);
+        co_await getPendingTxChangeImpl(groupId, filter, writer);
         break;
     }
     case LogsSubscription:
     {
-        jValue = co_await getLogChangeImpl(groupId, filter);
+        co_await getLogChangeImpl(groupId, filter, writer);
         break;
     }
     case BlocksSubscription:
     {
-        jValue = co_await getBlockChangeImpl(groupId, filter);
+        co_await getBlockChangeImpl(groupId, filter, writer);
         break;
     }
     default:
+        writer.startArray().endArray();
         break;
     }
-    co_return jValue;
 }
 
-task::Task<Json::Value> FilterSystem::getBlockChangeImpl(
-    std::string_view groupId, Filter::Ptr filter)
+task::Task<void> FilterSystem::getBlockChangeImpl(
+    std::string_view groupId, Filter::Ptr filter, JsonWriter& writer)
 {
     // getLatestBlockNumber and getBlockHash use the same ledger
     auto ledger = getNodeService(groupId, "getBlockChangeImpl")->ledger();
@@ -177,7 +177,8 @@ task::Task<Json::Value> FilterSystem::getBlockChangeImpl(
 
     if (latestBlockNumber < startBlockNumber)
     {  // Since the last query, no new blocks have been generated
-        co_return Json::Value(Json::arrayValue);
+        writer.startArray().endArray();
+        co_return;
     }
     // limit the number of blocks processed
     auto processBlockNum =
@@ -189,17 +190,17 @@ task::Task<Json::Value> FilterSystem::getBlockChangeImpl(
                       << LOG_KV("startBlockNumber", startBlockNumber)
                       << LOG_KV("processBlockNum", processBlockNum)
                       << LOG_KV("nextStartBlockNumber", startBlockNumber + processBlockNum);
-    Json::Value jResult(Json::arrayValue);
+    writer.startArray();
     for (auto i = 0; i < processBlockNum; ++i)
     {
         auto hash = co_await ledger::getBlockHash(*ledger, startBlockNumber + i);
-        jResult.append(hash.hexPrefixed());
+        writer.hexValue(hash.ref());
     }
-    co_return jResult;
+    writer.endArray();
 }
 
-task::Task<Json::Value> FilterSystem::getPendingTxChangeImpl(
-    std::string_view groupId, Filter::Ptr filter)
+task::Task<void> FilterSystem::getPendingTxChangeImpl(
+    std::string_view groupId, Filter::Ptr filter, JsonWriter& writer)
 {
     // getLatestBlockNumber and getBlockData use the same ledger
     auto ledger = getNodeService(groupId, "getPendingTxChangeImpl")->ledger();
@@ -207,7 +208,8 @@ task::Task<Json::Value> FilterSystem::getPendingTxChangeImpl(
     auto startBlockNumber = filter->startBlockNumber();
     if (latestBlockNumber < startBlockNumber)
     {  // Since the last query, no new blocks have been generated
-        co_return Json::Value(Json::arrayValue);
+        writer.startArray().endArray();
+        co_return;
     }
     // limit the number of blocks processed
     auto processBlockNum =
@@ -220,20 +222,21 @@ task::Task<Json::Value> FilterSystem::getPendingTxChangeImpl(
                       << LOG_KV("processBlockNum", processBlockNum)
                       << LOG_KV("nextStartBlockNumber", startBlockNumber + processBlockNum);
 
-    Json::Value jRes(Json::arrayValue);
+    writer.startArray();
     for (auto i = 0; i < processBlockNum; ++i)
     {
         auto block = co_await ledger::getBlockData(
             *ledger, i + startBlockNumber, bcos::ledger::TRANSACTIONS_HASH);
         for (std::size_t index = 0; index < block->transactionsMetaDataSize(); ++index)
         {
-            jRes.append(block->transactionHash(index).hexPrefixed());
+            writer.hexValue(block->transactionHash(index).ref());
         }
     }
-    co_return jRes;
+    writer.endArray();
 }
 
-task::Task<Json::Value> FilterSystem::getLogChangeImpl(std::string_view groupId, Filter::Ptr filter)
+task::Task<void> FilterSystem::getLogChangeImpl(
+    std::string_view groupId, Filter::Ptr filter, JsonWriter& writer)
 {
     // getLatestBlockNumber and getLogsInternal use the same ledger
     auto ledger = getNodeService(groupId, "getLogsImpl")->ledger();
@@ -268,26 +271,28 @@ task::Task<Json::Value> FilterSystem::getLogChangeImpl(std::string_view groupId,
     auto end = toIsLatest ? latestBlockNumber : std::min(toBlock, latestBlockNumber);
     if (end < begin)
     {
-        co_return Json::Value(Json::arrayValue);
+        writer.startArray().endArray();
+        co_return;
     }
 
     auto params = m_factory->create(*(filter->params()));
-    // limit the number of blocks processed
-    auto processBlockNum = std::min(end - begin + 1, m_maxBlockProcessPerReq);
     params->setFromBlock(begin);
-    params->setToBlock(begin + processBlockNum - 1);
-    filter->setStartBlockNumber(begin + processBlockNum);
+    params->setToBlock(end);
+    // the number of blocks loaded is limited, the range is shrunk to the blocks processed
+    writer.startArray();
+    co_await getLogsInternal(*ledger, params, writer);
+    writer.endArray();
+    filter->setStartBlockNumber(params->toBlock() + 1);
     FILTER_LOG(DEBUG) << LOG_BADGE("getLogChangeImpl") << LOG_KV("id", filter->id())
                       << LOG_KV("latestBlockNumber", latestBlockNumber)
                       << LOG_KV("startBlockNumber", startBlockNumber)
-                      << LOG_KV("processBlockNum", processBlockNum)
-                      << LOG_KV("nextStartBlockNumber", begin + processBlockNum)
+                      << LOG_KV("nextStartBlockNumber", params->toBlock() + 1)
                       << LOG_KV("begin", begin) << LOG_KV("end", end) << LOG_KV("from", begin)
-                      << LOG_KV("to", begin + processBlockNum - 1);
-    co_return co_await getLogsInternal(*ledger, std::move(params));
+                      << LOG_KV("to", params->toBlock());
 }
 
-task::Task<Json::Value> FilterSystem::getFilterLogsImpl(std::string_view groupId, u256 filterID)
+task::Task<void> FilterSystem::getFilterLogsImpl(
+    std::string_view groupId, u256 filterID, JsonWriter& writer)
 {
     auto filter = getFilterByID(groupId, filterID);
     if (filter == nullptr || filter->type() != LogsSubscription)
@@ -297,11 +302,11 @@ task::Task<Json::Value> FilterSystem::getFilterLogsImpl(std::string_view groupId
         BOOST_THROW_EXCEPTION(JsonRpcException(InvalidParamsCode(), "filter not found"));
     }
     auto params = m_factory->create(*(filter->params()));
-    co_return co_await getLogsImpl(groupId, params, false);
+    co_await getLogsImpl(groupId, params, false, writer);
 }
 
-task::Task<Json::Value> FilterSystem::getLogsImpl(
-    std::string_view groupId, FilterRequest::Ptr params, bool needCheckRange)
+task::Task<void> FilterSystem::getLogsImpl(std::string_view groupId, FilterRequest::Ptr params,
+    bool needCheckRange, JsonWriter& writer)
 {
     // getLatestBlockNumber and getLogsInPool use the same ledger
     auto ledger = getNodeService(groupId, "getLogsImpl")->ledger();
@@ -320,9 +325,9 @@ task::Task<Json::Value> FilterSystem::getLogsImpl(
         }
         auto block = co_await ledger::getBlockData(*ledger, blockNumber,
             bcos::ledger::HEADER | bcos::ledger::RECEIPTS | bcos::ledger::TRANSACTIONS_HASH);
-        Json::Value jArray(Json::arrayValue);
-        matcher->matches(params, block, jArray);
-        co_return jArray;
+        writer.startArray();
+        matcher->matches(params, block, writer);
+        writer.endArray();
     }
     else
     {
@@ -341,31 +346,62 @@ task::Task<Json::Value> FilterSystem::getLogsImpl(
         toBlock = params->toIsLatest() ? latestBlockNumber : std::min(toBlock, latestBlockNumber);
         if (fromBlock > latestBlockNumber)
         {  // the block of interest has not been generated yet
-            co_return Json::Value(Json::arrayValue);
+            writer.startArray().endArray();
+            co_return;
         }
         if (toBlock < fromBlock)
         {
-            co_return Json::Value(Json::arrayValue);
+            writer.startArray().endArray();
+            co_return;
         }
-        auto processBlockNum = std::min(toBlock - fromBlock + 1, m_maxBlockProcessPerReq);
         params->setFromBlock(fromBlock);
-        params->setToBlock(fromBlock + processBlockNum - 1);
-        co_return co_await getLogsInternal(*ledger, std::move(params));
+        params->setToBlock(toBlock);
+        writer.startArray();
+        co_await getLogsInternal(*ledger, std::move(params), writer);
+        writer.endArray();
     }
 }
 
-task::Task<Json::Value> FilterSystem::getLogsInternal(
-    bcos::ledger::LedgerInterface& ledger, FilterRequest::Ptr params)
+task::Task<void> FilterSystem::getLogsInternal(
+    bcos::ledger::LedgerInterface& ledger, FilterRequest::Ptr params, JsonWriter& writer)
 {
     auto fromBlock = params->fromBlock();
     auto toBlock = params->toBlock();
-    Json::Value jArray(Json::arrayValue);
     auto matcher = m_matcher;
-    for (auto number = fromBlock; number <= toBlock; ++number)
+    auto logIndex = m_logIndex;
+    if (!logIndex)
+    {
+        // limit the number of blocks processed
+        toBlock = std::min(toBlock, fromBlock + m_maxBlockProcessPerReq - 1);
+        params->setToBlock(toBlock);
+        for (auto number = fromBlock; number <= toBlock; ++number)
+        {
+            auto block = co_await ledger::getBlockData(ledger, number,
+                bcos::ledger::HEADER | bcos::ledger::RECEIPTS | bcos::ledger::TRANSACTIONS_HASH);
+            matcher->matches(params, block, writer);
+        }
+        co_return;
+    }
+    // only load the blocks not indexed yet or whose bloom may match the params, the limit applies
+    // to the blocks loaded, the blocks skipped by the index are free
+    auto candidates = logIndex->candidates(
+        LogIndex::makeQuery(*params), fromBlock, toBlock, (size_t)m_maxBlockProcessPerReq);
+    if (candidates.size() >= (size_t)m_maxBlockProcessPerReq)
+    {
+        toBlock = candidates.back();
+        params->setToBlock(toBlock);
+    }
+    for (auto number : candidates)
     {
         auto block = co_await ledger::getBlockData(ledger, number,
             bcos::ledger::HEADER | bcos::ledger::RECEIPTS | bcos::ledger::TRANSACTIONS_HASH);
-        matcher->matches(params, block, jArray);
+        // index before matching, the matcher takes the log entries of the receipts
+        if (!logIndex->indexed(number))
+        {
+            logIndex->addBlock(number, *block);
+        }
+        matcher->matches(params, block, writer);
     }
-    co_return jArray;
+    FILTER_LOG(TRACE) << LOG_BADGE("getLogsInternal") << LOG_KV("from", fromBlock)
+                      << LOG_KV("to", toBlock) << LOG_KV("loaded", candidates.size());
 }
\ No newline at end of file
@@ -2,9 +2,11 @@
 #include "bcos-ledger/LedgerMethods.h"
 #include <bcos-framework/protocol/ProtocolTypeDef.h>
 #include <bcos-rpc/filter/Filter.h>
+#include <bcos-rpc/filter/LogIndex.h>
 #include <bcos-rpc/filter/LogMatcher.h>
 #include <bcos-rpc/groupmgr/GroupManager.h>
 #include <bcos-rpc/groupmgr/NodeService.h>
+#include <bcos-rpc/jsonrpc/JsonWriter.h>
 #include <bcos-task/Task.h>
 #include <bcos-task/Wait.h>
 #include <bcos-utilities/BucketMap.h>
@@ -74,17 +76,28 @@ public:
     {
         co_return uninstallFilterImpl(groupId, filterID);
     }
-    task::Task<Json::Value> getFilterChanges(std::string_view groupId, u256 filterID)
+    // the results of the changes and the logs are the serialized json arrays, the logs are written
+    // into the buffer directly without building the json tree
+    task::Task<bcos::bytes> getFilterChanges(std::string_view groupId, u256 filterID)
     {
-        co_return co_await getFilterChangeImpl(groupId, filterID);
+        bcos::bytes result;
+        JsonWriter writer(result);
+        co_await getFilterChangeImpl(groupId, filterID, writer);
+        co_return result;
     }
-    task::Task<Json::Value> getFilterLogs(std::string_view groupId, u256 filterID)
+    task::Task<bcos::bytes> getFilterLogs(std::string_view groupId, u256 filterID)
     {
-        co_return co_await getFilterLogsImpl(groupId, filterID);
+        bcos::bytes result;
+        JsonWriter writer(result);
+        co_await getFilterLogsImpl(groupId, filterID, writer);
+        co_return result;
     }
-    task::Task<Json::Value> getLogs(std::string_view groupId, FilterRequest::Ptr params)
+    task::Task<bcos::bytes> getLogs(std::string_view groupId, FilterRequest::Ptr params)
     {
-        co_return co_await getLogsImpl(groupId, params, true);
+        bcos::bytes result;
+        JsonWriter writer(result);
+        co_await getLogsImpl(groupId, params, true, writer);
+        co_return result;
     }
 
     // web3jsonrpc
@@ -98,15 +111,15 @@ public:
     {
         co_return co_await uninstallFilter(m_group, filterID);
     }
-    task::Task<Json::Value> getFilterChanges(u256 filterID)
+    task::Task<bcos::bytes> getFilterChanges(u256 filterID)
     {
         co_return co_await getFilterChanges(m_group, filterID);
     }
-    task::Task<Json::Value> getFilterLogs(u256 filterID)
+    task::Task<bcos::bytes> getFilterLogs(u256 filterID)
     {
         co_return co_await getFilterLogs(m_group, filterID);
     }
-    task::Task<Json::Value> getLogs(FilterRequest::Ptr params)
+    task::Task<bcos::bytes> getLogs(FilterRequest::Ptr params)
     {
         co_return co_await getLogs(m_group, params);
     }
@@ -121,6 +134,9 @@ public:
 
     FilterRequestFactory::Ptr requestFactory() const { return m_factory; }
     LogMatcher::Ptr matcher() const { return m_matcher; }
+    // nullptr disables the log index
+    void setLogIndex(LogIndex::Ptr _logIndex) { m_logIndex = std::move(_logIndex); }
+    LogIndex::Ptr logIndex() const { return m_logIndex; }
     NodeService::Ptr getNodeService(std::string_view _groupID, std::string_view _command) const;
 
 protected:
@@ -134,15 +150,23 @@ protected:
         }
         return false;
     }
-    task::Task<Json::Value> getFilterChangeImpl(std::string_view groupId, u256 filterID);
-    task::Task<Json::Value> getBlockChangeImpl(std::string_view groupId, Filter::Ptr filter);
-    task::Task<Json::Value> getPendingTxChangeImpl(std::string_view groupId, Filter::Ptr filter);
-    task::Task<Json::Value> getLogChangeImpl(std::string_view groupId, Filter::Ptr filter);
-    task::Task<Json::Value> getFilterLogsImpl(std::string_view groupId, u256 filterID);
-    task::Task<Json::Value> getLogsImpl(
-        std::string_view groupId, FilterRequest::Ptr params, bool needCheckRange);
-    task::Task<Json::Value> getLogsInternal(
-        bcos::ledger::LedgerInterface& ledger, FilterRequest::Ptr params);
+    // the Impl methods write the result array into the writer
+    task::Task<void> getFilterChangeImpl(
+        std::string_view groupId, u256 filterID, JsonWriter& writer);
+    task::Task<void> getBlockChangeImpl(
+        std::string_view groupId, Filter::Ptr filter, JsonWriter& writer);
+    task::Task<void> getPendingTxChangeImpl(
+        std::string_view groupId, Filter::Ptr filter, JsonWriter& writer);
+    task::Task<void> getLogChangeImpl(
+        std::string_view groupId, Filter::Ptr filter, JsonWriter& writer);
+    task::Task<void> getFilterLogsImpl(std::string_view groupId, u256 filterID, JsonWriter& writer);
+    task::Task<void> getLogsImpl(std::string_view groupId, FilterRequest::Ptr params,
+        bool needCheckRange, JsonWriter& writer);
+    // load at most m_maxBlockProcessPerReq blocks from the range of the params, the toBlock of
+    // the params is set to the last block processed, the matched logs are written into the array
+    // opened by the writer
+    task::Task<void> getLogsInternal(
+        bcos::ledger::LedgerInterface& ledger, FilterRequest::Ptr params, JsonWriter& writer);
 
     virtual int32_t InvalidParamsCode() = 0;
     uint64_t insertFilter(Filter::Ptr filter);
@@ -173,6 +197,7 @@ protected:
     GroupManager::Ptr m_groupManager;
     std::string m_group;
     LogMatcher::Ptr m_matcher;
+    LogIndex::Ptr m_logIndex;
     FilterRequestFactory::Ptr m_factory;
     FilterMap m_filters;
     // timer to clear up the expired filter in-period
@@ -0,0 +1,275 @@
+#include <bcos-rpc/filter/Common.h>
+#include <bcos-rpc/filter/LogIndex.h>
+#include <bcos-utilities/BoostLog.h>
+#include <algorithm>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+namespace
+{
+// the bloom of the address and the topic is built the same way as getLogsBloom
+Bloom keyBloom(std::string const& _key)
+{
+    Bloom bloom{};
+    bytesToBloom(bcos::bytes(_key.begin(), _key.end()), bloom);
+    return bloom;
+}
+
+void orBloom(Bloom& _bloom, Bloom const& _other)
+{
+    for (size_t i = 0; i < _bloom.size(); ++i)
+    {
+        _bloom[i] |= _other[i];
+    }
+}
+
+bool containsBloom(Bloom const& _bloom, Bloom const& _item)
+{
+    for (size_t i = 0; i < _bloom.size(); ++i)
+    {
+        if ((_bloom[i] & _item[i]) != _item[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+size_t LogIndex::sectionSize() const
+{
+    std::shared_lock lock(x_sections);
+    return m_sections.size();
+}
+
+LogIndex::Query LogIndex::makeQuery(FilterRequest const& _params)
+{
+    Query query;
+    try
+    {
+        // the address of the log entry is the hex string without 0x
+        for (auto const& address : _params.addresses())
+        {
+            std::string_view key = address;
+            if (key.starts_with("0x"))
+            {
+                key.remove_prefix(2);
+            }
+            query.addressKeys.emplace_back(key);
+            query.addressBlooms.emplace_back(keyBloom(query.addressKeys.back()));
+        }
+        for (auto const& topics : _params.topics())
+        {
+            if (topics.empty())
+            {
+                continue;
+            }
+            auto& keys = query.topicKeys.emplace_back();
+            auto& blooms = query.topicBlooms.emplace_back();
+            for (auto const& topic : topics)
+            {
+                auto hash = h256(std::string_view(topic), h256::FromHex);
+                keys.emplace_back((const char*)hash.data(), hash.size());
+                blooms.emplace_back(keyBloom(keys.back()));
+            }
+        }
+    }
+    catch (std::exception const& e)
+    {
+        FILTER_LOG(DEBUG) << LOG_BADGE("makeQuery") << LOG_DESC("params not indexable")
+                          << LOG_KV("msg", boost::diagnostic_information(e));
+        query.indexable = false;
+    }
+    return query;
+}
+
+void LogIndex::addLogEntry(protocol::LogEntry const& _logEntry, BlockLogs& _blockLogs) const
+{
+    auto addKey = [this, &_blockLogs](std::string _key) {
+        orBloom(_blockLogs.bloom, keyBloom(_key));
+        if (m_invertedIndex)
+        {
+            _blockLogs.keys.emplace_back(std::move(_key));
+        }
+    };
+    _blockLogs.empty = false;
+    addKey(std::string(_logEntry.address()));
+    for (auto const& topic : _logEntry.topics())
+    {
+        addKey(std::string((const char*)topic.data(), topic.size()));
+    }
+}
+
+void LogIndex::addBlock(protocol::BlockNumber _number, protocol::Block const& _block)
+{
+    BlockLogs blockLogs;
+    for (uint64_t i = 0; i < _block.receiptsSize(); ++i)
+    {
+        auto receipt = _block.receipt(i);
+        if (!receipt)
+        {
+            continue;
+        }
+        for (auto const& logEntry : receipt->logEntries())
+        {
+            addLogEntry(logEntry, blockLogs);
+        }
+    }
+    insert(_number, std::move(blockLogs));
+}
+
+void LogIndex::addBlock(protocol::BlockNumber _number, protocol::LogEntries const& _logEntries)
+{
+    BlockLogs blockLogs;
+    for (auto const& logEntry : _logEntries)
+    {
+        addLogEntry(logEntry, blockLogs);
+    }
+    insert(_number, std::move(blockLogs));
+}
+
+bool LogIndex::indexed(protocol::BlockNumber _number) const
+{
+    if (_number < 0)
+    {
+        return false;
+    }
+    std::shared_lock lock(x_sections);
+    auto it = m_sections.find(_number / SECTION_SIZE);
+    return it != m_sections.end() && it->second.indexed.test(_number % SECTION_SIZE);
+}
+
+void LogIndex::insert(protocol::BlockNumber _number, BlockLogs _blockLogs)
+{
+    if (_number < 0)
+    {
+        return;
+    }
+    auto sectionNumber = _number / SECTION_SIZE;
+    auto offset = (uint16_t)(_number % SECTION_SIZE);
+
+    std::unique_lock lock(x_sections);
+    auto it = m_sections.find(sectionNumber);
+    if (it == m_sections.end())
+    {
+        // evict the least recently used section
+        if (m_sections.size() >= m_maxSections)
+        {
+            auto evicted = std::min_element(
+                m_sections.begin(), m_sections.end(), [](auto const& _lhs, auto const& _rhs) {
+                    return _lhs.second.lastAccess.load() < _rhs.second.lastAccess.load();
+                });
+            FILTER_LOG(DEBUG) << LOG_BADGE("LogIndex") << LOG_DESC("evict section")
+                              << LOG_KV("from", evicted->first * SECTION_SIZE)
+                              << LOG_KV("blocks", evicted->second.indexed.count());
+            m_sections.erase(evicted);
+        }
+        it = m_sections.try_emplace(sectionNumber).first;
+    }
+    auto& section = it->second;
+    section.lastAccess.store(++m_accessClock);
+    if (section.indexed.test(offset))
+    {
+        return;
+    }
+    section.indexed.set(offset);
+    if (_blockLogs.empty)
+    {
+        return;
+    }
+    orBloom(section.bloom, _blockLogs.bloom);
+    section.blooms.emplace(offset, _blockLogs.bloom);
+    for (auto& key : _blockLogs.keys)
+    {
+        auto& offsets = section.keys[std::move(key)];
+        auto position = std::lower_bound(offsets.begin(), offsets.end(), offset);
+        if (position == offsets.end() || *position != offset)
+        {
+            offsets.insert(position, offset);
+        }
+    }
+}
+
+bool LogIndex::matchBloom(Bloom const& _bloom, Query const& _query)
+{
+    auto hit = [&_bloom](std::vector<Bloom> const& _blooms) {
+        return std::any_of(_blooms.begin(), _blooms.end(),
+            [&_bloom](Bloom const& _item) { return containsBloom(_bloom, _item); });
+    };
+    if (!_query.addressBlooms.empty() && !hit(_query.addressBlooms))
+    {
+        return false;
+    }
+    return std::all_of(_query.topicBlooms.begin(), _query.topicBlooms.end(), hit);
+}
+
+bool LogIndex::matchKeys(Section const& _section, uint16_t _offset, Query const& _query) const
+{
+    auto hit = [&_section, _offset](std::vector<std::string> const& _keys) {
+        return std::any_of(_keys.begin(), _keys.end(), [&](std::string const& _key) {
+            auto it = _section.keys.find(_key);
+            return it != _section.keys.end() &&
+                   std::binary_search(it->second.begin(), it->second.end(), _offset);
+        });
+    };
+    if (!_query.addressKeys.empty() && !hit(_query.addressKeys))
+    {
+        return false;
+    }
+    return std::all_of(_query.topicKeys.begin(), _query.topicKeys.end(), hit);
+}
+
+std::vector<protocol::BlockNumber> LogIndex::candidates(Query const& _query,
+    protocol::BlockNumber _from, protocol::BlockNumber _to, size_t _limit) const
+{
+    std::vector<protocol::BlockNumber> result;
+    _from = std::max<protocol::BlockNumber>(_from, 0);
+    if (_to < _from || _limit == 0)
+    {
+        return result;
+    }
+    std::shared_lock lock(x_sections);
+    for (auto number = _from; number <= _to && result.size() < _limit;)
+    {
+        auto sectionNumber = number / SECTION_SIZE;
+        auto sectionEnd = std::min(_to, (sectionNumber + 1) * SECTION_SIZE - 1);
+        auto it = m_sections.find(sectionNumber);
+        if (!_query.indexable || it == m_sections.end())
+        {
+            for (; number <= sectionEnd && result.size() < _limit; ++number)
+            {
+                result.emplace_back(number);
+            }
+            continue;
+        }
+        auto const& section = it->second;
+        section.lastAccess.store(++m_accessClock);
+        auto sectionMatched = matchBloom(section.bloom, _query);
+        for (; number <= sectionEnd && result.size() < _limit; ++number)
+        {
+            auto offset = (uint16_t)(number % SECTION_SIZE);
+            if (!section.indexed.test(offset))
+            {
+                result.emplace_back(number);
+                continue;
+            }
+            if (!sectionMatched)
+            {
+                continue;
+            }
+            // no logs in the block
+            auto bloomIt = section.blooms.find(offset);
+            if (bloomIt == section.blooms.end() || !matchBloom(bloomIt->second, _query))
+            {
+                continue;
+            }
+            if (m_invertedIndex && !matchKeys(section, offset, _query))
+            {
+                continue;
+            }
+            result.emplace_back(number);
+        }
+    }
+    return result;
+}
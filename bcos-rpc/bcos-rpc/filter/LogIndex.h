@@ -0,0 +1,105 @@
+#pragma once
+#include <bcos-framework/protocol/Block.h>
+#include <bcos-framework/protocol/LogEntry.h>
+#include <bcos-framework/protocol/ProtocolTypeDef.h>
+#include <bcos-rpc/filter/FilterRequest.h>
+#include <bcos-rpc/web3jsonrpc/model/Bloom.h>
+#include <atomic>
+#include <bitset>
+#include <limits>
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace bcos::rpc
+{
+/**
+ * @brief the in-memory log bloom index of the scanned blocks: the blocks are grouped into
+ * sections of 4096 blocks, every section keeps the bloom of all its logs, the bloom of every
+ * block with logs and optionally the blocks every address and topic appears in, so getLogs and
+ * the filter polling skip the blocks that can't match without loading the receipts.
+ *
+ * Note: the blocks not indexed yet are always candidates, the index never drops a matched log
+ */
+class LogIndex
+{
+public:
+    using Ptr = std::shared_ptr<LogIndex>;
+
+    constexpr static protocol::BlockNumber SECTION_SIZE = 4096;
+    /// about one million blocks
+    constexpr static size_t DEFAULT_MAX_SECTIONS = 256;
+
+    // the blooms and the keys of the filter params, built once for every request
+    struct Query
+    {
+        // empty means any address
+        std::vector<Bloom> addressBlooms;
+        std::vector<std::string> addressKeys;
+        // the topic positions with candidates, the log matches one candidate in every position
+        std::vector<std::vector<Bloom>> topicBlooms;
+        std::vector<std::vector<std::string>> topicKeys;
+        // the topics can't be parsed, scan all the blocks
+        bool indexable = true;
+    };
+
+    explicit LogIndex(size_t _maxSections = DEFAULT_MAX_SECTIONS, bool _invertedIndex = false)
+      : m_maxSections(std::max<size_t>(_maxSections, 1)), m_invertedIndex(_invertedIndex)
+    {}
+    LogIndex(const LogIndex&) = delete;
+    LogIndex(LogIndex&&) = delete;
+    LogIndex& operator=(const LogIndex&) = delete;
+    LogIndex& operator=(LogIndex&&) = delete;
+    virtual ~LogIndex() = default;
+
+    size_t maxSections() const { return m_maxSections; }
+    bool invertedIndex() const { return m_invertedIndex; }
+    size_t sectionSize() const;
+
+    static Query makeQuery(FilterRequest const& _params);
+
+    // index the logs of the block, the receipts of the block must be loaded
+    void addBlock(protocol::BlockNumber _number, protocol::Block const& _block);
+    void addBlock(protocol::BlockNumber _number, protocol::LogEntries const& _logEntries);
+    bool indexed(protocol::BlockNumber _number) const;
+
+    // the blocks in [_from, _to] that may contain the logs matching the query, in order, at most
+    // _limit blocks, the scan stops at the last one when the limit is reached
+    std::vector<protocol::BlockNumber> candidates(Query const& _query, protocol::BlockNumber _from,
+        protocol::BlockNumber _to, size_t _limit = std::numeric_limits<size_t>::max()) const;
+
+private:
+    struct Section
+    {
+        Bloom bloom{};
+        std::bitset<SECTION_SIZE> indexed;
+        // the blooms of the blocks with logs
+        std::unordered_map<uint16_t, Bloom> blooms;
+        // address/topic => the sorted offsets of the blocks containing it
+        std::unordered_map<std::string, std::vector<uint16_t>> keys;
+        mutable std::atomic<uint64_t> lastAccess{0};
+    };
+
+    struct BlockLogs
+    {
+        Bloom bloom{};
+        std::vector<std::string> keys;
+        bool empty = true;
+    };
+
+    void addLogEntry(protocol::LogEntry const& _logEntry, BlockLogs& _blockLogs) const;
+    void insert(protocol::BlockNumber _number, BlockLogs _blockLogs);
+    bool matchKeys(Section const& _section, uint16_t _offset, Query const& _query) const;
+    static bool matchBloom(Bloom const& _bloom, Query const& _query);
+
+    size_t m_maxSections;
+    bool m_invertedIndex;
+
+    mutable std::shared_mutex x_sections;
+    std::map<protocol::BlockNumber, Section> m_sections;
+    mutable std::atomic<uint64_t> m_accessClock{0};
+};
+}  // namespace bcos::rpc
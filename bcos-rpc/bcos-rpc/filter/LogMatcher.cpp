@@ -6,13 +6,13 @@ using namespace bcos;
 using namespace bcos::rpc;
 
 uint32_t LogMatcher::matches(
-    FilterRequest::ConstPtr _params, bcos::protocol::Block::ConstPtr _block, Json::Value& _result)
+    FilterRequest::ConstPtr _params, bcos::protocol::Block::ConstPtr _block, JsonWriter& _writer)
 {
     uint32_t count = 0;
     for (std::size_t index = 0; index < _block->transactionsMetaDataSize(); index++)
     {
         count += matches(_params, _block->blockHeaderConst()->hash(), _block->receipt(index),
-            _block->transactionHash(index), index, _result);
+            _block->transactionHash(index), index, _writer);
     }
 
     return count;
@@ -20,7 +20,7 @@ uint32_t LogMatcher::matches(
 
 uint32_t LogMatcher::matches(FilterRequest::ConstPtr _params, bcos::crypto::HashType&& _blockHash,
     bcos::protocol::TransactionReceipt::ConstPtr&& _receipt, bcos::crypto::HashType&& _txHash,
-    std::size_t _txIndex, Json::Value& _result)
+    std::size_t _txIndex, JsonWriter& _writer)
 {
     uint32_t count = 0;
     auto blockNumber = _receipt->blockNumber();
@@ -32,22 +32,22 @@ uint32_t LogMatcher::matches(FilterRequest::ConstPtr _params, bcos::crypto::Hash
         if (matches(_params, logEntry))
         {
             count++;
-            Json::Value log;
-            log["data"] = toHexStringWithPrefix(logEntry.data());
-            log["logIndex"] = toQuantity(i);
-            log["blockNumber"] = toQuantity(blockNumber);
-            log["blockHash"] = _blockHash.hexPrefixed();
-            log["transactionIndex"] = toQuantity(_txIndex);
-            log["transactionHash"] = _txHash.hexPrefixed();
-            log["removed"] = false;
-            log["address"] = "0x" + std::string(logEntry.address());
-            Json::Value jTopics(Json::arrayValue);
+            _writer.startObject();
+            _writer.key("data").hexValue(logEntry.data());
+            _writer.member("logIndex", toQuantity(i));
+            _writer.member("blockNumber", toQuantity(blockNumber));
+            _writer.key("blockHash").hexValue(_blockHash.ref());
+            _writer.member("transactionIndex", toQuantity(_txIndex));
+            _writer.key("transactionHash").hexValue(_txHash.ref());
+            _writer.member("removed", false);
+            _writer.member("address", "0x" + std::string(logEntry.address()));
+            _writer.key("topics").startArray();
             for (const auto& topic : logEntry.topics())
             {
-                jTopics.append(topic.hexPrefixed());
+                _writer.hexValue(topic.ref());
             }
-            log["topics"] = std::move(jTopics);
-            _result.append(std::move(log));
+            _writer.endArray();
+            _writer.endObject();
         }
     }
     return count;
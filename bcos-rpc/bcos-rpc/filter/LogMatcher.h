@@ -4,7 +4,7 @@
 #include <bcos-framework/protocol/ProtocolTypeDef.h>
 #include <bcos-framework/protocol/TransactionReceipt.h>
 #include <bcos-rpc/filter/FilterRequest.h>
-#include <json/json.h>
+#include <bcos-rpc/jsonrpc/JsonWriter.h>
 
 namespace bcos
 {
@@ -20,12 +20,13 @@ public:
 public:
     bool matches(FilterRequest::ConstPtr _params, const bcos::protocol::LogEntry& _logEntry);
 
+    // the matched logs are written into the array opened by the writer
     uint32_t matches(FilterRequest::ConstPtr _params, bcos::crypto::HashType&& _blockHash,
         bcos::protocol::TransactionReceipt::ConstPtr&& _receipt, bcos::crypto::HashType&& _txHash,
-        std::size_t _txIndex, Json::Value& _result);
+        std::size_t _txIndex, JsonWriter& _writer);
 
     uint32_t matches(FilterRequest::ConstPtr _params, bcos::protocol::Block::ConstPtr _block,
-        Json::Value& _result);
+        JsonWriter& _writer);
 };
 
 }  // namespace rpc
@@ -0,0 +1,473 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file JsonReader.cpp
+ */
+
+#include <bcos-rpc/jsonrpc/JsonReader.h>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+namespace
+{
+constexpr uint64_t repeat(uint8_t _byte)
+{
+    return 0x0101010101010101ULL * _byte;
+}
+
+// whether any of the 8 bytes is '"', '\\' or the control char
+inline bool hasSpecial(uint64_t _word)
+{
+    constexpr uint64_t high = repeat(0x80);
+    auto quote = _word ^ repeat('"');
+    auto backslash = _word ^ repeat('\\');
+    auto zeroQuote = (quote - repeat(0x01)) & ~quote;
+    auto zeroBackslash = (backslash - repeat(0x01)) & ~backslash;
+    auto control = (_word - repeat(0x20)) & ~_word;
+    return ((zeroQuote | zeroBackslash | control) & high) != 0;
+}
+
+inline bool isSpecial(char _ch)
+{
+    return _ch == '"' || _ch == '\\' || (uint8_t)_ch < 0x20;
+}
+
+void appendUTF8(std::string& _out, uint32_t _codePoint)
+{
+    if (_codePoint < 0x80)
+    {
+        _out.push_back((char)_codePoint);
+    }
+    else if (_codePoint < 0x800)
+    {
+        _out.push_back((char)(0xc0 | (_codePoint >> 6)));
+        _out.push_back((char)(0x80 | (_codePoint & 0x3f)));
+    }
+    else if (_codePoint < 0x10000)
+    {
+        _out.push_back((char)(0xe0 | (_codePoint >> 12)));
+        _out.push_back((char)(0x80 | ((_codePoint >> 6) & 0x3f)));
+        _out.push_back((char)(0x80 | (_codePoint & 0x3f)));
+    }
+    else
+    {
+        _out.push_back((char)(0xf0 | (_codePoint >> 18)));
+        _out.push_back((char)(0x80 | ((_codePoint >> 12) & 0x3f)));
+        _out.push_back((char)(0x80 | ((_codePoint >> 6) & 0x3f)));
+        _out.push_back((char)(0x80 | (_codePoint & 0x3f)));
+    }
+}
+
+class Parser
+{
+public:
+    Parser(std::string_view _json) : m_pos(_json.data()), m_end(_json.data() + _json.size()) {}
+
+    bool parseDocument(Json::Value& _root)
+    {
+        skipSpaces();
+        if (!parseValue(_root, 0))
+        {
+            return false;
+        }
+        skipSpaces();
+        return m_pos == m_end;
+    }
+
+private:
+    void skipSpaces()
+    {
+        while (m_pos != m_end &&
+               (*m_pos == ' ' || *m_pos == '\n' || *m_pos == '\r' || *m_pos == '\t'))
+        {
+            ++m_pos;
+        }
+    }
+
+    bool consume(std::string_view _literal)
+    {
+        if ((size_t)(m_end - m_pos) < _literal.size() ||
+            std::memcmp(m_pos, _literal.data(), _literal.size()) != 0)
+        {
+            return false;
+        }
+        m_pos += _literal.size();
+        return true;
+    }
+
+    bool parseValue(Json::Value& _value, size_t _depth)
+    {
+        if (m_pos == m_end || _depth > JsonReader::MAX_DEPTH)
+        {
+            return false;
+        }
+        switch (*m_pos)
+        {
+        case '{':
+            return parseObject(_value, _depth);
+        case '[':
+            return parseArray(_value, _depth);
+        case '"':
+        {
+            std::string_view view;
+            std::string decoded;
+            if (!parseString(view, decoded))
+            {
+                return false;
+            }
+            _value = Json::Value(view.data(), view.data() + view.size());
+            return true;
+        }
+        case 't':
+            _value = true;
+            return consume("true");
+        case 'f':
+            _value = false;
+            return consume("false");
+        case 'n':
+            _value = Json::Value();
+            return consume("null");
+        default:
+            return parseNumber(_value);
+        }
+    }
+
+    bool parseObject(Json::Value& _value, size_t _depth)
+    {
+        ++m_pos;
+        _value = Json::Value(Json::objectValue);
+        skipSpaces();
+        if (m_pos != m_end && *m_pos == '}')
+        {
+            ++m_pos;
+            return true;
+        }
+        std::string decoded;
+        while (true)
+        {
+            if (m_pos == m_end || *m_pos != '"')
+            {
+                return false;
+            }
+            std::string_view key;
+            if (!parseString(key, decoded))
+            {
+                return false;
+            }
+            skipSpaces();
+            if (m_pos == m_end || *m_pos != ':')
+            {
+                return false;
+            }
+            ++m_pos;
+            skipSpaces();
+            if (!parseValue(_value[std::string(key)], _depth + 1))
+            {
+                return false;
+            }
+            skipSpaces();
+            if (m_pos == m_end)
+            {
+                return false;
+            }
+            if (*m_pos == '}')
+            {
+                ++m_pos;
+                return true;
+            }
+            if (*m_pos != ',')
+            {
+                return false;
+            }
+            ++m_pos;
+            skipSpaces();
+        }
+    }
+
+    bool parseArray(Json::Value& _value, size_t _depth)
+    {
+        ++m_pos;
+        _value = Json::Value(Json::arrayValue);
+        skipSpaces();
+        if (m_pos != m_end && *m_pos == ']')
+        {
+            ++m_pos;
+            return true;
+        }
+        while (true)
+        {
+            if (!parseValue(_value.append(Json::Value()), _depth + 1))
+            {
+                return false;
+            }
+            skipSpaces();
+            if (m_pos == m_end)
+            {
+                return false;
+            }
+            if (*m_pos == ']')
+            {
+                ++m_pos;
+                return true;
+            }
+            if (*m_pos != ',')
+            {
+                return false;
+            }
+            ++m_pos;
+            skipSpaces();
+        }
+    }
+
+    // the view points to the input if the string has no escape, otherwise to the decoded
+    bool parseString(std::string_view& _view, std::string& _decoded)
+    {
+        ++m_pos;
+        const auto* begin = m_pos;
+        while (m_end - m_pos >= 8)
+        {
+            uint64_t word = 0;
+            std::memcpy(&word, m_pos, sizeof(word));
+            if (hasSpecial(word))
+            {
+                break;
+            }
+            m_pos += 8;
+        }
+        while (m_pos != m_end && !isSpecial(*m_pos))
+        {
+            ++m_pos;
+        }
+        if (m_pos == m_end || (uint8_t)*m_pos < 0x20)
+        {
+            return false;
+        }
+        if (*m_pos == '"')
+        {
+            _view = std::string_view(begin, m_pos - begin);
+            ++m_pos;
+            return true;
+        }
+
+        _decoded.assign(begin, m_pos);
+        while (m_pos != m_end)
+        {
+            auto ch = *m_pos++;
+            if (ch == '"')
+            {
+                _view = _decoded;
+                return true;
+            }
+            if ((uint8_t)ch < 0x20)
+            {
+                return false;
+            }
+            if (ch != '\\')
+            {
+                _decoded.push_back(ch);
+                continue;
+            }
+            if (m_pos == m_end)
+            {
+                return false;
+            }
+            switch (*m_pos++)
+            {
+            case '"':
+                _decoded.push_back('"');
+                break;
+            case '\\':
+                _decoded.push_back('\\');
+                break;
+            case '/':
+                _decoded.push_back('/');
+                break;
+            case 'b':
+                _decoded.push_back('\b');
+                break;
+            case 'f':
+                _decoded.push_back('\f');
+                break;
+            case 'n':
+                _decoded.push_back('\n');
+                break;
+            case 'r':
+                _decoded.push_back('\r');
+                break;
+            case 't':
+                _decoded.push_back('\t');
+                break;
+            case 'u':
+            {
+                uint32_t codePoint = 0;
+                if (!parseHex4(codePoint))
+                {
+                    return false;
+                }
+                if (codePoint >= 0xd800 && codePoint <= 0xdbff)
+                {
+                    uint32_t low = 0;
+                    if (!consume("\\u") || !parseHex4(low) || low < 0xdc00 || low > 0xdfff)
+                    {
+                        return false;
+                    }
+                    codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (low - 0xdc00);
+                }
+                else if (codePoint >= 0xdc00 && codePoint <= 0xdfff)
+                {
+                    return false;
+                }
+                appendUTF8(_decoded, codePoint);
+                break;
+            }
+            default:
+                return false;
+            }
+        }
+        return false;
+    }
+
+    bool parseHex4(uint32_t& _value)
+    {
+        if (m_end - m_pos < 4)
+        {
+            return false;
+        }
+        auto result = std::from_chars(m_pos, m_pos + 4, _value, 16);
+        if (result.ec != std::errc() || result.ptr != m_pos + 4)
+        {
+            return false;
+        }
+        m_pos += 4;
+        return true;
+    }
+
+    // -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?, the integers are decoded as Json::Reader does
+    bool parseNumber(Json::Value& _value)
+    {
+        const auto* begin = m_pos;
+        auto isDigit = [this]() { return m_pos != m_end && *m_pos >= '0' && *m_pos <= '9'; };
+        bool negative = (*m_pos == '-');
+        if (negative)
+        {
+            ++m_pos;
+        }
+        if (!isDigit())
+        {
+            return false;
+        }
+        if (*m_pos == '0')
+        {
+            ++m_pos;
+        }
+        else
+        {
+            while (isDigit())
+            {
+                ++m_pos;
+            }
+        }
+        bool isInteger = true;
+        if (m_pos != m_end && *m_pos == '.')
+        {
+            isInteger = false;
+            ++m_pos;
+            if (!isDigit())
+            {
+                return false;
+            }
+            while (isDigit())
+            {
+                ++m_pos;
+            }
+        }
+        if (m_pos != m_end && (*m_pos == 'e' || *m_pos == 'E'))
+        {
+            isInteger = false;
+            ++m_pos;
+            if (m_pos != m_end && (*m_pos == '+' || *m_pos == '-'))
+            {
+                ++m_pos;
+            }
+            if (!isDigit())
+            {
+                return false;
+            }
+            while (isDigit())
+            {
+                ++m_pos;
+            }
+        }
+
+        if (isInteger)
+        {
+            uint64_t number = 0;
+            auto result = std::from_chars(begin + (negative ? 1 : 0), m_pos, number);
+            if (result.ec == std::errc())
+            {
+                constexpr auto maxInt = (uint64_t)std::numeric_limits<Json::LargestInt>::max();
+                if (!negative && number <= maxInt)
+                {
+                    _value = (Json::LargestInt)number;
+                    return true;
+                }
+                if (!negative)
+                {
+                    _value = (Json::LargestUInt)number;
+                    return true;
+                }
+                if (number <= maxInt + 1)
+                {
+                    _value = (Json::LargestInt)(0 - number);
+                    return true;
+                }
+            }
+        }
+        double number = 0;
+        auto result = std::from_chars(begin, m_pos, number);
+        if (result.ec != std::errc() || result.ptr != m_pos)
+        {
+            return false;
+        }
+        _value = number;
+        return true;
+    }
+
+    const char* m_pos;
+    const char* m_end;
+};
+}  // namespace
+
+bool JsonReader::parse(std::string_view _json, Json::Value& _root)
+{
+    return Parser(_json).parseDocument(_root);
+}
+
+bool bcos::rpc::parseJson(std::string_view _json, Json::Value& _root)
+{
+    if (JsonReader::parse(_json, _root))
+    {
+        return true;
+    }
+    _root = Json::Value();
+    Json::Reader reader;
+    return reader.parse(_json.begin(), _json.end(), _root);
+}
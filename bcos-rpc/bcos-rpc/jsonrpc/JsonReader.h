@@ -0,0 +1,44 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief single pass json reader for the rpc requests
+ * @file JsonReader.h
+ */
+
+#pragma once
+
+#include <json/json.h>
+#include <string_view>
+
+namespace bcos::rpc
+{
+/**
+ * @brief parse the strict json into the Json::Value in one pass, the strings without escape (e.g.
+ * the hex encoded transactions) are scanned 8 bytes a time and copied once
+ *
+ * Note: the input with comments, the invalid json and the json nested too deep are rejected, the
+ * caller falls back to Json::Reader for them to keep the same result and error
+ */
+class JsonReader
+{
+public:
+    constexpr static size_t MAX_DEPTH = 1000;
+
+    static bool parse(std::string_view _json, Json::Value& _root);
+};
+
+// parse with JsonReader and fall back to Json::Reader
+bool parseJson(std::string_view _json, Json::Value& _root);
+}  // namespace bcos::rpc
@@ -0,0 +1,121 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file JsonRpcBatch.cpp
+ */
+
+#include <bcos-rpc/jsonrpc/JsonRpcBatch.h>
+#include <algorithm>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+JsonRpcBatch::JsonRpcBatch(size_t _size, JsonRpcBatchConfig const& _config, Handler _handler,
+    TimeoutResponse _timeoutResponse, Sender _sender)
+  : m_size(_size),
+    m_maxConcurrency(std::max<size_t>(_config.maxConcurrency, 1)),
+    m_handler(std::move(_handler)),
+    m_timeoutResponse(std::move(_timeoutResponse)),
+    m_sender(std::move(_sender)),
+    m_responses(_size)
+{
+    if (_config.timeout > 0)
+    {
+        m_deadline = utcSteadyTime() + _config.timeout;
+    }
+}
+
+void JsonRpcBatch::start()
+{
+    if (m_size == 0)
+    {
+        m_sender(toBatchResponse(m_responses));
+        return;
+    }
+    dispatch();
+}
+
+void JsonRpcBatch::dispatch()
+{
+    std::unique_lock lock(x_state);
+    if (m_dispatching)
+    {
+        return;
+    }
+    m_dispatching = true;
+    while (m_next < m_size && m_inFlight < m_maxConcurrency)
+    {
+        auto index = m_next++;
+        ++m_inFlight;
+        auto expired = (m_deadline > 0 && utcSteadyTime() > m_deadline);
+        lock.unlock();
+        if (expired)
+        {
+            onResponse(index, m_timeoutResponse(index));
+        }
+        else
+        {
+            m_handler(index, [self = shared_from_this(), index](bcos::bytes _response) {
+                self->onResponse(index, std::move(_response));
+            });
+        }
+        lock.lock();
+    }
+    m_dispatching = false;
+}
+
+void JsonRpcBatch::onResponse(size_t _index, bcos::bytes _response)
+{
+    {
+        std::unique_lock lock(x_state);
+        m_responses[_index] = std::move(_response);
+        --m_inFlight;
+        if (++m_finished < m_size)
+        {
+            lock.unlock();
+            dispatch();
+            return;
+        }
+    }
+    m_sender(toBatchResponse(m_responses));
+}
+
+bcos::bytes JsonRpcBatch::toBatchResponse(std::vector<bcos::bytes> const& _responses)
+{
+    size_t length = _responses.size() + 2;
+    for (auto const& response : _responses)
+    {
+        length += response.size();
+    }
+    bcos::bytes out;
+    out.reserve(length);
+    out.push_back('[');
+    for (size_t i = 0; i < _responses.size(); ++i)
+    {
+        if (i > 0)
+        {
+            out.push_back(',');
+        }
+        out.insert(out.end(), _responses[i].begin(), _responses[i].end());
+    }
+    out.push_back(']');
+    return out;
+}
+
+bool bcos::rpc::isBatchRequest(std::string_view _requestBody)
+{
+    auto pos = _requestBody.find_first_not_of(" \t\r\n");
+    return pos != std::string_view::npos && _requestBody[pos] == '[';
+}
@@ -0,0 +1,89 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the execution of the json rpc batch request shared by the rpc and the web3 rpc
+ * @file JsonRpcBatch.h
+ */
+
+#pragma once
+
+#include <bcos-utilities/Common.h>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace bcos::rpc
+{
+struct JsonRpcBatchConfig
+{
+    // the larger batch is rejected as a whole
+    uint32_t maxSize = 500;
+    // the max requests of a batch waiting for the response at the same time
+    uint32_t maxConcurrency = 64;
+    // the requests not started in the time budget(ms) respond with the timeout error, 0 means no
+    // limit
+    uint32_t timeout = 0;
+};
+
+/**
+ * @brief dispatch the requests of a batch without waiting for the previous responses, at most
+ * maxConcurrency requests in flight, and send the responses as one json array in the request
+ * order once all the requests responded
+ */
+class JsonRpcBatch : public std::enable_shared_from_this<JsonRpcBatch>
+{
+public:
+    using Ptr = std::shared_ptr<JsonRpcBatch>;
+    using Sender = std::function<void(bcos::bytes)>;
+    // handle the index-th request, the sender should be called once with the serialized response
+    using Handler = std::function<void(size_t, Sender)>;
+    // the serialized response of the index-th request which is not started in the time budget
+    using TimeoutResponse = std::function<bcos::bytes(size_t)>;
+
+    JsonRpcBatch(size_t _size, JsonRpcBatchConfig const& _config, Handler _handler,
+        TimeoutResponse _timeoutResponse, Sender _sender);
+    ~JsonRpcBatch() = default;
+
+    void start();
+
+    // the json array of the serialized responses
+    static bcos::bytes toBatchResponse(std::vector<bcos::bytes> const& _responses);
+
+private:
+    void dispatch();
+    void onResponse(size_t _index, bcos::bytes _response);
+
+    size_t m_size;
+    size_t m_maxConcurrency;
+    uint64_t m_deadline = 0;
+    Handler m_handler;
+    TimeoutResponse m_timeoutResponse;
+    Sender m_sender;
+
+    std::vector<bcos::bytes> m_responses;
+    std::mutex x_state;
+    size_t m_next = 0;
+    size_t m_inFlight = 0;
+    size_t m_finished = 0;
+    // the requests responded synchronously are dispatched by the loop already running instead of
+    // recursion
+    bool m_dispatching = false;
+};
+
+// whether the body is a json array, check the first non-space character only
+bool isBatchRequest(std::string_view _requestBody);
+}  // namespace bcos::rpc
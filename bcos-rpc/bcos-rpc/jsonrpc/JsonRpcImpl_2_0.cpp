@@ -32,6 +32,7 @@
 #include <bcos-framework/protocol/TransactionReceipt.h>
 #include <bcos-protocol/TransactionStatus.h>
 #include <bcos-rpc/jsonrpc/Common.h>
+#include <bcos-rpc/jsonrpc/JsonReader.h>
 #include <bcos-rpc/jsonrpc/JsonRpcImpl_2_0.h>
 #include <bcos-rpc/web3jsonrpc/model/Web3Transaction.h>
 #include <bcos-task/Wait.h>
@@ -47,6 +48,7 @@
 #include <boost/throw_exception.hpp>
 #include <exception>
 #include <iterator>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
@@ -125,24 +127,21 @@ void JsonRpcImpl_2_0::handleRpcRequest(
 
 bcos::bytes JsonRpcImpl_2_0::decodeData(std::string_view _data)
 {
-    auto begin = _data.begin();
-    auto end = _data.end();
-    auto length = _data.size();
-
-    if ((length == 0) || (length % 2 != 0)) [[unlikely]]
+    if ((_data.size() == 0) || (_data.size() % 2 != 0)) [[unlikely]]
     {
         BOOST_THROW_EXCEPTION(std::runtime_error{"Unexpect hex string"});
     }
 
     if (_data.starts_with("0x"))
     {
-        begin += 2;
-        length -= 2;
+        _data.remove_prefix(2);
     }
 
-    bcos::bytes data;
-    data.reserve(length / 2);
-    boost::algorithm::unhex(begin, end, std::back_inserter(data));
+    bcos::bytes data(_data.size() / 2);
+    if (!bcos::hex::decode(_data.data(), data.size(), data.data())) [[unlikely]]
+    {
+        BOOST_THROW_EXCEPTION(std::runtime_error{"Unexpect hex string"});
+    }
     return data;
 }
 
@@ -150,14 +149,13 @@ void JsonRpcImpl_2_0::parseRpcResponseJson(
     std::string_view _responseBody, JsonResponse& _jsonResponse)
 {
     Json::Value root;
-    Json::Reader jsonReader;
     std::string errorMessage;
 
     try
     {
         do
         {
-            if (!jsonReader.parse(_responseBody.begin(), _responseBody.end(), root))
+            if (!parseJson(_responseBody, root))
             {
                 errorMessage = "invalid response json object";
                 break;
@@ -214,6 +212,141 @@ void JsonRpcImpl_2_0::parseRpcResponseJson(
         JsonRpcError::InvalidRequest, "The JSON sent is not a valid Response object."));
 }
 
+namespace
+{
+// the committed data is the same on all the nodes of the group, so the key has no node name
+std::string responseCacheKey(std::string_view _groupID, std::string_view _type,
+    std::string_view _id, bool _flag, bool _extraFlag = false)
+{
+    std::string key;
+    key.reserve(_groupID.size() + _type.size() + _id.size() + 10);
+    key.append("rpc:").append(_groupID).append(":").append(_type).append(":").append(_id);
+    key.push_back(':');
+    key.push_back(_flag ? '1' : '0');
+    key.push_back(_extraFlag ? '1' : '0');
+    return key;
+}
+
+void writeBlockHeaderMembers(JsonWriter& writer, bcos::protocol::BlockHeader const& blockHeader)
+{
+    writer.key("hash").hexValue(blockHeader.hash().ref());
+    writer.member("version", blockHeader.version());
+    writer.key("txsRoot").hexValue(blockHeader.txsRoot().ref());
+    writer.key("receiptsRoot").hexValue(blockHeader.receiptsRoot().ref());
+    writer.key("stateRoot").hexValue(blockHeader.stateRoot().ref());
+    writer.member("number", blockHeader.number());
+    writer.member("gasUsed", blockHeader.gasUsed().str(16));
+    writer.member("timestamp", blockHeader.timestamp());
+    writer.member("sealer", blockHeader.sealer());
+    writer.key("extraData").hexValue(blockHeader.extraData());
+
+    writer.key("consensusWeights").startArray();
+    for (const auto& wei : blockHeader.consensusWeights())
+    {
+        writer.value(wei);
+    }
+    writer.endArray();
+
+    writer.key("sealerList").startArray();
+    for (const auto& sealer : blockHeader.sealerList())
+    {
+        writer.hexValue(sealer);
+    }
+    writer.endArray();
+
+    writer.key("parentInfo").startArray();
+    for (const auto& p : blockHeader.parentInfo())
+    {
+        writer.startObject();
+        writer.member("blockNumber", p.blockNumber);
+        writer.key("blockHash").hexValue(p.blockHash.ref());
+        writer.endObject();
+    }
+    writer.endArray();
+
+    writer.key("signatureList").startArray();
+    for (const auto& sign : blockHeader.signatureList())
+    {
+        writer.startObject();
+        writer.member("sealerIndex", sign.index);
+        writer.key("signature").hexValue(sign.signature);
+        writer.endObject();
+    }
+    writer.endArray();
+}
+
+void writeReceiptMembers(JsonWriter& writer, std::string_view _txHash,
+    protocol::TransactionStatus status,
+    bcos::protocol::TransactionReceipt const& transactionReceipt, bool _isWasm,
+    crypto::Hash& hashImpl)
+{
+    writer.member("version", transactionReceipt.version());
+    std::string contractAddress = string(transactionReceipt.contractAddress());
+    std::string checksumContractAddr = contractAddress;
+    if (!contractAddress.empty() && !_isWasm)
+    {
+        toChecksumAddress(checksumContractAddr, hashImpl.hash(contractAddress).hex());
+        if (!contractAddress.starts_with("0x") && !contractAddress.starts_with("0X"))
+        {
+            contractAddress = "0x" + contractAddress;
+        }
+        if (!checksumContractAddr.starts_with("0x") && !checksumContractAddr.starts_with("0X"))
+        {
+            checksumContractAddr = "0x" + checksumContractAddr;
+        }
+    }
+    writer.member("contractAddress", contractAddress);
+    writer.member("checksumContractAddress", checksumContractAddr);
+    writer.member("gasUsed", transactionReceipt.gasUsed().str(16));
+    writer.member("status", transactionReceipt.status());
+    writer.member("blockNumber", transactionReceipt.blockNumber());
+    writer.key("output").hexValue(transactionReceipt.output());
+    writer.member("message", transactionReceipt.message());
+    writer.member("transactionHash", _txHash);
+    if (status == protocol::TransactionStatus::None)
+    {
+        writer.key("hash").hexValue(transactionReceipt.hash().ref());
+    }
+    else
+    {
+        writer.member("hash", "0x");
+    }
+
+    writer.key("logEntries").startArray();
+    for (const auto& logEntry : transactionReceipt.logEntries())
+    {
+        writer.startObject();
+        writer.member("address", logEntry.address());
+        writer.key("topics").startArray();
+        for (const auto& topic : logEntry.topics())
+        {
+            writer.hexValue(topic.ref());
+        }
+        writer.endArray();
+        writer.key("data").hexValue(logEntry.data());
+        writer.endObject();
+    }
+    writer.endArray();
+    if (transactionReceipt.version() >= int32_t(bcos::protocol::TransactionVersion::V1_VERSION))
+    {
+        writer.member("effectiveGasPrice", transactionReceipt.effectiveGasPrice());
+    }
+}
+
+// the raw result parsed for the callers of the json tree
+RawRespFunc toJsonRespFunc(RespFunc _respFunc)
+{
+    return [respFunc = std::move(_respFunc)](Error::Ptr _error, bcos::bytes _result) {
+        Json::Value jResp;
+        if (!_result.empty())
+        {
+            parseJson(std::string_view((const char*)_result.data(), _result.size()), jResp);
+        }
+        respFunc(std::move(_error), jResp);
+    };
+}
+}  // namespace
+
 void bcos::rpc::toJsonResp(Json::Value& jResp, bcos::protocol::Transaction const& transaction)
 {
     jResp["version"] = transaction.version();
@@ -413,6 +546,117 @@ void bcos::rpc::toJsonResp(Json::Value& jResp, bcos::protocol::Block& block, boo
     jResp["transactions"] = jTxs;
 }
 
+void bcos::rpc::toJsonResp(JsonWriter& writer, bcos::protocol::Transaction const& transaction)
+{
+    // the members are the same as the Json::Value version, the web3 transaction fields are written
+    // once instead of overwritten
+    std::optional<Web3Transaction> web3Tx;
+    if (transaction.type() == bcos::protocol::TransactionType::Web3Transaction) [[unlikely]]
+    {
+        web3Tx.emplace();
+        auto extraBytesRef =
+            bcos::bytesRef(const_cast<byte*>(transaction.extraTransactionBytes().data()),
+                transaction.extraTransactionBytes().size());
+        codec::rlp::decodeFromPayload(extraBytesRef, *web3Tx);
+    }
+    auto isV1 = transaction.version() >= int32_t(bcos::protocol::TransactionVersion::V1_VERSION);
+    auto isEIP1559 = web3Tx && web3Tx->type >= TransactionType::EIP1559;
+
+    writer.startObject();
+    writer.member("version", transaction.version());
+    writer.key("hash").hexValue(transaction.hash().ref());
+    writer.member("nonce", toHex(transaction.nonce()));
+    writer.member("blockLimit", transaction.blockLimit());
+    writer.member("to", transaction.to());
+    writer.key("input").hexValue(transaction.input());
+    writer.key("from").hexValue(transaction.sender());
+    writer.member("importTime", transaction.importTime());
+    writer.member("chainID", transaction.chainId());
+    writer.member("groupID", transaction.groupId());
+    writer.member("abi", transaction.abi());
+    writer.key("signature").hexValue(transaction.signatureData());
+    writer.member("extraData", transaction.extraData());
+    if (web3Tx)
+    {
+        writer.member("value", web3Tx->value.str());
+        writer.member("gasLimit", web3Tx->gasLimit);
+        writer.member(
+            "gasPrice", isEIP1559 ? std::string("0") : web3Tx->maxPriorityFeePerGas.str());
+    }
+    else if (isV1)
+    {
+        writer.member("value", transaction.value());
+        writer.member("gasPrice", transaction.gasPrice());
+        writer.member("gasLimit", transaction.gasLimit());
+    }
+    if (isEIP1559)
+    {
+        writer.member("maxFeePerGas", web3Tx->maxFeePerGas.str());
+        writer.member("maxPriorityFeePerGas", web3Tx->maxPriorityFeePerGas.str());
+    }
+    else if (isV1)
+    {
+        writer.member("maxFeePerGas", transaction.maxFeePerGas());
+        writer.member("maxPriorityFeePerGas", transaction.maxPriorityFeePerGas());
+    }
+    if (transaction.version() >= (int32_t)bcos::protocol::TransactionVersion::V2_VERSION)
+    {
+        writer.key("extension").startArray();
+        for (const auto& ext : transaction.extension())
+        {
+            writer.value((uint32_t)ext);
+        }
+        writer.endArray();
+    }
+    writer.endObject();
+}
+
+void bcos::rpc::toJsonResp(JsonWriter& writer, bcos::protocol::BlockHeader::Ptr _blockHeaderPtr)
+{
+    if (!_blockHeaderPtr)
+    {
+        writer.null();
+        return;
+    }
+    writer.startObject();
+    writeBlockHeaderMembers(writer, *_blockHeaderPtr);
+    writer.endObject();
+}
+
+void bcos::rpc::toJsonResp(JsonWriter& writer, bcos::protocol::Block& block, bool _onlyTxHash)
+{
+    writer.startObject();
+    if (auto blockHeader = block.blockHeader())
+    {
+        writeBlockHeaderMembers(writer, *blockHeader);
+    }
+    auto txSize = _onlyTxHash ? block.transactionsMetaDataSize() : block.transactionsSize();
+    writer.key("transactions").startArray();
+    for (std::size_t index = 0; index < txSize; ++index)
+    {
+        if (_onlyTxHash)
+        {
+            writer.hexValue(block.transactionMetaData(index)->hash().ref());
+        }
+        else
+        {
+            toJsonResp(writer, *block.transaction(index));
+        }
+    }
+    writer.endArray();
+    writer.endObject();
+}
+
+void bcos::rpc::toJsonResp(JsonWriter& writer, std::string_view _txHash,
+    protocol::TransactionStatus status,
+    bcos::protocol::TransactionReceipt const& transactionReceipt, bool _isWasm,
+    crypto::Hash& hashImpl)
+{
+    writer.startObject();
+    writeReceiptMembers(writer, _txHash, status, transactionReceipt, _isWasm, hashImpl);
+    writer.endObject();
+}
+
 void JsonRpcImpl_2_0::call(std::string_view _groupID, std::string_view _nodeName,
     std::string_view _to, std::string_view _data, RespFunc _respFunc)
 {
@@ -728,6 +972,139 @@ void JsonRpcImpl_2_0::getTransactionReceipt(std::string_view _groupID, std::stri
         });
 }
 
+void JsonRpcImpl_2_0::getTransactionRaw(std::string_view _groupID, std::string_view _nodeName,
+    std::string_view _txHash, bool _requireProof, RawRespFunc _respFunc)
+{
+    if (!m_responseCache)
+    {
+        JsonRpcInterface::getTransactionRaw(
+            _groupID, _nodeName, _txHash, _requireProof, std::move(_respFunc));
+        return;
+    }
+    auto cacheKey = responseCacheKey(_groupID, "tx",
+        bcos::crypto::HashType(_txHash, bcos::crypto::HashType::FromHex).hex(), _requireProof);
+    if (auto cached = m_responseCache->get(cacheKey))
+    {
+        _respFunc(nullptr, bcos::bytes(*cached));
+        return;
+    }
+    JsonRpcInterface::getTransactionRaw(_groupID, _nodeName, _txHash, _requireProof,
+        [cache = m_responseCache, cacheKey = std::move(cacheKey),
+            respFunc = std::move(_respFunc)](Error::Ptr _error, bcos::bytes _result) {
+            // the transaction not found responds null which is not cached
+            if (!_error || _error->errorCode() == bcos::protocol::CommonError::SUCCESS)
+            {
+                cache->put(cacheKey, _result);
+            }
+            respFunc(std::move(_error), std::move(_result));
+        });
+}
+
+void JsonRpcImpl_2_0::getTransactionReceiptRaw(std::string_view _groupID,
+    std::string_view _nodeName, std::string_view _txHash, bool _requireProof,
+    RawRespFunc _respFunc)
+{
+    RPC_IMPL_LOG(TRACE) << LOG_DESC("getTransactionReceiptRaw") << LOG_KV("txHash", _txHash)
+                        << LOG_KV("requireProof", _requireProof) << LOG_KV("group", _groupID)
+                        << LOG_KV("node", _nodeName);
+
+    auto hash = bcos::crypto::HashType(_txHash, bcos::crypto::HashType::FromHex);
+    std::string cacheKey;
+    if (m_responseCache)
+    {
+        cacheKey = responseCacheKey(_groupID, "receipt", hash.hex(), _requireProof);
+        if (auto cached = m_responseCache->get(cacheKey))
+        {
+            _respFunc(nullptr, bcos::bytes(*cached));
+            return;
+        }
+    }
+
+    auto nodeService = getNodeService(_groupID, _nodeName, "getTransactionReceipt");
+    auto ledger = nodeService->ledger();
+
+    checkService(ledger, "ledger");
+    auto hashImpl = nodeService->blockFactory()->cryptoSuite()->hashImpl();
+
+    auto groupInfo = m_groupManager->getGroupInfo(_groupID);
+    if (!groupInfo)
+    {
+        BOOST_THROW_EXCEPTION(JsonRpcException(JsonRpcError::GroupNotExist,
+            "The group " + std::string(_groupID) + " does not exist!"));
+    }
+
+    bool isWasm = groupInfo->wasm();
+
+    auto self = std::weak_ptr<JsonRpcImpl_2_0>(shared_from_this());
+    ledger->asyncGetTransactionReceiptByHash(hash, _requireProof,
+        [m_group = std::string(_groupID), m_nodeName = std::string(_nodeName),
+            m_txHash = std::string(_txHash), hash, _requireProof, m_respFunc = std::move(_respFunc),
+            self, hashImpl, isWasm, cache = m_responseCache, cacheKey = std::move(cacheKey)](
+            Error::Ptr _error, protocol::TransactionReceipt::ConstPtr _transactionReceiptPtr,
+            ledger::MerkleProofPtr _merkleProofPtr) mutable {
+            auto rpc = self.lock();
+            if (!rpc)
+            {
+                return;
+            }
+            if (_error && (_error->errorCode() != bcos::protocol::CommonError::SUCCESS))
+            {
+                RPC_IMPL_LOG(INFO)
+                    << LOG_BADGE("getTransactionReceiptRaw failed") << LOG_KV("txHash", m_txHash)
+                    << LOG_KV("requireProof", _requireProof)
+                    << LOG_KV("code", _error ? _error->errorCode() : 0)
+                    << LOG_KV("message", _error ? _error->errorMessage() : "success");
+
+                m_respFunc(_error, {});
+                return;
+            }
+
+            // the receipt is written when the transaction is fetched, the members are the same as
+            // getTransactionReceipt
+            rpc->getTransaction(m_group, m_nodeName, m_txHash, _requireProof,
+                [hash, _requireProof, hashImpl, isWasm, m_txHash,
+                    receipt = std::move(_transactionReceiptPtr),
+                    merkleProof = std::move(_merkleProofPtr), m_respFunc = std::move(m_respFunc),
+                    cache = std::move(cache), cacheKey = std::move(cacheKey)](
+                    bcos::Error::Ptr _error, Json::Value& _jTx) {
+                    if (_error && _error->errorCode() != bcos::protocol::CommonError::SUCCESS)
+                    {
+                        RPC_IMPL_LOG(WARNING)
+                            << LOG_BADGE("getTransactionReceiptRaw") << LOG_DESC("getTransaction")
+                            << LOG_KV("hexPreTxHash", m_txHash)
+                            << LOG_KV("code", _error ? _error->errorCode() : 0)
+                            << LOG_KV("message", _error ? _error->errorMessage() : "success");
+                    }
+                    bcos::bytes result;
+                    JsonWriter writer(result);
+                    writer.startObject();
+                    writeReceiptMembers(writer, hash.hexPrefixed(),
+                        protocol::TransactionStatus::None, *receipt, isWasm, *hashImpl);
+                    if (_requireProof && merkleProof)
+                    {
+                        Json::Value jProof;
+                        addProofToResponse(
+                            jProof, "receiptProof", std::make_shared<ledger::MerkleProof>());
+                        // for compatibility
+                        addProofToResponse(jProof, "txReceiptProof", merkleProof);
+                        writer.member("receiptProof", jProof["receiptProof"]);
+                        writer.member("txReceiptProof", jProof["txReceiptProof"]);
+                    }
+                    auto const& jTx = _jTx;
+                    for (const auto* key : {"input", "from", "to", "extraData", "transactionProof"})
+                    {
+                        writer.member(key, jTx[key]);
+                    }
+                    writer.endObject();
+                    if (cache)
+                    {
+                        cache->put(cacheKey, result);
+                    }
+                    m_respFunc(nullptr, std::move(result));
+                });
+        });
+}
+
 void JsonRpcImpl_2_0::getBlockByHash(std::string_view _groupID, std::string_view _nodeName,
     std::string_view _blockHash, bool _onlyHeader, bool _onlyTxHash, RespFunc _respFunc)
 {
@@ -809,6 +1186,108 @@ void JsonRpcImpl_2_0::getBlockByNumber(std::string_view _groupID, std::string_vi
         });
 }
 
+void JsonRpcImpl_2_0::getBlockByHashRaw(std::string_view _groupID, std::string_view _nodeName,
+    std::string_view _blockHash, bool _onlyHeader, bool _onlyTxHash, RawRespFunc _respFunc)
+{
+    RPC_IMPL_LOG(TRACE) << LOG_DESC("getBlockByHashRaw") << LOG_KV("blockHash", _blockHash)
+                        << LOG_KV("onlyHeader", _onlyHeader) << LOG_KV("onlyTxHash", _onlyTxHash)
+                        << LOG_KV("group", _groupID) << LOG_KV("node", _nodeName);
+
+    auto nodeService = getNodeService(_groupID, _nodeName, "getBlockByHash");
+    auto ledger = nodeService->ledger();
+    checkService(ledger, "ledger");
+    auto self = std::weak_ptr<JsonRpcImpl_2_0>(shared_from_this());
+    ledger->asyncGetBlockNumberByHash(
+        bcos::crypto::HashType(_blockHash, bcos::crypto::HashType::FromHex),
+        [m_groupID = std::string(_groupID), m_nodeName = std::string(_nodeName),
+            m_blockHash = std::string(_blockHash), _onlyHeader, _onlyTxHash,
+            m_respFunc = std::move(_respFunc),
+            self](Error::Ptr _error, protocol::BlockNumber blockNumber) {
+            if (!_error || _error->errorCode() == bcos::protocol::CommonError::SUCCESS)
+            {
+                auto rpc = self.lock();
+                if (rpc)
+                {
+                    return rpc->getBlockByNumberRaw(m_groupID, m_nodeName, blockNumber,
+                        _onlyHeader, _onlyTxHash, std::move(m_respFunc));
+                }
+            }
+            else
+            {
+                RPC_IMPL_LOG(INFO)
+                    << LOG_BADGE("getBlockByHashRaw failed") << LOG_KV("blockHash", m_blockHash)
+                    << LOG_KV("onlyHeader", _onlyHeader) << LOG_KV("onlyTxHash", _onlyTxHash)
+                    << LOG_KV("code", _error ? _error->errorCode() : 0)
+                    << LOG_KV("message", _error ? _error->errorMessage() : "success");
+                m_respFunc(_error, {});
+            }
+        });
+}
+
+void JsonRpcImpl_2_0::getBlockByNumberRaw(std::string_view _groupID, std::string_view _nodeName,
+    int64_t _blockNumber, bool _onlyHeader, bool _onlyTxHash, RawRespFunc _respFunc)
+{
+    RPC_IMPL_LOG(TRACE) << LOG_DESC("getBlockByNumberRaw") << LOG_KV("_blockNumber", _blockNumber)
+                        << LOG_KV("onlyHeader", _onlyHeader) << LOG_KV("onlyTxHash", _onlyTxHash)
+                        << LOG_KV("group", _groupID) << LOG_KV("node", _nodeName);
+
+    auto nodeService = getNodeService(_groupID, _nodeName, "getBlockByNumber");
+    auto ledger = nodeService->ledger();
+    checkService(ledger, "ledger");
+    std::string cacheKey;
+    if (m_responseCache)
+    {
+        cacheKey = responseCacheKey(
+            _groupID, "block", std::to_string(_blockNumber), _onlyHeader, _onlyTxHash);
+        if (auto cached = m_responseCache->get(cacheKey))
+        {
+            _respFunc(nullptr, bcos::bytes(*cached));
+            return;
+        }
+    }
+    auto flag = _onlyHeader ?
+                    bcos::ledger::HEADER :
+                    (_onlyTxHash ? bcos::ledger::HEADER | bcos::ledger::TRANSACTIONS_HASH :
+                                   bcos::ledger::HEADER | bcos::ledger::TRANSACTIONS);
+    ledger->asyncGetBlockDataByNumber(_blockNumber, flag,
+        [_blockNumber, _onlyHeader, _onlyTxHash, m_respFunc = std::move(_respFunc),
+            cache = m_responseCache, cacheKey = std::move(cacheKey)](
+            Error::Ptr _error, protocol::Block::Ptr _block) {
+            bcos::bytes result;
+            if (_error && _error->errorCode() != bcos::protocol::CommonError::SUCCESS)
+            {
+                RPC_IMPL_LOG(INFO)
+                    << LOG_BADGE("getBlockByNumberRaw failed")
+                    << LOG_KV("blockNumber", _blockNumber) << LOG_KV("onlyHeader", _onlyHeader)
+                    << LOG_KV("onlyTxHash", _onlyTxHash)
+                    << LOG_KV("code", _error ? _error->errorCode() : 0)
+                    << LOG_KV("message", _error ? _error->errorMessage() : "success");
+            }
+            else
+            {
+                // the block is written without building the json tree of the transactions
+                JsonWriter writer(result);
+                if (_onlyHeader)
+                {
+                    toJsonResp(writer, _block ? _block->blockHeader() : nullptr);
+                }
+                else if (_block)
+                {
+                    toJsonResp(writer, *_block, _onlyTxHash);
+                }
+                else
+                {
+                    writer.null();
+                }
+                if (cache)
+                {
+                    cache->put(cacheKey, result);
+                }
+            }
+            m_respFunc(_error, std::move(result));
+        });
+}
+
 void JsonRpcImpl_2_0::getBlockHashByNumber(
     std::string_view _groupID, std::string_view _nodeName, int64_t _blockNumber, RespFunc _respFunc)
 {
@@ -1488,32 +1967,50 @@ void JsonRpcImpl_2_0::uninstallFilter(
 void JsonRpcImpl_2_0::getFilterChanges(
     std::string_view _groupID, std::string_view filterID, RespFunc _respFunc)
 {
-    task::wait([](JsonRpcImpl_2_0* self, std::string_view groupID, u256 id,
-                   RespFunc respFunc) -> task::Task<void> {
-        Json::Value jRes = co_await self->filterSystem().getFilterChanges(groupID, id);
-        respFunc(nullptr, jRes);
-    }(this, _groupID, fromBigQuantity(filterID), std::move(_respFunc)));
+    getFilterChangesRaw(_groupID, filterID, toJsonRespFunc(std::move(_respFunc)));
 }
 
 void JsonRpcImpl_2_0::getFilterLogs(
     std::string_view _groupID, std::string_view filterID, RespFunc _respFunc)
 {
-    task::wait([](JsonRpcImpl_2_0* self, std::string_view groupID, u256 id,
-                   RespFunc respFunc) -> task::Task<void> {
-        Json::Value jRes = co_await self->filterSystem().getFilterLogs(groupID, id);
-        respFunc(nullptr, jRes);
-    }(this, _groupID, fromBigQuantity(filterID), std::move(_respFunc)));
+    getFilterLogsRaw(_groupID, filterID, toJsonRespFunc(std::move(_respFunc)));
 }
 
 void JsonRpcImpl_2_0::getLogs(
     std::string_view _groupID, const Json::Value& jParams, RespFunc _respFunc)
+{
+    getLogsRaw(_groupID, jParams, toJsonRespFunc(std::move(_respFunc)));
+}
+
+void JsonRpcImpl_2_0::getFilterChangesRaw(
+    std::string_view _groupID, std::string_view filterID, RawRespFunc _respFunc)
+{
+    task::wait([](JsonRpcImpl_2_0* self, std::string_view groupID, u256 id,
+                   RawRespFunc respFunc) -> task::Task<void> {
+        auto result = co_await self->filterSystem().getFilterChanges(groupID, id);
+        respFunc(nullptr, std::move(result));
+    }(this, _groupID, fromBigQuantity(filterID), std::move(_respFunc)));
+}
+
+void JsonRpcImpl_2_0::getFilterLogsRaw(
+    std::string_view _groupID, std::string_view filterID, RawRespFunc _respFunc)
+{
+    task::wait([](JsonRpcImpl_2_0* self, std::string_view groupID, u256 id,
+                   RawRespFunc respFunc) -> task::Task<void> {
+        auto result = co_await self->filterSystem().getFilterLogs(groupID, id);
+        respFunc(nullptr, std::move(result));
+    }(this, _groupID, fromBigQuantity(filterID), std::move(_respFunc)));
+}
+
+void JsonRpcImpl_2_0::getLogsRaw(
+    std::string_view _groupID, const Json::Value& jParams, RawRespFunc _respFunc)
 {
     task::wait([](JsonRpcImpl_2_0* self, std::string_view groupID, const Json::Value& jParams,
-                   RespFunc respFunc) -> task::Task<void> {
+                   RawRespFunc respFunc) -> task::Task<void> {
         auto params = self->filterSystem().requestFactory()->create();
         params->fromJson(jParams);
-        Json::Value jRes = co_await self->filterSystem().getLogs(groupID, std::move(params));
-        respFunc(nullptr, jRes);
+        auto result = co_await self->filterSystem().getLogs(groupID, std::move(params));
+        respFunc(nullptr, std::move(result));
     }(this, _groupID, jParams, std::move(_respFunc)));
 }
 
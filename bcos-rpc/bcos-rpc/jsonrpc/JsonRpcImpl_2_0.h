@@ -27,6 +27,8 @@
 #include <bcos-framework/gateway/GatewayInterface.h>
 #include <bcos-rpc/filter/FilterSystem.h>
 #include <bcos-rpc/jsonrpc/JsonRpcInterface.h>
+#include <bcos-rpc/jsonrpc/JsonWriter.h>
+#include <bcos-rpc/jsonrpc/ResponseCache.h>
 #include <json/json.h>
 #include <tbb/concurrent_hash_map.h>
 #include <boost/core/ignore_unused.hpp>
@@ -68,6 +70,19 @@ public:
     void getBlockByNumber(std::string_view _groupID, std::string_view _nodeName,
         int64_t _blockNumber, bool _onlyHeader, bool _onlyTxHash, RespFunc _respFunc) override;
 
+    void getBlockByHashRaw(std::string_view _groupID, std::string_view _nodeName,
+        std::string_view _blockHash, bool _onlyHeader, bool _onlyTxHash,
+        RawRespFunc _respFunc) override;
+
+    void getBlockByNumberRaw(std::string_view _groupID, std::string_view _nodeName,
+        int64_t _blockNumber, bool _onlyHeader, bool _onlyTxHash, RawRespFunc _respFunc) override;
+
+    void getTransactionRaw(std::string_view _groupID, std::string_view _nodeName,
+        std::string_view _txHash, bool _requireProof, RawRespFunc _respFunc) override;
+
+    void getTransactionReceiptRaw(std::string_view _groupID, std::string_view _nodeName,
+        std::string_view _txHash, bool _requireProof, RawRespFunc _respFunc) override;
+
     void getBlockHashByNumber(std::string_view _groupID, std::string_view _nodeName,
         int64_t _blockNumber, RespFunc _respFunc) override;
 
@@ -131,6 +146,12 @@ public:
     void getFilterLogs(
         std::string_view _groupID, std::string_view filterID, RespFunc _respFunc) override;
     void getLogs(std::string_view _groupID, const Json::Value& params, RespFunc _respFunc) override;
+    void getFilterChangesRaw(
+        std::string_view _groupID, std::string_view filterID, RawRespFunc _respFunc) override;
+    void getFilterLogsRaw(
+        std::string_view _groupID, std::string_view filterID, RawRespFunc _respFunc) override;
+    void getLogsRaw(
+        std::string_view _groupID, const Json::Value& params, RawRespFunc _respFunc) override;
 
     void getGroupBlockNumber(RespFunc _respFunc) override;
 
@@ -141,6 +162,13 @@ public:
     int sendTxTimeout() const { return m_sendTxTimeout; }
     void setSendTxTimeout(int _sendTxTimeout) { m_sendTxTimeout = _sendTxTimeout; }
 
+    // the serialized blocks, transactions and receipts are cached if set
+    ResponseCache::Ptr responseCache() const { return m_responseCache; }
+    void setResponseCache(ResponseCache::Ptr _responseCache)
+    {
+        m_responseCache = std::move(_responseCache);
+    }
+
 protected:
     static bcos::bytes decodeData(std::string_view _data);
 
@@ -182,6 +210,7 @@ protected:
 
     // ms
     int m_sendTxTimeout = -1;
+    ResponseCache::Ptr m_responseCache;
 
     GroupManager::Ptr m_groupManager;
     bcos::gateway::GatewayInterface::Ptr m_gatewayInterface;
@@ -212,5 +241,12 @@ void toJsonResp(Json::Value& jResp, bcos::protocol::Block& block, bool _onlyTxHa
 void toJsonResp(Json::Value& jResp, std::string_view _txHash, protocol::TransactionStatus status,
     bcos::protocol::TransactionReceipt const& transactionReceiptPtr, bool _isWasm,
     crypto::Hash& hashImpl);
+// write the same json as the Json::Value versions into the response buffer directly
+void toJsonResp(JsonWriter& writer, bcos::protocol::Transaction const& transaction);
+void toJsonResp(JsonWriter& writer, bcos::protocol::BlockHeader::Ptr _blockHeaderPtr);
+void toJsonResp(JsonWriter& writer, bcos::protocol::Block& block, bool _onlyTxHash);
+void toJsonResp(JsonWriter& writer, std::string_view _txHash, protocol::TransactionStatus status,
+    bcos::protocol::TransactionReceipt const& transactionReceipt, bool _isWasm,
+    crypto::Hash& hashImpl);
 
 }  // namespace bcos::rpc
\ No newline at end of file
@@ -1,13 +1,8 @@
 #include "JsonRpcInterface.h"
+#include "JsonReader.h"
+#include "JsonWriter.h"
 #include <json/forwards.h>
-#include <boost/beast/core/ostream.hpp>
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/device/back_inserter.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
-#include <boost/iostreams/stream.hpp>
 #include <iterator>
-#include <ostream>
-#include <sstream>
 
 using namespace bcos::rpc;
 
@@ -17,13 +12,14 @@ void JsonRpcInterface::initMethod()
         std::bind(&JsonRpcInterface::callI, this, std::placeholders::_1, std::placeholders::_2);
     m_methodToFunc["sendTransaction"] = std::bind(
         &JsonRpcInterface::sendTransactionI, this, std::placeholders::_1, std::placeholders::_2);
-    m_methodToFunc["getTransaction"] = std::bind(
+    m_methodToRawFunc["getTransaction"] = std::bind(
         &JsonRpcInterface::getTransactionI, this, std::placeholders::_1, std::placeholders::_2);
-    m_methodToFunc["getTransactionReceipt"] = std::bind(&JsonRpcInterface::getTransactionReceiptI,
-        this, std::placeholders::_1, std::placeholders::_2);
-    m_methodToFunc["getBlockByHash"] = std::bind(
+    m_methodToRawFunc["getTransactionReceipt"] =
+        std::bind(&JsonRpcInterface::getTransactionReceiptI, this, std::placeholders::_1,
+            std::placeholders::_2);
+    m_methodToRawFunc["getBlockByHash"] = std::bind(
         &JsonRpcInterface::getBlockByHashI, this, std::placeholders::_1, std::placeholders::_2);
-    m_methodToFunc["getBlockByNumber"] = std::bind(
+    m_methodToRawFunc["getBlockByNumber"] = std::bind(
         &JsonRpcInterface::getBlockByNumberI, this, std::placeholders::_1, std::placeholders::_2);
     m_methodToFunc["getBlockHashByNumber"] = std::bind(&JsonRpcInterface::getBlockHashByNumberI,
         this, std::placeholders::_1, std::placeholders::_2);
@@ -76,42 +72,230 @@ void JsonRpcInterface::initMethod()
         &JsonRpcInterface::newFilterI, this, std::placeholders::_1, std::placeholders::_2);
     m_methodToFunc["uninstallFilter"] = std::bind(
         &JsonRpcInterface::uninstallFilterI, this, std::placeholders::_1, std::placeholders::_2);
-    m_methodToFunc["getFilterChanges"] = std::bind(
+    m_methodToRawFunc["getFilterChanges"] = std::bind(
         &JsonRpcInterface::getFilterChangesI, this, std::placeholders::_1, std::placeholders::_2);
-    m_methodToFunc["getFilterLogs"] = std::bind(
+    m_methodToRawFunc["getFilterLogs"] = std::bind(
         &JsonRpcInterface::getFilterLogsI, this, std::placeholders::_1, std::placeholders::_2);
-    m_methodToFunc["getLogs"] =
+    m_methodToRawFunc["getLogs"] =
         std::bind(&JsonRpcInterface::getLogsI, this, std::placeholders::_1, std::placeholders::_2);
 
     for (const auto& method : m_methodToFunc)
     {
         RPC_IMPL_LOG(INFO) << LOG_BADGE("initMethod") << LOG_KV("method", method.first);
     }
-    RPC_IMPL_LOG(INFO) << LOG_BADGE("initMethod") << LOG_KV("size", m_methodToFunc.size());
+    for (const auto& method : m_methodToRawFunc)
+    {
+        RPC_IMPL_LOG(INFO) << LOG_BADGE("initMethod") << LOG_KV("method", method.first);
+    }
+    RPC_IMPL_LOG(INFO) << LOG_BADGE("initMethod")
+                       << LOG_KV("size", m_methodToFunc.size() + m_methodToRawFunc.size());
+}
+
+void JsonRpcInterface::getBlockByHashRaw(std::string_view _groupID, std::string_view _nodeName,
+    std::string_view _blockHash, bool _onlyHeader, bool _onlyTxHash, RawRespFunc _respFunc)
+{
+    getBlockByHash(_groupID, _nodeName, _blockHash, _onlyHeader, _onlyTxHash,
+        [respFunc = std::move(_respFunc)](Error::Ptr _error, Json::Value& _result) {
+            bcos::bytes result;
+            JsonWriter(result).value(_result);
+            respFunc(std::move(_error), std::move(result));
+        });
+}
+
+void JsonRpcInterface::getBlockByNumberRaw(std::string_view _groupID, std::string_view _nodeName,
+    int64_t _blockNumber, bool _onlyHeader, bool _onlyTxHash, RawRespFunc _respFunc)
+{
+    getBlockByNumber(_groupID, _nodeName, _blockNumber, _onlyHeader, _onlyTxHash,
+        [respFunc = std::move(_respFunc)](Error::Ptr _error, Json::Value& _result) {
+            bcos::bytes result;
+            JsonWriter(result).value(_result);
+            respFunc(std::move(_error), std::move(result));
+        });
+}
+
+void JsonRpcInterface::getTransactionRaw(std::string_view _groupID, std::string_view _nodeName,
+    std::string_view _txHash, bool _requireProof, RawRespFunc _respFunc)
+{
+    getTransaction(_groupID, _nodeName, _txHash, _requireProof,
+        [respFunc = std::move(_respFunc)](Error::Ptr _error, Json::Value& _result) {
+            bcos::bytes result;
+            JsonWriter(result).value(_result);
+            respFunc(std::move(_error), std::move(result));
+        });
+}
+
+void JsonRpcInterface::getTransactionReceiptRaw(std::string_view _groupID,
+    std::string_view _nodeName, std::string_view _txHash, bool _requireProof,
+    RawRespFunc _respFunc)
+{
+    getTransactionReceipt(_groupID, _nodeName, _txHash, _requireProof,
+        [respFunc = std::move(_respFunc)](Error::Ptr _error, Json::Value& _result) {
+            bcos::bytes result;
+            JsonWriter(result).value(_result);
+            respFunc(std::move(_error), std::move(result));
+        });
+}
+
+void JsonRpcInterface::getFilterChangesRaw(
+    std::string_view _groupID, std::string_view filterID, RawRespFunc _respFunc)
+{
+    getFilterChanges(_groupID, filterID,
+        [respFunc = std::move(_respFunc)](Error::Ptr _error, Json::Value& _result) {
+            bcos::bytes result;
+            JsonWriter(result).value(_result);
+            respFunc(std::move(_error), std::move(result));
+        });
+}
+
+void JsonRpcInterface::getFilterLogsRaw(
+    std::string_view _groupID, std::string_view filterID, RawRespFunc _respFunc)
+{
+    getFilterLogs(_groupID, filterID,
+        [respFunc = std::move(_respFunc)](Error::Ptr _error, Json::Value& _result) {
+            bcos::bytes result;
+            JsonWriter(result).value(_result);
+            respFunc(std::move(_error), std::move(result));
+        });
+}
+
+void JsonRpcInterface::getLogsRaw(
+    std::string_view _groupID, const Json::Value& params, RawRespFunc _respFunc)
+{
+    getLogs(_groupID, params,
+        [respFunc = std::move(_respFunc)](Error::Ptr _error, Json::Value& _result) {
+            bcos::bytes result;
+            JsonWriter(result).value(_result);
+            respFunc(std::move(_error), std::move(result));
+        });
 }
 
 void JsonRpcInterface::onRPCRequest(std::string_view _requestBody, Sender _sender)
+{
+    if (isBatchRequest(_requestBody))
+    {
+        onBatchRPCRequest(_requestBody, std::move(_sender));
+        return;
+    }
+    handleRequest(
+        [_requestBody](JsonRequest& _request) { parseRpcRequestJson(_requestBody, _request); },
+        _requestBody, std::move(_sender));
+}
+
+void JsonRpcInterface::onBatchRPCRequest(std::string_view _requestBody, Sender _sender)
+{
+    auto requests = std::make_shared<Json::Value>();
+    JsonResponse response;
+    try
+    {
+        if (!parseJson(_requestBody, *requests) || !requests->isArray() || requests->empty())
+        {
+            BOOST_THROW_EXCEPTION(JsonRpcException(
+                JsonRpcError::InvalidRequest, "The JSON sent is not a valid Request object."));
+        }
+        if (requests->size() > m_batchConfig.maxSize)
+        {
+            BOOST_THROW_EXCEPTION(JsonRpcException(JsonRpcError::InvalidRequest,
+                "The batch size exceeds the limit " + std::to_string(m_batchConfig.maxSize)));
+        }
+    }
+    catch (const JsonRpcException& e)
+    {
+        response.error.code = e.code();
+        response.error.message = std::string(e.what());
+    }
+    catch (const std::exception& e)
+    {
+        RPC_IMPL_LOG(ERROR) << LOG_BADGE("onBatchRPCRequest")
+                            << LOG_KV("message", boost::diagnostic_information(e));
+        response.error.code = JsonRpcError::ParseError;
+        response.error.message = "Invalid JSON was received by the server.";
+    }
+    if (response.error.code != 0)
+    {
+        auto strResp = toStringResponse(std::move(response));
+        RPC_IMPL_LOG(DEBUG) << LOG_BADGE("onBatchRPCRequest") << LOG_DESC("invalid batch request")
+                            << LOG_KV("size", requests->isArray() ? requests->size() : 0)
+                            << LOG_KV("response",
+                                   std::string_view((const char*)strResp.data(), strResp.size()));
+        _sender(std::move(strResp));
+        return;
+    }
+    if (c_fileLogLevel == TRACE) [[unlikely]]
+    {
+        RPC_IMPL_LOG(TRACE) << LOG_BADGE("onBatchRPCRequest") << LOG_KV("request", _requestBody);
+    }
+    auto batch = std::make_shared<JsonRpcBatch>(
+        requests->size(), m_batchConfig,
+        [this, requests](size_t _index, Sender _itemSender) {
+            auto const& item = (*requests)[(Json::ArrayIndex)_index];
+            handleRequest([&item](JsonRequest& _request) { parseRpcRequestJson(item, _request); },
+                {}, std::move(_itemSender));
+        },
+        [requests](size_t _index) {
+            JsonResponse timeoutResponse;
+            auto const& item = (*requests)[(Json::ArrayIndex)_index];
+            if (item.isObject() && item["jsonrpc"].isString() && item["id"].isInt64())
+            {
+                timeoutResponse.jsonrpc = item["jsonrpc"].asString();
+                timeoutResponse.id = item["id"].asInt64();
+            }
+            timeoutResponse.error.code = JsonRpcError::InternalError;
+            timeoutResponse.error.message = "The batch request timeout";
+            return toStringResponse(std::move(timeoutResponse));
+        },
+        std::move(_sender));
+    batch->start();
+}
+
+void JsonRpcInterface::handleRequest(std::function<void(JsonRequest&)> const& _parser,
+    std::string_view _requestBody, Sender _sender)
 {
     JsonRequest request;
     JsonResponse response;
     try
     {
-        parseRpcRequestJson(_requestBody, request);
+        _parser(request);
 
         response.jsonrpc = request.jsonrpc;
         response.id = request.id;
 
         const auto& method = request.method;
+        if (c_fileLogLevel == TRACE) [[unlikely]]
+        {
+            RPC_IMPL_LOG(TRACE) << LOG_BADGE("onRPCRequest") << LOG_KV("request", _requestBody);
+        }
+        if (auto rawIt = m_methodToRawFunc.find(method); rawIt != m_methodToRawFunc.end())
+        {
+            rawIt->second(request.params,
+                [response, _sender](Error::Ptr _error, bcos::bytes _result) mutable {
+                    bcos::bytes strResp;
+                    if (_error && (_error->errorCode() != bcos::protocol::CommonError::SUCCESS))
+                    {
+                        response.error.code = _error->errorCode();
+                        response.error.message = _error->errorMessage();
+                        strResp = toStringResponse(std::move(response));
+                    }
+                    else
+                    {
+                        strResp = toStringResponse(response, _result);
+                    }
+                    if (c_fileLogLevel == TRACE) [[unlikely]]
+                    {
+                        RPC_IMPL_LOG(TRACE)
+                            << LOG_BADGE("onRPCRequest")
+                            << LOG_KV("response",
+                                   std::string_view((const char*)strResp.data(), strResp.size()));
+                    }
+                    _sender(std::move(strResp));
+                });
+            return;
+        }
         auto it = m_methodToFunc.find(method);
         if (it == m_methodToFunc.end())
         {
             BOOST_THROW_EXCEPTION(JsonRpcException(
                 JsonRpcError::MethodNotFound, "The method does not exist/is not available."));
         }
-        if (c_fileLogLevel == TRACE) [[unlikely]]
-        {
-            RPC_IMPL_LOG(TRACE) << LOG_BADGE("onRPCRequest") << LOG_KV("request", _requestBody);
-        }
         it->second(
             request.params, [response, _sender](Error::Ptr _error, Json::Value& _result) mutable {
                 if (_error && (_error->errorCode() != bcos::protocol::CommonError::SUCCESS))
@@ -169,66 +353,18 @@ void JsonRpcInterface::onRPCRequest(std::string_view _requestBody, Sender _sende
 void bcos::rpc::parseRpcRequestJson(std::string_view _requestBody, JsonRequest& _jsonRequest)
 {
     Json::Value root;
-    Json::Reader jsonReader;
-    std::string errorMessage;
-
     try
     {
-        std::string jsonrpc = "";
-        std::string method = "";
-        int64_t id = 0;
-        do
+        if (parseJson(_requestBody, root))
         {
-            if (!jsonReader.parse(_requestBody.begin(), _requestBody.end(), root))
-            {
-                errorMessage = "invalid request json object";
-                break;
-            }
-
-            if (!root.isMember("jsonrpc"))
-            {
-                errorMessage = "request has no jsonrpc field";
-                break;
-            }
-            jsonrpc = root["jsonrpc"].asString();
-
-            if (!root.isMember("method"))
-            {
-                errorMessage = "request has no method field";
-                break;
-            }
-            method = root["method"].asString();
-
-            if (root.isMember("id"))
-            {
-                id = root["id"].asInt64();
-            }
-
-            if (!root.isMember("params"))
-            {
-                errorMessage = "request has no params field";
-                break;
-            }
-
-            if (!root["params"].isArray())
-            {
-                errorMessage = "request params is not array object";
-                break;
-            }
-
-            auto jParams = root["params"];
-
-            _jsonRequest.jsonrpc = jsonrpc;
-            _jsonRequest.method = method;
-            _jsonRequest.id = id;
-            _jsonRequest.params = jParams;
-
-            // RPC_IMPL_LOG(DEBUG) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("method", method)
-            //                     << LOG_KV("requestMessage", _requestBody);
-
-            // success return
+            parseRpcRequestJson(root, _jsonRequest);
             return;
-        } while (0);
+        }
+    }
+    catch (const JsonRpcException&)
+    {
+        RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("request", _requestBody);
+        throw;
     }
     catch (const std::exception& e)
     {
@@ -239,42 +375,95 @@ void bcos::rpc::parseRpcRequestJson(std::string_view _requestBody, JsonRequest&
     }
 
     RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("request", _requestBody)
-                        << LOG_KV("message", errorMessage);
+                        << LOG_KV("message", "invalid request json object");
 
     BOOST_THROW_EXCEPTION(JsonRpcException(
         JsonRpcError::InvalidRequest, "The JSON sent is not a valid Request object."));
 }
 
-
-bcos::bytes bcos::rpc::toStringResponse(JsonResponse _jsonResponse)
+void bcos::rpc::parseRpcRequestJson(const Json::Value& _root, JsonRequest& _jsonRequest)
 {
-    auto jResp = toJsonResponse(std::move(_jsonResponse));
-    auto builder = Json::StreamWriterBuilder();
-    builder["commentStyle"] = "None";
-    builder["indentation"] = "";
-    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
-    class JsonSink
+    std::string errorMessage;
+    do
     {
-    public:
-        typedef char char_type;
-        typedef boost::iostreams::sink_tag category;
+        if (!_root.isObject())
+        {
+            errorMessage = "request is not json object";
+            break;
+        }
+
+        if (!_root.isMember("jsonrpc"))
+        {
+            errorMessage = "request has no jsonrpc field";
+            break;
+        }
+
+        if (!_root.isMember("method"))
+        {
+            errorMessage = "request has no method field";
+            break;
+        }
+
+        if (!_root.isMember("params"))
+        {
+            errorMessage = "request has no params field";
+            break;
+        }
 
-        JsonSink(bcos::bytes& buffer) : m_buffer(buffer) {}
+        if (!_root["params"].isArray())
+        {
+            errorMessage = "request params is not array object";
+            break;
+        }
 
-        std::streamsize write(const char* s, std::streamsize n)
+        try
+        {
+            _jsonRequest.jsonrpc = _root["jsonrpc"].asString();
+            _jsonRequest.method = _root["method"].asString();
+            _jsonRequest.id = _root.isMember("id") ? _root["id"].asInt64() : 0;
+        }
+        catch (const std::exception& e)
         {
-            m_buffer.insert(m_buffer.end(), (bcos::byte*)s, (bcos::byte*)s + n);
-            return n;
+            RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson")
+                                << LOG_KV("message", boost::diagnostic_information(e));
+            BOOST_THROW_EXCEPTION(JsonRpcException(
+                JsonRpcError::ParseError, "Invalid JSON was received by the server."));
         }
+        _jsonRequest.params = _root["params"];
+
+        // success return
+        return;
+    } while (0);
+
+    RPC_IMPL_LOG(ERROR) << LOG_BADGE("parseRpcRequestJson") << LOG_KV("message", errorMessage);
+
+    BOOST_THROW_EXCEPTION(JsonRpcException(
+        JsonRpcError::InvalidRequest, "The JSON sent is not a valid Request object."));
+}
 
-        bcos::bytes& m_buffer;
-    };
 
+bcos::bytes bcos::rpc::toStringResponse(JsonResponse _jsonResponse)
+{
+    auto jResp = toJsonResponse(std::move(_jsonResponse));
     bcos::bytes out;
-    boost::iostreams::stream<JsonSink> outputStream(out);
+    JsonWriter(out).value(jResp);
+    return out;
+}
 
-    writer->write(jResp, &outputStream);
-    writer.reset();
+bcos::bytes bcos::rpc::toStringResponse(
+    JsonResponse const& _jsonResponse, bcos::bytes const& _result)
+{
+    bcos::bytes out;
+    out.reserve(_result.size() + _jsonResponse.jsonrpc.size() + 48);
+    JsonWriter writer(out);
+    // the same members in the same order as toJsonResponse serialized
+    writer.startObject()
+        .member("id", _jsonResponse.id)
+        .member("jsonrpc", std::string_view(_jsonResponse.jsonrpc))
+        .key("result")
+        .raw(_result.empty() ? std::string_view("null") :
+                               std::string_view((const char*)_result.data(), _result.size()))
+        .endObject();
     return out;
 }
 
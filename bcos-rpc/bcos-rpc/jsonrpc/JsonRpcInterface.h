@@ -24,6 +24,7 @@
 #include <bcos-framework/multigroup/GroupInfo.h>
 #include <bcos-framework/protocol/CommonError.h>
 #include <bcos-rpc/jsonrpc/Common.h>
+#include <bcos-rpc/jsonrpc/JsonRpcBatch.h>
 #include <bcos-utilities/Error.h>
 #include <json/json.h>
 #include <util/tc_json.h>
@@ -35,6 +36,10 @@ namespace bcos::rpc
 using Sender = std::function<void(bcos::bytes)>;
 using RespFunc = std::function<void(bcos::Error::Ptr, Json::Value&)>;
 using MethodMap = std::unordered_map<std::string, std::function<void(Json::Value&, RespFunc)>>;
+// response with the result already serialized, used by the methods returning the large result
+using RawRespFunc = std::function<void(bcos::Error::Ptr, bcos::bytes)>;
+using RawMethodMap =
+    std::unordered_map<std::string, std::function<void(Json::Value&, RawRespFunc)>>;
 
 class JsonRpcInterface
 {
@@ -69,6 +74,21 @@ public:
     virtual void getBlockByNumber(std::string_view _groupID, std::string_view _nodeName,
         int64_t _blockNumber, bool _onlyHeader, bool _onlyTxHash, RespFunc _respFunc) = 0;
 
+    // the block with the full transactions is written into the response buffer directly, the
+    // default implementation serializes the result of getBlockByHash/getBlockByNumber
+    virtual void getBlockByHashRaw(std::string_view _groupID, std::string_view _nodeName,
+        std::string_view _blockHash, bool _onlyHeader, bool _onlyTxHash, RawRespFunc _respFunc);
+
+    virtual void getBlockByNumberRaw(std::string_view _groupID, std::string_view _nodeName,
+        int64_t _blockNumber, bool _onlyHeader, bool _onlyTxHash, RawRespFunc _respFunc);
+
+    // the default implementation serializes the result of getTransaction/getTransactionReceipt
+    virtual void getTransactionRaw(std::string_view _groupID, std::string_view _nodeName,
+        std::string_view _txHash, bool _requireProof, RawRespFunc _respFunc);
+
+    virtual void getTransactionReceiptRaw(std::string_view _groupID, std::string_view _nodeName,
+        std::string_view _txHash, bool _requireProof, RawRespFunc _respFunc);
+
     virtual void getBlockHashByNumber(std::string_view _groupID, std::string_view _nodeName,
         int64_t _blockNumber, RespFunc _respFunc) = 0;
 
@@ -134,13 +154,31 @@ public:
         std::string_view _groupID, std::string_view filterID, RespFunc _respFunc) = 0;
     virtual void getLogs(
         std::string_view _groupID, const Json::Value& params, RespFunc _respFunc) = 0;
+    // the logs are written into the response buffer directly, the default implementation
+    // serializes the result of getFilterChanges/getFilterLogs/getLogs
+    virtual void getFilterChangesRaw(
+        std::string_view _groupID, std::string_view filterID, RawRespFunc _respFunc);
+    virtual void getFilterLogsRaw(
+        std::string_view _groupID, std::string_view filterID, RawRespFunc _respFunc);
+    virtual void getLogsRaw(
+        std::string_view _groupID, const Json::Value& params, RawRespFunc _respFunc);
 
     void onRPCRequest(std::string_view _requestBody, Sender _sender);
 
+    void setBatchConfig(JsonRpcBatchConfig const& _batchConfig) { m_batchConfig = _batchConfig; }
+
 protected:
     void initMethod();
 
+    // the request parsed by _parser, the request body is only used in the log
+    void handleRequest(std::function<void(JsonRequest&)> const& _parser,
+        std::string_view _requestBody, Sender _sender);
+    void onBatchRPCRequest(std::string_view _requestBody, Sender _sender);
+
     MethodMap m_methodToFunc;
+    // the methods responding with the serialized result, checked before m_methodToFunc
+    RawMethodMap m_methodToRawFunc;
+    JsonRpcBatchConfig m_batchConfig;
 
 
     std::string_view toView(const Json::Value& value)
@@ -175,28 +213,28 @@ protected:
             std::move(_respFunc));
     }
 
-    void getTransactionI(const Json::Value& req, RespFunc _respFunc)
+    void getTransactionI(const Json::Value& req, RawRespFunc _respFunc)
     {
-        getTransaction(toView(req[0u]), toView(req[1u]), toView(req[2u]), req[3u].asBool(),
+        getTransactionRaw(toView(req[0u]), toView(req[1u]), toView(req[2u]), req[3u].asBool(),
             std::move(_respFunc));
     }
 
-    void getTransactionReceiptI(const Json::Value& req, RespFunc _respFunc)
+    void getTransactionReceiptI(const Json::Value& req, RawRespFunc _respFunc)
     {
-        getTransactionReceipt(toView(req[0u]), toView(req[1u]), toView(req[2u]), req[3u].asBool(),
-            std::move(_respFunc));
+        getTransactionReceiptRaw(toView(req[0u]), toView(req[1u]), toView(req[2u]),
+            req[3u].asBool(), std::move(_respFunc));
     }
 
-    void getBlockByHashI(const Json::Value& req, RespFunc _respFunc)
+    void getBlockByHashI(const Json::Value& req, RawRespFunc _respFunc)
     {
-        getBlockByHash(toView(req[0u]), toView(req[1u]), toView(req[2u]),
+        getBlockByHashRaw(toView(req[0u]), toView(req[1u]), toView(req[2u]),
             (req.size() > 3 ? req[3u].asBool() : true), (req.size() > 4 ? req[4u].asBool() : true),
             std::move(_respFunc));
     }
 
-    void getBlockByNumberI(const Json::Value& req, RespFunc _respFunc)
+    void getBlockByNumberI(const Json::Value& req, RawRespFunc _respFunc)
     {
-        getBlockByNumber(toView(req[0u]), toView(req[1u]), req[2u].asInt64(),
+        getBlockByNumberRaw(toView(req[0u]), toView(req[1u]), req[2u].asInt64(),
             (req.size() > 3 ? req[3u].asBool() : true), (req.size() > 4 ? req[4u].asBool() : true),
             std::move(_respFunc));
     }
@@ -319,21 +357,25 @@ protected:
     {
         uninstallFilter(toView(_req[0u]), toView(_req[1u]), std::move(_respFunc));
     }
-    void getFilterChangesI(const Json::Value& _req, RespFunc _respFunc)
+    void getFilterChangesI(const Json::Value& _req, RawRespFunc _respFunc)
     {
-        getFilterChanges(toView(_req[0u]), toView(_req[1u]), std::move(_respFunc));
+        getFilterChangesRaw(toView(_req[0u]), toView(_req[1u]), std::move(_respFunc));
     }
-    void getFilterLogsI(const Json::Value& _req, RespFunc _respFunc)
+    void getFilterLogsI(const Json::Value& _req, RawRespFunc _respFunc)
     {
-        getFilterLogs(toView(_req[0u]), toView(_req[1u]), std::move(_respFunc));
+        getFilterLogsRaw(toView(_req[0u]), toView(_req[1u]), std::move(_respFunc));
     }
-    void getLogsI(const Json::Value& _req, RespFunc _respFunc)
+    void getLogsI(const Json::Value& _req, RawRespFunc _respFunc)
     {
-        getLogs(toView(_req[0u]), _req[1u], std::move(_respFunc));
+        getLogsRaw(toView(_req[0u]), _req[1u], std::move(_respFunc));
     }
 };
 void parseRpcRequestJson(std::string_view _requestBody, JsonRequest& _jsonRequest);
+// parse the request already decoded, e.g. the item of the batch request
+void parseRpcRequestJson(const Json::Value& _root, JsonRequest& _jsonRequest);
 bcos::bytes toStringResponse(JsonResponse _jsonResponse);
+// the success response with the serialized result
+bcos::bytes toStringResponse(JsonResponse const& _jsonResponse, bcos::bytes const& _result);
 Json::Value toJsonResponse(JsonResponse _jsonResponse);
 
 
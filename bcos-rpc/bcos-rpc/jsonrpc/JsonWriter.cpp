@@ -0,0 +1,325 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file JsonWriter.cpp
+ */
+
+#include <bcos-rpc/jsonrpc/JsonWriter.h>
+#include <bcos-utilities/DataConvertUtility.h>
+#include <cmath>
+#include <cstring>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+void JsonWriter::separator()
+{
+    if (m_afterKey)
+    {
+        m_afterKey = false;
+        return;
+    }
+    if (m_hasElement.empty())
+    {
+        return;
+    }
+    if (m_hasElement.back())
+    {
+        m_buffer.push_back(',');
+    }
+    m_hasElement.back() = true;
+}
+
+JsonWriter& JsonWriter::startObject()
+{
+    separator();
+    m_buffer.push_back('{');
+    m_hasElement.push_back(false);
+    return *this;
+}
+
+JsonWriter& JsonWriter::endObject()
+{
+    m_hasElement.pop_back();
+    m_buffer.push_back('}');
+    return *this;
+}
+
+JsonWriter& JsonWriter::startArray()
+{
+    separator();
+    m_buffer.push_back('[');
+    m_hasElement.push_back(false);
+    return *this;
+}
+
+JsonWriter& JsonWriter::endArray()
+{
+    m_hasElement.pop_back();
+    m_buffer.push_back(']');
+    return *this;
+}
+
+JsonWriter& JsonWriter::key(std::string_view _key)
+{
+    separator();
+    appendString(_key);
+    m_buffer.push_back(':');
+    m_afterKey = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(std::string_view _value)
+{
+    separator();
+    appendString(_value);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(bool _value)
+{
+    separator();
+    append(_value ? "true" : "false");
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(double _value)
+{
+    separator();
+    // the same as jsoncpp: 17 significant digits, ".0" after the integral value, the infinity out
+    // of the range of double
+    if (std::isnan(_value))
+    {
+        append("null");
+        return *this;
+    }
+    if (std::isinf(_value))
+    {
+        append(_value < 0 ? "-1e+9999" : "1e+9999");
+        return *this;
+    }
+    char buffer[32];
+    auto result = std::to_chars(
+        std::begin(buffer), std::end(buffer), _value, std::chars_format::general, 17);
+    std::string_view number(buffer, result.ptr - buffer);
+    append(number);
+    if (number.find_first_of(".e") == std::string_view::npos)
+    {
+        append(".0");
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::null()
+{
+    separator();
+    append("null");
+    return *this;
+}
+
+JsonWriter& JsonWriter::hexValue(bcos::bytesConstRef _value)
+{
+    separator();
+    auto offset = m_buffer.size();
+    m_buffer.resize(offset + _value.size() * 2 + 4);
+    auto* output = (char*)m_buffer.data() + offset;
+    std::memcpy(output, "\"0x", 3);
+    hex::encode(_value.data(), _value.size(), output + 3);
+    output[_value.size() * 2 + 3] = '"';
+    return *this;
+}
+
+JsonWriter& JsonWriter::raw(std::string_view _json)
+{
+    separator();
+    append(_json);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(const Json::Value& _value)
+{
+    switch (_value.type())
+    {
+    case Json::nullValue:
+        return null();
+    case Json::intValue:
+        return value(_value.asLargestInt());
+    case Json::uintValue:
+        return value(_value.asLargestUInt());
+    case Json::realValue:
+        return value(_value.asDouble());
+    case Json::booleanValue:
+        return value(_value.asBool());
+    case Json::stringValue:
+    {
+        const char* begin = nullptr;
+        const char* end = nullptr;
+        if (!_value.getString(&begin, &end))
+        {
+            return value(std::string_view());
+        }
+        return value(std::string_view(begin, end - begin));
+    }
+    case Json::arrayValue:
+    {
+        startArray();
+        for (const auto& element : _value)
+        {
+            value(element);
+        }
+        return endArray();
+    }
+    case Json::objectValue:
+    {
+        startObject();
+        for (auto it = _value.begin(); it != _value.end(); ++it)
+        {
+            const char* end = nullptr;
+            const char* name = it.memberName(&end);
+            key(std::string_view(name, end - name));
+            value(*it);
+        }
+        return endObject();
+    }
+    }
+    return *this;
+}
+
+namespace
+{
+// The code point of the utf-8 sequence at _begin read the same as jsoncpp, _begin is moved to the
+// last byte read. The continuation bytes are not checked, the truncated or overlong sequence is
+// U+FFFD
+unsigned int utf8ToCodepoint(const char*& _begin, const char* _end)
+{
+    constexpr unsigned int replacement = 0xfffd;
+    auto lead = (unsigned int)(unsigned char)_begin[0];
+    auto next = [&_begin](size_t _index) { return (unsigned int)(unsigned char)_begin[_index]; };
+    if (lead < 0x80)
+    {
+        return lead;
+    }
+    if (lead < 0xe0)
+    {
+        if (_end - _begin < 2)
+        {
+            return replacement;
+        }
+        auto codepoint = ((lead & 0x1f) << 6) | (next(1) & 0x3f);
+        _begin += 1;
+        return codepoint < 0x80 ? replacement : codepoint;
+    }
+    if (lead < 0xf0)
+    {
+        if (_end - _begin < 3)
+        {
+            return replacement;
+        }
+        auto codepoint = ((lead & 0x0f) << 12) | ((next(1) & 0x3f) << 6) | (next(2) & 0x3f);
+        _begin += 2;
+        if (codepoint >= 0xd800 && codepoint <= 0xdfff)
+        {
+            return replacement;
+        }
+        return codepoint < 0x800 ? replacement : codepoint;
+    }
+    if (lead < 0xf8)
+    {
+        if (_end - _begin < 4)
+        {
+            return replacement;
+        }
+        auto codepoint = ((lead & 0x07) << 18) | ((next(1) & 0x3f) << 12) |
+                         ((next(2) & 0x3f) << 6) | (next(3) & 0x3f);
+        _begin += 3;
+        return codepoint < 0x10000 ? replacement : codepoint;
+    }
+    return replacement;
+}
+}  // namespace
+
+void JsonWriter::appendEscape(unsigned int _codeUnit)
+{
+    static constexpr std::string_view hexChars = "0123456789abcdef";
+    append("\\u");
+    m_buffer.push_back(hexChars[(_codeUnit >> 12) & 0x0f]);
+    m_buffer.push_back(hexChars[(_codeUnit >> 8) & 0x0f]);
+    m_buffer.push_back(hexChars[(_codeUnit >> 4) & 0x0f]);
+    m_buffer.push_back(hexChars[_codeUnit & 0x0f]);
+}
+
+void JsonWriter::appendString(std::string_view _value)
+{
+    // escaped the same as the jsoncpp StreamWriter without emitUTF8: the control characters and
+    // the non ascii code points are escaped in hex, the ones above the BMP as surrogate pairs
+    m_buffer.push_back('"');
+    const auto* end = _value.data() + _value.size();
+    // copy the runs without escape at once
+    const auto* begin = _value.data();
+    for (const auto* it = _value.data(); it != end; ++it)
+    {
+        auto ch = (unsigned char)*it;
+        if (ch >= 0x20 && ch < 0x80 && ch != '"' && ch != '\\')
+        {
+            continue;
+        }
+        append(std::string_view(begin, it - begin));
+        switch (ch)
+        {
+        case '"':
+            append("\\\"");
+            break;
+        case '\\':
+            append("\\\\");
+            break;
+        case '\b':
+            append("\\b");
+            break;
+        case '\f':
+            append("\\f");
+            break;
+        case '\n':
+            append("\\n");
+            break;
+        case '\r':
+            append("\\r");
+            break;
+        case '\t':
+            append("\\t");
+            break;
+        default:
+        {
+            if (ch < 0x20)
+            {
+                appendEscape(ch);
+                break;
+            }
+            auto codepoint = utf8ToCodepoint(it, end);
+            if (codepoint < 0x10000)
+            {
+                appendEscape(codepoint);
+                break;
+            }
+            codepoint -= 0x10000;
+            appendEscape(0xd800 + ((codepoint >> 10) & 0x3ff));
+            appendEscape(0xdc00 + (codepoint & 0x3ff));
+            break;
+        }
+        }
+        begin = it + 1;
+    }
+    append(std::string_view(begin, end - begin));
+    m_buffer.push_back('"');
+}
@@ -0,0 +1,106 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief streaming json writer appending the compact json into the response buffer
+ * @file JsonWriter.h
+ */
+
+#pragma once
+
+#include <bcos-utilities/Common.h>
+#include <json/json.h>
+#include <charconv>
+#include <concepts>
+#include <string_view>
+#include <vector>
+
+namespace bcos::rpc
+{
+/**
+ * @brief write the json tokens into the buffer in order, the response builders of the large
+ * results (e.g. the block with thousands of transactions) use it instead of building the
+ * Json::Value tree and serializing it
+ *
+ * Note: the writer doesn't check the structure, the caller pairs start/end and key/value
+ */
+class JsonWriter
+{
+public:
+    explicit JsonWriter(bcos::bytes& _buffer) : m_buffer(_buffer) {}
+    JsonWriter(const JsonWriter&) = delete;
+    JsonWriter(JsonWriter&&) = delete;
+    JsonWriter& operator=(const JsonWriter&) = delete;
+    JsonWriter& operator=(JsonWriter&&) = delete;
+    ~JsonWriter() = default;
+
+    JsonWriter& startObject();
+    JsonWriter& endObject();
+    JsonWriter& startArray();
+    JsonWriter& endArray();
+    JsonWriter& key(std::string_view _key);
+
+    JsonWriter& value(std::string_view _value);
+    JsonWriter& value(const char* _value) { return value(std::string_view(_value)); }
+    JsonWriter& value(const std::string& _value) { return value(std::string_view(_value)); }
+    JsonWriter& value(bool _value);
+    JsonWriter& value(double _value);
+    template <std::integral Int>
+    JsonWriter& value(Int _value)
+    {
+        separator();
+        char buffer[24];
+        auto result = std::to_chars(std::begin(buffer), std::end(buffer), _value);
+        append(std::string_view(buffer, result.ptr - buffer));
+        return *this;
+    }
+    // serialize the json tree, the output is the same as the jsoncpp StreamWriter without
+    // indentation, the strings and the doubles written alone are also the same
+    JsonWriter& value(const Json::Value& _value);
+    JsonWriter& null();
+    // "0x" + the lowercase hex of the bytes, the same as toHexStringWithPrefix
+    JsonWriter& hexValue(bcos::bytesConstRef _value);
+    template <class Data>
+    JsonWriter& hexValue(const Data& _value)
+    {
+        return hexValue(bcos::bytesConstRef((const bcos::byte*)_value.data(), _value.size()));
+    }
+    // the json already serialized
+    JsonWriter& raw(std::string_view _json);
+
+    template <class Value>
+    JsonWriter& member(std::string_view _key, Value&& _value)
+    {
+        return key(_key).value(std::forward<Value>(_value));
+    }
+
+    bcos::bytes& buffer() { return m_buffer; }
+
+private:
+    // the comma before the element of the object or the array
+    void separator();
+    void append(std::string_view _data)
+    {
+        m_buffer.insert(m_buffer.end(), _data.begin(), _data.end());
+    }
+    void appendString(std::string_view _value);
+    // the escape of the utf-16 code unit
+    void appendEscape(unsigned int _codeUnit);
+
+    bcos::bytes& m_buffer;
+    // whether the container of every level already has element
+    std::vector<bool> m_hasElement;
+    bool m_afterKey = false;
+};
+}  // namespace bcos::rpc
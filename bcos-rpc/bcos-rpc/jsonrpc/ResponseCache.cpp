@@ -0,0 +1,97 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file ResponseCache.cpp
+ */
+
+#include <bcos-rpc/jsonrpc/Common.h>
+#include <bcos-rpc/jsonrpc/ResponseCache.h>
+#include <cstring>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+ResponseCache::Value ResponseCache::get(const std::string& _key)
+{
+    std::lock_guard lock(x_entries);
+    auto it = m_index.find(_key);
+    if (it == m_index.end())
+    {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+    m_hits.fetch_add(1, std::memory_order_relaxed);
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->second;
+}
+
+void ResponseCache::put(const std::string& _key, bcos::bytes _result)
+{
+    auto entryMemory = _key.size() + _result.size() + ENTRY_OVERHEAD;
+    if (_result.empty() || entryMemory > m_capacity / 4 ||
+        (_result.size() == 4 && std::memcmp(_result.data(), "null", 4) == 0))
+    {
+        return;
+    }
+    auto value = std::make_shared<const bcos::bytes>(std::move(_result));
+
+    std::lock_guard lock(x_entries);
+    if (auto it = m_index.find(_key); it != m_index.end())
+    {
+        // loaded by the concurrent requests, the results are the same
+        m_entries.splice(m_entries.begin(), m_entries, it->second);
+        return;
+    }
+    m_entries.emplace_front(_key, std::move(value));
+    m_index.emplace(m_entries.front().first, m_entries.begin());
+    m_memory += entryMemory;
+    while (m_memory > m_capacity && !m_entries.empty())
+    {
+        auto& [key, evicted] = m_entries.back();
+        m_memory -= key.size() + evicted->size() + ENTRY_OVERHEAD;
+        m_index.erase(key);
+        m_entries.pop_back();
+    }
+}
+
+void ResponseCache::onNewBlock(const std::string& _group, bcos::protocol::BlockNumber _number)
+{
+    {
+        std::lock_guard lock(x_entries);
+        auto& blockNumber = m_blockNumbers.try_emplace(_group, -1).first->second;
+        // the nodes of the group notify in their own pace, the lower number of the lagging node
+        // neither moves the latest block back nor drops the committed results
+        if (_number <= blockNumber)
+        {
+            return;
+        }
+        blockNumber = _number;
+    }
+    auto hits = this->hits();
+    auto misses = this->misses();
+    RPC_IMPL_LOG(DEBUG) << LOG_BADGE("ResponseCache") << LOG_DESC("onNewBlock")
+                        << LOG_KV("group", _group) << LOG_KV("number", _number)
+                        << LOG_KV("size", size()) << LOG_KV("memory", memory())
+                        << LOG_KV("hits", hits) << LOG_KV("misses", misses)
+                        << LOG_KV("hitRate",
+                               (hits + misses) > 0 ? (double)hits / (double)(hits + misses) : 0);
+}
+
+bcos::protocol::BlockNumber ResponseCache::blockNumber(const std::string& _group) const
+{
+    std::lock_guard lock(x_entries);
+    auto it = m_blockNumbers.find(_group);
+    return it == m_blockNumbers.end() ? -1 : it->second;
+}
@@ -0,0 +1,86 @@
+/**
+ *  Copyright (C) 2021 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the serialized results of the blocks, transactions and receipts queried recently
+ * @file ResponseCache.h
+ */
+
+#pragma once
+
+#include <bcos-framework/protocol/ProtocolTypeDef.h>
+#include <bcos-utilities/Common.h>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace bcos::rpc
+{
+/**
+ * @brief the LRU cache of the serialized json results shared by the rpc and the web3 rpc, the
+ * committed blocks are immutable so the entries are only evicted by the memory limit
+ */
+class ResponseCache
+{
+public:
+    using Ptr = std::shared_ptr<ResponseCache>;
+    using Value = std::shared_ptr<const bcos::bytes>;
+    // the memory of the map node and the list node of an entry
+    constexpr static size_t ENTRY_OVERHEAD = 128;
+
+    explicit ResponseCache(size_t _capacity) : m_capacity(_capacity) {}
+    ~ResponseCache() = default;
+
+    // nullptr if not cached
+    Value get(const std::string& _key);
+    // the empty result, the null result and the result larger than a quarter of the capacity are
+    // not cached
+    void put(const std::string& _key, bcos::bytes _result);
+
+    void onNewBlock(const std::string& _group, bcos::protocol::BlockNumber _number);
+    // the highest block number notified, -1 if unknown
+    bcos::protocol::BlockNumber blockNumber(const std::string& _group) const;
+
+    size_t capacity() const { return m_capacity; }
+    size_t memory() const
+    {
+        std::lock_guard lock(x_entries);
+        return m_memory;
+    }
+    size_t size() const
+    {
+        std::lock_guard lock(x_entries);
+        return m_entries.size();
+    }
+    uint64_t hits() const { return m_hits.load(std::memory_order_relaxed); }
+    uint64_t misses() const { return m_misses.load(std::memory_order_relaxed); }
+
+private:
+    using Entry = std::pair<std::string, Value>;
+
+    size_t m_capacity;
+    mutable std::mutex x_entries;
+    // the most recently used first
+    std::list<Entry> m_entries;
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> m_index;
+    size_t m_memory = 0;
+    std::unordered_map<std::string, bcos::protocol::BlockNumber> m_blockNumbers;
+
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+};
+}  // namespace bcos::rpc
@@ -19,44 +19,255 @@
  */
 
 #include "Web3JsonRpcImpl.h"
+#include <bcos-boostssl/websocket/WsMessage.h>
+#include <bcos-rpc/jsonrpc/JsonReader.h>
+#include <bcos-rpc/jsonrpc/JsonWriter.h>
+#include <bcos-rpc/util.h>
 #include <bcos-task/Wait.h>
 
 using namespace bcos;
 using namespace bcos::rpc;
 
-void Web3JsonRpcImpl::onRPCRequest(std::string_view _requestBody, Sender _sender)
+void Web3JsonRpcImpl::initWsService()
+{
+    if (!m_wsService)
+    {
+        return;
+    }
+    m_wsService->registerMsgHandler(bcos::protocol::MessageType::RPC_REQUEST,
+        [this](std::shared_ptr<boostssl::MessageFace> _msg, Session _session) {
+            handleWsRequest(std::move(_msg), std::move(_session));
+        });
+    m_wsService->registerDisconnectHandler(
+        [this](Session _session) { m_subscriptions->removeOwner(_session->endPoint()); });
+}
+
+void Web3JsonRpcImpl::handleWsRequest(
+    std::shared_ptr<boostssl::MessageFace> _msg, Session _session)
+{
+    auto buffer = _msg->payload();
+    auto req = std::string_view((const char*)buffer->data(), buffer->size());
+    auto seq = _msg->seq();
+    auto version = _msg->version();
+    auto ext = _msg->ext();
+    auto weakSession = std::weak_ptr<boostssl::ws::WsSession>(_session);
+    auto messageFactory = m_wsService->messageFactory();
+    onRequest(
+        req,
+        [seq, version, ext, weakSession, messageFactory](bcos::bytes resp) {
+            auto session = weakSession.lock();
+            if (!session || !session->isConnected())
+            {
+                WEB3_LOG(TRACE) << LOG_BADGE("handleWsRequest")
+                                << LOG_DESC("unable to send response for session inactive")
+                                << LOG_KV("seq", seq);
+                return;
+            }
+            auto msg = messageFactory->buildMessage();
+            msg->setPayload(std::make_shared<bcos::bytes>(std::move(resp)));
+            msg->setVersion(version);
+            msg->setSeq(seq);
+            msg->setExt(ext);
+            session->asyncSendMessage(msg);
+        },
+        _session);
+}
+
+void Web3JsonRpcImpl::onNewBlock(std::string const& _groupID, protocol::BlockNumber _blockNumber)
+{
+    if (_groupID != m_groupId)
+    {
+        return;
+    }
+    task::wait(m_subscriptions->onNewBlock(_blockNumber));
+}
+
+void Web3JsonRpcImpl::handleSubscription(
+    Json::Value const& _request, Session const& _session, Json::Value& _response)
+{
+    if (!_session)
+    {
+        BOOST_THROW_EXCEPTION(JsonRpcException(MethodNotFound, "Notifications not supported"));
+    }
+    auto const& params = _request["params"];
+    Json::Value result;
+    if (toView(_request["method"]) == "eth_unsubscribe")
+    {
+        if (params.empty() || !params[0U].isString())
+        {
+            BOOST_THROW_EXCEPTION(JsonRpcException(InvalidParams, "Invalid subscription id"));
+        }
+        result = m_subscriptions->unsubscribe(_session->endPoint(), toView(params[0U]));
+    }
+    else
+    {
+        auto weakSession = std::weak_ptr<boostssl::ws::WsSession>(_session);
+        auto messageFactory = m_wsService->messageFactory();
+        result = m_subscriptions->subscribe(
+            _session->endPoint(), params, [weakSession, messageFactory](bcos::bytes _data) {
+                auto session = weakSession.lock();
+                if (!session || !session->isConnected())
+                {
+                    return false;
+                }
+                auto msg = messageFactory->buildMessage();
+                msg->setPacketType(bcos::protocol::MessageType::WEB3_SUBSCRIPTION_PUSH);
+                msg->setPayload(std::make_shared<bcos::bytes>(std::move(_data)));
+                session->asyncSendMessage(msg);
+                return true;
+            });
+    }
+    buildJsonContent(result, _response);
+}
+
+void Web3JsonRpcImpl::onRequest(
+    std::string_view _requestBody, Sender _sender, Session const& _session)
+{
+    if (c_fileLogLevel == TRACE) [[unlikely]]
+    {
+        WEB3_LOG(TRACE) << LOG_BADGE("onRPCRequest") << LOG_KV("request", _requestBody);
+    }
+    Json::Value request;
+    bool valid = false;
+    try
+    {
+        valid = parseJson(_requestBody, request);
+    }
+    catch (std::exception const& e)
+    {
+        WEB3_LOG(DEBUG) << LOG_BADGE("onRPCRequest") << LOG_DESC("parse json failed")
+                        << LOG_KV("message", boost::diagnostic_information(e));
+    }
+    if (!valid)
+    {
+        request = Json::Value();
+    }
+    if (request.isArray())
+    {
+        onBatchRPCRequest(std::move(request), std::move(_sender), _session);
+        return;
+    }
+    handleRequest(std::move(request), _requestBody, std::move(_sender), _session);
+}
+
+void Web3JsonRpcImpl::onBatchRPCRequest(
+    Json::Value _requests, Sender _sender, Session const& _session)
+{
+    if (_requests.empty() || _requests.size() > m_batchConfig.maxSize)
+    {
+        Json::Value response;
+        buildJsonError(Json::Value(), InvalidRequest,
+            _requests.empty() ? "Empty batch request" :
+                                "Batch size exceeds the limit " +
+                                    std::to_string(m_batchConfig.maxSize),
+            response);
+        auto&& resp = toBytesResponse(response);
+        WEB3_LOG(DEBUG) << LOG_BADGE("onBatchRPCRequest") << LOG_DESC("invalid batch request")
+                        << LOG_KV("size", _requests.size())
+                        << LOG_KV("response",
+                               std::string_view((const char*)resp.data(), resp.size()));
+        _sender(std::move(resp));
+        return;
+    }
+    auto requests = std::make_shared<Json::Value>(std::move(_requests));
+    auto batch = std::make_shared<JsonRpcBatch>(
+        requests->size(), m_batchConfig,
+        [this, requests, _session](size_t _index, Sender _itemSender) {
+            handleRequest(
+                (*requests)[(Json::ArrayIndex)_index], {}, std::move(_itemSender), _session);
+        },
+        [requests](size_t _index) {
+            auto const& item = (*requests)[(Json::ArrayIndex)_index];
+            Json::Value response;
+            buildJsonError(item.isObject() ? item : Json::Value(), InternalError,
+                "Batch request timeout", response);
+            return toBytesResponse(response);
+        },
+        std::move(_sender));
+    batch->start();
+}
+
+void Web3JsonRpcImpl::handleRequest(
+    Json::Value _root, std::string_view _requestBody, Sender _sender, Session const& _session)
 {
     Json::Value request;
     Json::Value response;
     try
     {
-        if (c_fileLogLevel == TRACE) [[unlikely]]
+        if (!_root.isObject())
         {
-            WEB3_LOG(TRACE) << LOG_BADGE("onRPCRequest") << LOG_KV("request", _requestBody);
+            BOOST_THROW_EXCEPTION(JsonRpcException(InvalidRequest,
+                _root.isNull() ? "Parse json failed" : "Request is not json object"));
         }
-        if (auto const& [valid, msg] = parseRequestAndValidate(_requestBody, request); !valid)
+        request = std::move(_root);
+        if (auto const& [valid, msg] = JsonValidator::validate(request); !valid)
         {
             BOOST_THROW_EXCEPTION(JsonRpcException(InvalidRequest, msg));
         }
         response["id"] = request["id"];
-        if (auto const handler = m_endpointsMapping.findHandler(request["method"].asString());
-            handler.has_value())
+        if (auto method = toView(request["method"]);
+            method == "eth_subscribe" || method == "eth_unsubscribe")
+        {
+            handleSubscription(request, _session, response);
+            _sender(toBytesResponse(response));
+            return;
+        }
+        auto const method = request["method"].asString();
+        auto const handler = m_endpointsMapping.findHandler(method);
+        auto const rawHandler = m_endpointsMapping.findRawHandler(method);
+        if (handler.has_value() || rawHandler.has_value())
         {
             if (c_fileLogLevel == TRACE) [[unlikely]]
             {
                 WEB3_LOG(TRACE) << LOG_BADGE("Web3Request")
                                 << LOG_KV("request", printJson(request));
             }
-            task::wait([](Web3JsonRpcImpl* self, EndpointsMapping::Handler _handler,
-                           Json::Value _request, Sender sender) -> task::Task<void> {
+            auto [cacheKey, cacheBlockNumber] = responseCacheKey(request);
+            if (!cacheKey.empty())
+            {
+                if (auto cached = m_responseCache->get(cacheKey))
+                {
+                    _sender(toBytesResponse(request["id"], *cached));
+                    return;
+                }
+            }
+            if (cacheBlockNumber >= 0)
+            {
+                // the block of the cached number is responded, the same as the cache hit
+                // responds the latest block by the block number notified
+                request["params"][0U] = toQuantity(cacheBlockNumber);
+            }
+            task::wait([](Web3JsonRpcImpl* self, std::optional<EndpointsMapping::Handler> _handler,
+                           std::optional<EndpointsMapping::RawHandler> _rawHandler,
+                           Json::Value _request, Sender sender,
+                           std::string cacheKey) -> task::Task<void> {
                 Json::Value resp;
+                bcos::bytes respBytes;
                 try
                 {
                     // FIXME)): throw exception here will core dump
                     Json::Value const& params = _request["params"];
 
-                    co_await (self->m_endpoints.*_handler)(params, resp);
-                    resp["id"] = _request["id"];
+                    if (_rawHandler)
+                    {
+                        bcos::bytes result;
+                        co_await (self->m_endpoints.*(*_rawHandler))(params, result);
+                        // the block not found and the transaction not committed are not cached
+                        if (!cacheKey.empty() && !result.empty() && result.front() == '{')
+                        {
+                            self->m_responseCache->put(cacheKey, result);
+                        }
+                        respBytes = toBytesResponse(_request["id"], result);
+                    }
+                    else
+                    {
+                        co_await (self->m_endpoints.*(*_handler))(params, resp);
+                        resp["id"] = _request["id"];
+                        if (!cacheKey.empty())
+                        {
+                            respBytes = self->cacheResponse(cacheKey, resp);
+                        }
+                    }
                 }
                 catch (const JsonRpcException& e)
                 {
@@ -71,7 +282,10 @@ void Web3JsonRpcImpl::onRPCRequest(std::string_view _requestBody, Sender _sender
                     buildJsonError(_request, InternalError,
                         boost::current_exception_diagnostic_information(), resp);
                 }
-                auto&& respBytes = toBytesResponse(resp);
+                if (respBytes.empty())
+                {
+                    respBytes = toBytesResponse(resp);
+                }
                 if (c_fileLogLevel == TRACE) [[unlikely]]
                 {
                     std::string method = _request["method"].asString();
@@ -81,7 +295,7 @@ void Web3JsonRpcImpl::onRPCRequest(std::string_view _requestBody, Sender _sender
                                std::string_view((const char*)(respBytes.data()), respBytes.size()));
                 }
                 sender(std::move(respBytes));
-            }(this, handler.value(), std::move(request), _sender));
+            }(this, handler, rawHandler, std::move(request), _sender, std::move(cacheKey)));
             return;
         }
         BOOST_THROW_EXCEPTION(JsonRpcException(MethodNotFound, "Method not found"));
@@ -107,41 +321,89 @@ void Web3JsonRpcImpl::onRPCRequest(std::string_view _requestBody, Sender _sender
     _sender(std::move(resp));
 }
 
-std::tuple<bool, std::string> Web3JsonRpcImpl::parseRequestAndValidate(
-    std::string_view request, Json::Value& root)
+bcos::bytes Web3JsonRpcImpl::toBytesResponse(Json::Value const& jResp)
+{
+    bcos::bytes out;
+    JsonWriter(out).value(jResp);
+    return out;
+}
+
+bcos::bytes Web3JsonRpcImpl::toBytesResponse(Json::Value const& _id, bcos::bytes const& _result)
+{
+    bcos::bytes out;
+    out.reserve(_result.size() + 48);
+    // the same members in the same order as the response built by the endpoints
+    JsonWriter(out)
+        .startObject()
+        .member("id", _id)
+        .member("jsonrpc", "2.0")
+        .key("result")
+        .raw(std::string_view((const char*)_result.data(), _result.size()))
+        .endObject();
+    return out;
+}
+
+std::tuple<std::string, protocol::BlockNumber> Web3JsonRpcImpl::responseCacheKey(
+    Json::Value const& _request) const
 {
-    Json::Value temp;
-    if (Json::Reader jsonReader; !jsonReader.parse(request.begin(), request.end(), temp))
+    if (!m_responseCache)
     {
-        return {false, "Parse json failed"};
+        return {};
     }
-    if (temp.isArray())
+    auto const& params = _request["params"];
+    auto method = toView(_request["method"]);
+    if (params.empty() || !params[0U].isString())
     {
-        // adapt to the jsonrpc standard blockscout
-        root = std::move(temp[0]);
+        return {};
     }
-    else
+    auto fullTransaction = params.size() > 1 && params[1U].isBool() && params[1U].asBool();
+    try
     {
-        root = std::move(temp);
+        if (method == "eth_getBlockByNumber")
+        {
+            // the latest block is cached by the block number notified
+            auto latest = m_responseCache->blockNumber(m_groupId);
+            auto [number, isLatest] = getBlockNumberByTag(latest, toView(params[0U]));
+            if (isLatest && latest < 0)
+            {
+                return {};
+            }
+            return {"web3:block:" + std::to_string(number) + (fullTransaction ? ":1" : ":0"),
+                number};
+        }
+        auto hash = crypto::HashType(toView(params[0U]), crypto::HashType::FromHex).hex();
+        if (method == "eth_getBlockByHash")
+        {
+            return {"web3:blockHash:" + hash + (fullTransaction ? ":1" : ":0"), -1};
+        }
+        if (method == "eth_getTransactionByHash")
+        {
+            return {"web3:tx:" + hash, -1};
+        }
+        if (method == "eth_getTransactionReceipt")
+        {
+            return {"web3:receipt:" + hash, -1};
+        }
     }
-    if (auto result{JsonValidator::validate(root)}; !std::get<bool>(result))
+    catch (...)
     {
-        return result;
+        // the invalid params are responded by the endpoints
     }
-    return {true, ""};
+    return {};
 }
 
-bcos::bytes Web3JsonRpcImpl::toBytesResponse(Json::Value const& jResp)
+bcos::bytes Web3JsonRpcImpl::cacheResponse(
+    std::string const& _cacheKey, Json::Value const& _response)
 {
-    auto builder = Json::StreamWriterBuilder();
-    builder["commentStyle"] = "None";
-    builder["indentation"] = "";
-    std::unique_ptr<Json::StreamWriter> writer(builder.newStreamWriter());
-
-    bcos::bytes out;
-    boost::iostreams::stream<JsonSink> outputStream(out);
-
-    writer->write(jResp, &outputStream);
-    writer.reset();
-    return out;
-}
\ No newline at end of file
+    auto const& result = _response["result"];
+    // the transaction not found is not cached
+    if (!result.isObject() || _response.isMember("error"))
+    {
+        return {};
+    }
+    bcos::bytes serialized;
+    JsonWriter(serialized).value(result);
+    auto response = toBytesResponse(_response["id"], serialized);
+    m_responseCache->put(_cacheKey, std::move(serialized));
+    return response;
+}
@@ -24,7 +24,10 @@
 #include <bcos-boostssl/websocket/WsService.h>
 #include <bcos-framework/gateway/GatewayInterface.h>
 #include <bcos-rpc/groupmgr/GroupManager.h>
+#include <bcos-rpc/jsonrpc/JsonRpcBatch.h>
+#include <bcos-rpc/jsonrpc/ResponseCache.h>
 #include <bcos-rpc/validator/JsonValidator.h>
+#include <bcos-rpc/web3jsonrpc/Web3Subscriptions.h>
 #include <bcos-rpc/web3jsonrpc/endpoints/Endpoints.h>
 #include <bcos-rpc/web3jsonrpc/endpoints/EndpointsMapping.h>
 #include <json/json.h>
@@ -45,16 +48,53 @@ public:
         m_gatewayInterface(std::move(_gatewayInterface)),
         m_wsService(std::move(_wsService)),
         m_groupId(std::move(_groupId)),
-        m_endpoints(m_groupManager->getNodeService(m_groupId, ""), filterSystem)
-    {}
+        m_endpoints(m_groupManager->getNodeService(m_groupId, ""), filterSystem),
+        m_subscriptions(std::make_shared<Web3Subscriptions>(
+            m_groupManager->getNodeService(m_groupId, ""), filterSystem->requestFactory(),
+            filterSystem->matcher()))
+    {
+        initWsService();
+    }
     ~Web3JsonRpcImpl() = default;
 
-    void onRPCRequest(std::string_view _requestBody, Sender _sender);
+    void onRPCRequest(std::string_view _requestBody, Sender _sender)
+    {
+        onRequest(_requestBody, std::move(_sender), nullptr);
+    }
+    // push the new block of the group to the eth_subscribe subscribers
+    void onNewBlock(std::string const& _groupID, protocol::BlockNumber _blockNumber);
+    Web3Subscriptions::Ptr subscriptions() const { return m_subscriptions; }
+
+    void setBatchConfig(JsonRpcBatchConfig const& _batchConfig) { m_batchConfig = _batchConfig; }
+    // the serialized blocks, transactions and receipts are cached if set
+    void setResponseCache(ResponseCache::Ptr _responseCache)
+    {
+        m_responseCache = std::move(_responseCache);
+    }
 
 private:
-    static std::tuple<bool, std::string> parseRequestAndValidate(
-        std::string_view request, Json::Value& root);
+    using Session = std::shared_ptr<boostssl::ws::WsSession>;
+    // the websocket requests and the disconnected sessions of the subscriptions
+    void initWsService();
+    void handleWsRequest(std::shared_ptr<boostssl::MessageFace> _msg, Session _session);
+    // the session is nullptr if the request is not from the websocket
+    void onRequest(std::string_view _requestBody, Sender _sender, Session const& _session);
+    // the request body is only used in the log
+    void handleRequest(Json::Value _root, std::string_view _requestBody, Sender _sender,
+        Session const& _session);
+    void onBatchRPCRequest(Json::Value _requests, Sender _sender, Session const& _session);
+    // eth_subscribe and eth_unsubscribe, throw JsonRpcException if failed
+    void handleSubscription(
+        Json::Value const& _request, Session const& _session, Json::Value& _response);
     static bcos::bytes toBytesResponse(Json::Value const& jResp);
+    // the success response with the serialized result
+    static bcos::bytes toBytesResponse(Json::Value const& _id, bcos::bytes const& _result);
+    // the key of the cached result and the block number the result should be, the key is empty
+    // if the request is not cached
+    std::tuple<std::string, protocol::BlockNumber> responseCacheKey(
+        Json::Value const& _request) const;
+    // cache the result and return the serialized response, empty if the result is not cached
+    bcos::bytes cacheResponse(std::string const& _cacheKey, Json::Value const& _response);
     // Note: only use in one group
     GroupManager::Ptr m_groupManager;
     bcos::gateway::GatewayInterface::Ptr m_gatewayInterface;
@@ -62,5 +102,8 @@ private:
     std::string m_groupId;
     Endpoints m_endpoints;
     EndpointsMapping m_endpointsMapping;
+    JsonRpcBatchConfig m_batchConfig;
+    ResponseCache::Ptr m_responseCache;
+    Web3Subscriptions::Ptr m_subscriptions;
 };
 }  // namespace bcos::rpc
@@ -0,0 +1,306 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file Web3Subscriptions.cpp
+ */
+
+#include "Web3Subscriptions.h"
+#include <bcos-ledger/LedgerMethods.h>
+#include <bcos-rpc/jsonrpc/Common.h>
+#include <bcos-rpc/jsonrpc/JsonWriter.h>
+#include <bcos-rpc/web3jsonrpc/model/BlockResponse.h>
+#include <bcos-rpc/web3jsonrpc/utils/util.h>
+#include <algorithm>
+#include <unordered_map>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+std::string Web3Subscriptions::subscribe(
+    std::string _owner, Json::Value const& _params, Pusher _pusher)
+{
+    if (!_params.isArray() || _params.empty() || !_params[0U].isString())
+    {
+        BOOST_THROW_EXCEPTION(JsonRpcException(InvalidParams, "Invalid subscription params"));
+    }
+    auto subscription = std::make_shared<Subscription>();
+    subscription->owner = std::move(_owner);
+    subscription->pusher = std::move(_pusher);
+    auto type = toView(_params[0U]);
+    if (type == "newHeads")
+    {
+        subscription->type = Type::NewHeads;
+    }
+    else if (type == "newPendingTransactions")
+    {
+        subscription->type = Type::NewPendingTransactions;
+    }
+    else if (type == "logs")
+    {
+        subscription->type = Type::Logs;
+        // the logs of the new blocks are pushed, only the address and the topics are used
+        Json::Value jFilter(Json::objectValue);
+        if (_params.size() > 1 && _params[1U].isObject())
+        {
+            jFilter = _params[1U];
+        }
+        jFilter["fromBlock"] = "latest";
+        jFilter["toBlock"] = "latest";
+        if (!jFilter.isMember("address") || jFilter["address"].isNull())
+        {
+            jFilter["address"] = Json::Value(Json::arrayValue);
+        }
+        if (!jFilter.isMember("topics") || jFilter["topics"].isNull())
+        {
+            jFilter["topics"] = Json::Value(Json::arrayValue);
+        }
+        subscription->filter = m_factory->create();
+        subscription->filter->fromJson(jFilter);
+    }
+    else
+    {
+        BOOST_THROW_EXCEPTION(JsonRpcException(
+            InvalidParams, "Unsupported subscription type: " + std::string(type)));
+    }
+    subscription->resultKey =
+        subscription->filter ? logsResultKey(*subscription->filter) : std::string(type);
+
+    std::string id;
+    size_t total = 0;
+    {
+        std::lock_guard lock(x_subscriptions);
+        id = toQuantity(++m_nextId);
+        m_subscriptions.emplace(id, subscription);
+        total = m_subscriptions.size();
+    }
+    WEB3_LOG(INFO) << LOG_BADGE("subscribe") << LOG_KV("id", id) << LOG_KV("type", type)
+                   << LOG_KV("owner", subscription->owner) << LOG_KV("total", total);
+    return id;
+}
+
+bool Web3Subscriptions::unsubscribe(std::string_view _owner, std::string_view _id)
+{
+    std::lock_guard lock(x_subscriptions);
+    auto it = m_subscriptions.find(_id);
+    if (it == m_subscriptions.end() || it->second->owner != _owner)
+    {
+        return false;
+    }
+    m_subscriptions.erase(it);
+    WEB3_LOG(INFO) << LOG_BADGE("unsubscribe") << LOG_KV("id", _id) << LOG_KV("owner", _owner);
+    return true;
+}
+
+void Web3Subscriptions::removeOwner(std::string_view _owner)
+{
+    size_t removed = 0;
+    {
+        std::lock_guard lock(x_subscriptions);
+        removed = std::erase_if(
+            m_subscriptions, [&_owner](auto const& item) { return item.second->owner == _owner; });
+    }
+    if (removed > 0)
+    {
+        WEB3_LOG(INFO) << LOG_BADGE("removeOwner") << LOG_KV("owner", _owner)
+                       << LOG_KV("removed", removed);
+    }
+}
+
+task::Task<void> Web3Subscriptions::onNewBlock(protocol::BlockNumber _blockNumber)
+{
+    Subscriptions subscriptions;
+    protocol::BlockNumber from = _blockNumber;
+    {
+        std::lock_guard lock(x_subscriptions);
+        if (_blockNumber <= m_blockNumber)
+        {
+            co_return;
+        }
+        if (m_blockNumber >= 0)
+        {
+            from = std::max(m_blockNumber + 1, _blockNumber - MAX_CATCH_UP_BLOCKS + 1);
+        }
+        m_blockNumber = _blockNumber;
+        subscriptions.assign(m_subscriptions.begin(), m_subscriptions.end());
+    }
+    if (subscriptions.empty())
+    {
+        co_return;
+    }
+    std::vector<std::string> gone;
+    for (auto number = from; number <= _blockNumber; ++number)
+    {
+        try
+        {
+            co_await pushBlock(number, subscriptions, gone);
+        }
+        catch (std::exception const& e)
+        {
+            WEB3_LOG(WARNING) << LOG_BADGE("onNewBlock") << LOG_DESC("push block failed")
+                              << LOG_KV("number", number)
+                              << LOG_KV("message", boost::diagnostic_information(e));
+        }
+    }
+    if (!gone.empty())
+    {
+        std::lock_guard lock(x_subscriptions);
+        for (auto const& id : gone)
+        {
+            m_subscriptions.erase(id);
+        }
+    }
+    WEB3_LOG(DEBUG) << LOG_BADGE("onNewBlock") << LOG_KV("from", from)
+                    << LOG_KV("to", _blockNumber) << LOG_KV("subscriptions", subscriptions.size())
+                    << LOG_KV("gone", gone.size());
+}
+
+task::Task<void> Web3Subscriptions::pushBlock(protocol::BlockNumber _blockNumber,
+    Subscriptions const& _subscriptions, std::vector<std::string>& _gone)
+{
+    auto withLogs = std::any_of(_subscriptions.begin(), _subscriptions.end(),
+        [](auto const& item) { return item.second->type == Type::Logs; });
+    auto ledger = m_nodeService->ledger();
+    auto block = co_await ledger::getBlockData(*ledger, _blockNumber,
+        bcos::ledger::HEADER | bcos::ledger::TRANSACTIONS_HASH |
+            (withLogs ? bcos::ledger::RECEIPTS : 0));
+
+    // the results are serialized once for the subscriptions with the same key
+    std::unordered_map<std::string_view, std::vector<bcos::bytes>> results;
+    for (auto const& [id, subscription] : _subscriptions)
+    {
+        if (std::find(_gone.begin(), _gone.end(), id) != _gone.end())
+        {
+            continue;
+        }
+        auto it = results.find(subscription->resultKey);
+        if (it == results.end())
+        {
+            it = results.emplace(subscription->resultKey, serializeResults(*subscription, block))
+                     .first;
+        }
+        for (auto const& result : it->second)
+        {
+            if (!subscription->pusher(toNotification(id, result)))
+            {
+                _gone.push_back(id);
+                break;
+            }
+        }
+    }
+}
+
+std::vector<bcos::bytes> Web3Subscriptions::serializeResults(
+    Subscription const& _subscription, protocol::Block::Ptr const& _block) const
+{
+    std::vector<bcos::bytes> results;
+    switch (_subscription.type)
+    {
+    case Type::NewHeads:
+    {
+        Json::Value header;
+        combineBlockResponse(header, protocol::Block::Ptr(_block));
+        header.removeMember("transactions");
+        header.removeMember("uncles");
+        JsonWriter(results.emplace_back()).value(header);
+        break;
+    }
+    case Type::NewPendingTransactions:
+    {
+        // the transactions are pushed when committed, the same as the pending transaction filter
+        results.reserve(_block->transactionsHashSize());
+        for (size_t i = 0; i < _block->transactionsHashSize(); ++i)
+        {
+            JsonWriter(results.emplace_back()).value(_block->transactionHash(i).hexPrefixed());
+        }
+        break;
+    }
+    case Type::Logs:
+    {
+        // Note: not LogMatcher::matches(params, block), which takes the log entries of the
+        // receipts shared by all the filters
+        auto blockHash = _block->blockHeaderConst()->hash().hexPrefixed();
+        auto blockNumber = toQuantity(_block->blockHeaderConst()->number());
+        for (size_t index = 0; index < _block->receiptsSize(); ++index)
+        {
+            auto receipt = _block->receipt(index);
+            auto logEntries = receipt->logEntries();
+            for (size_t i = 0; i < logEntries.size(); ++i)
+            {
+                auto const& logEntry = logEntries[i];
+                if (!m_matcher->matches(_subscription.filter, logEntry))
+                {
+                    continue;
+                }
+                Json::Value log;
+                log["data"] = toHexStringWithPrefix(logEntry.data());
+                log["logIndex"] = toQuantity(i);
+                log["blockNumber"] = blockNumber;
+                log["blockHash"] = blockHash;
+                log["transactionIndex"] = toQuantity(index);
+                log["transactionHash"] = _block->transactionHash(index).hexPrefixed();
+                log["removed"] = false;
+                log["address"] = "0x" + std::string(logEntry.address());
+                Json::Value jTopics(Json::arrayValue);
+                for (const auto& topic : logEntry.topics())
+                {
+                    jTopics.append(topic.hexPrefixed());
+                }
+                log["topics"] = std::move(jTopics);
+                JsonWriter(results.emplace_back()).value(log);
+            }
+        }
+        break;
+    }
+    }
+    return results;
+}
+
+std::string Web3Subscriptions::logsResultKey(FilterRequest const& _filter)
+{
+    // the addresses and the topics are ordered sets
+    std::string key = "logs:";
+    for (auto const& address : _filter.addresses())
+    {
+        key.append(address).push_back(',');
+    }
+    for (auto const& topics : _filter.topics())
+    {
+        key.push_back('[');
+        for (auto const& topic : topics)
+        {
+            key.append(topic).push_back(',');
+        }
+        key.push_back(']');
+    }
+    return key;
+}
+
+bcos::bytes Web3Subscriptions::toNotification(std::string_view _id, bcos::bytes const& _result)
+{
+    bcos::bytes out;
+    out.reserve(_result.size() + _id.size() + 80);
+    JsonWriter(out)
+        .startObject()
+        .member("jsonrpc", "2.0")
+        .member("method", "eth_subscription")
+        .key("params")
+        .startObject()
+        .member("subscription", _id)
+        .key("result")
+        .raw(std::string_view((const char*)_result.data(), _result.size()))
+        .endObject()
+        .endObject();
+    return out;
+}
@@ -0,0 +1,117 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the eth_subscribe subscriptions pushed over the web3 websocket
+ * @file Web3Subscriptions.h
+ */
+
+#pragma once
+#include <bcos-framework/protocol/Block.h>
+#include <bcos-framework/protocol/ProtocolTypeDef.h>
+#include <bcos-rpc/filter/FilterRequest.h>
+#include <bcos-rpc/filter/LogMatcher.h>
+#include <bcos-rpc/groupmgr/NodeService.h>
+#include <bcos-task/Task.h>
+#include <bcos-utilities/Common.h>
+#include <json/json.h>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace bcos::rpc
+{
+/**
+ * @brief the subscriptions of newHeads, newPendingTransactions and logs, every new block is read
+ * from the ledger once and pushed to all the subscribers, the subscriptions of the same kind (the
+ * logs with the same address and topics) share the matched and serialized results
+ */
+class Web3Subscriptions
+{
+public:
+    using Ptr = std::shared_ptr<Web3Subscriptions>;
+    // send the serialized notification to the subscriber, false if the subscriber has gone
+    using Pusher = std::function<bool(bcos::bytes)>;
+    // the blocks pushed at most when the notified block number jumps
+    constexpr static protocol::BlockNumber MAX_CATCH_UP_BLOCKS = 10;
+
+    enum class Type : uint8_t
+    {
+        NewHeads,
+        NewPendingTransactions,
+        Logs,
+    };
+
+    Web3Subscriptions(NodeService::Ptr _nodeService, FilterRequestFactory::Ptr _factory,
+        LogMatcher::Ptr _matcher)
+      : m_nodeService(std::move(_nodeService)),
+        m_factory(std::move(_factory)),
+        m_matcher(std::move(_matcher))
+    {}
+    ~Web3Subscriptions() = default;
+
+    // params: [type, filter], return the subscription id, throw JsonRpcException if invalid
+    std::string subscribe(std::string _owner, Json::Value const& _params, Pusher _pusher);
+    // only the owner can unsubscribe
+    bool unsubscribe(std::string_view _owner, std::string_view _id);
+    // called when the session of the owner disconnected
+    void removeOwner(std::string_view _owner);
+
+    task::Task<void> onNewBlock(protocol::BlockNumber _blockNumber);
+
+    size_t size() const
+    {
+        std::lock_guard lock(x_subscriptions);
+        return m_subscriptions.size();
+    }
+
+    // {"jsonrpc":"2.0","method":"eth_subscription","params":{"subscription":id,"result":result}}
+    static bcos::bytes toNotification(std::string_view _id, bcos::bytes const& _result);
+
+private:
+    struct Subscription
+    {
+        std::string owner;
+        Type type;
+        // nullptr if not the logs
+        FilterRequest::Ptr filter;
+        // the subscriptions with the same key share the results
+        std::string resultKey;
+        Pusher pusher;
+    };
+    using Subscriptions = std::vector<std::pair<std::string, std::shared_ptr<const Subscription>>>;
+
+    // push the block to the subscribers, the ids of the subscribers gone are appended to _gone
+    task::Task<void> pushBlock(protocol::BlockNumber _blockNumber,
+        Subscriptions const& _subscriptions, std::vector<std::string>& _gone);
+    // the serialized results of the subscription, one notification per result
+    std::vector<bcos::bytes> serializeResults(
+        Subscription const& _subscription, protocol::Block::Ptr const& _block) const;
+    static std::string logsResultKey(FilterRequest const& _filter);
+
+    NodeService::Ptr m_nodeService;
+    FilterRequestFactory::Ptr m_factory;
+    LogMatcher::Ptr m_matcher;
+
+    mutable std::mutex x_subscriptions;
+    std::map<std::string, std::shared_ptr<const Subscription>, std::less<>> m_subscriptions;
+    uint64_t m_nextId = 0;
+    // the latest block pushed
+    protocol::BlockNumber m_blockNumber = -1;
+};
+}  // namespace bcos::rpc
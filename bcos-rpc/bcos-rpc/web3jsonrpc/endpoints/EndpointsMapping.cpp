@@ -37,6 +37,17 @@ std::optional<EndpointsMapping::Handler> EndpointsMapping::findHandler(
     return it->second;
 }
 
+std::optional<EndpointsMapping::RawHandler> EndpointsMapping::findRawHandler(
+    const std::string& _method) const
+{
+    auto it = m_rawHandlers.find(_method);
+    if (it == m_rawHandlers.end())
+    {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
 void EndpointsMapping::addHandlers()
 {
     addEthHandlers();
@@ -46,7 +57,12 @@ void EndpointsMapping::addHandlers()
     {
         WEB3_LOG(INFO) << LOG_BADGE("initHandler") << LOG_KV("method", method);
     }
-    WEB3_LOG(INFO) << LOG_BADGE("initHandler") << LOG_KV("size", m_handlers.size());
+    for (auto& [method, _] : m_rawHandlers)
+    {
+        WEB3_LOG(INFO) << LOG_BADGE("initHandler") << LOG_KV("method", method);
+    }
+    WEB3_LOG(INFO) << LOG_BADGE("initHandler")
+                   << LOG_KV("size", m_handlers.size() + m_rawHandlers.size());
 }
 
 void EndpointsMapping::addEthHandlers()
@@ -75,21 +91,21 @@ void EndpointsMapping::addEthHandlers()
     m_handlers[methodString(EthMethod::eth_sendRawTransaction)] = &Endpoints::sendRawTransaction;
     m_handlers[methodString(EthMethod::eth_call)] = &Endpoints::call;
     m_handlers[methodString(EthMethod::eth_estimateGas)] = &Endpoints::estimateGas;
-    m_handlers[methodString(EthMethod::eth_getBlockByHash)] = &Endpoints::getBlockByHash;
-    m_handlers[methodString(EthMethod::eth_getBlockByNumber)] = &Endpoints::getBlockByNumber;
+    m_rawHandlers[methodString(EthMethod::eth_getBlockByHash)] = &Endpoints::getBlockByHash;
+    m_rawHandlers[methodString(EthMethod::eth_getBlockByNumber)] = &Endpoints::getBlockByNumber;
     m_handlers[methodString(EthMethod::eth_getTransactionByHash)] = &Endpoints::getTransactionByHash;
     m_handlers[methodString(EthMethod::eth_getTransactionByBlockHashAndIndex)] = &Endpoints::getTransactionByBlockHashAndIndex;
     m_handlers[methodString(EthMethod::eth_getTransactionByBlockNumberAndIndex)] = &Endpoints::getTransactionByBlockNumberAndIndex;
-    m_handlers[methodString(EthMethod::eth_getTransactionReceipt)] = &Endpoints::getTransactionReceipt;
+    m_rawHandlers[methodString(EthMethod::eth_getTransactionReceipt)] = &Endpoints::getTransactionReceipt;
     m_handlers[methodString(EthMethod::eth_getUncleByBlockHashAndIndex)] = &Endpoints::getUncleByBlockHashAndIndex;
     m_handlers[methodString(EthMethod::eth_getUncleByBlockNumberAndIndex)] = &Endpoints::getUncleByBlockNumberAndIndex;
     m_handlers[methodString(EthMethod::eth_newFilter)] = &Endpoints::newFilter;
     m_handlers[methodString(EthMethod::eth_newBlockFilter)] = &Endpoints::newBlockFilter;
     m_handlers[methodString(EthMethod::eth_newPendingTransactionFilter)] = &Endpoints::newPendingTransactionFilter;
     m_handlers[methodString(EthMethod::eth_uninstallFilter)] = &Endpoints::uninstallFilter;
-    m_handlers[methodString(EthMethod::eth_getFilterChanges)] = &Endpoints::getFilterChanges;
-    m_handlers[methodString(EthMethod::eth_getFilterLogs)] = &Endpoints::getFilterLogs;
-    m_handlers[methodString(EthMethod::eth_getLogs)] = &Endpoints::getLogs;
+    m_rawHandlers[methodString(EthMethod::eth_getFilterChanges)] = &Endpoints::getFilterChanges;
+    m_rawHandlers[methodString(EthMethod::eth_getFilterLogs)] = &Endpoints::getFilterLogs;
+    m_rawHandlers[methodString(EthMethod::eth_getLogs)] = &Endpoints::getLogs;
     // clang-format on
 }
 
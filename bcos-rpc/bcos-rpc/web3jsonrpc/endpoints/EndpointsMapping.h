@@ -31,12 +31,15 @@ class EndpointsMapping
 {
 public:
     using Handler = task::Task<void> (Endpoints::*)(const Json::Value&, Json::Value&);
+    // the raw handler writes the serialized result into the buffer
+    using RawHandler = task::Task<void> (Endpoints::*)(const Json::Value&, bcos::bytes&);
     EndpointsMapping() { addHandlers(); };
     ~EndpointsMapping() = default;
     EndpointsMapping(const EndpointsMapping&) = delete;
     EndpointsMapping& operator=(const EndpointsMapping&) = delete;
 
     [[nodiscard]] std::optional<Handler> findHandler(const std::string& _method) const;
+    [[nodiscard]] std::optional<RawHandler> findRawHandler(const std::string& _method) const;
 
 private:
     void addHandlers();
@@ -45,5 +48,6 @@ private:
     void addWeb3Handlers();
 
     std::unordered_map<std::string, Handler> m_handlers;
+    std::unordered_map<std::string, RawHandler> m_rawHandlers;
 };
 }  // namespace bcos::rpc
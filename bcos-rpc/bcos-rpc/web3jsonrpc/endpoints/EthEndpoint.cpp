@@ -568,14 +568,13 @@ task::Task<void> EthEndpoint::estimateGas(const Json::Value& request, Json::Valu
     buildJsonContent(result, response);
     co_return;
 }
-task::Task<void> EthEndpoint::getBlockByHash(const Json::Value& request, Json::Value& response)
+task::Task<void> EthEndpoint::getBlockByHash(const Json::Value& request, bcos::bytes& result)
 {
     // params: blockHash(DATA), fullTransaction(Boolean)
     // result: block(BLOCK)
     auto const blockHash = toView(request[0u]);
     auto const fullTransaction = request[1u].asBool();
     auto const ledger = m_nodeService->ledger();
-    Json::Value result = Json::objectValue;
     try
     {
         auto const number = co_await ledger::getBlockNumber(
@@ -583,22 +582,22 @@ task::Task<void> EthEndpoint::getBlockByHash(const Json::Value& request, Json::V
         auto flag = bcos::ledger::HEADER;
         flag |= fullTransaction ? bcos::ledger::TRANSACTIONS : bcos::ledger::TRANSACTIONS_HASH;
         auto block = co_await ledger::getBlockData(*ledger, number, flag);
-        combineBlockResponse(result, std::move(block), fullTransaction);
+        JsonWriter writer(result);
+        writeBlockResponse(writer, *block, fullTransaction);
     }
     catch (...)
     {
-        result = Json::nullValue;
+        result.clear();
+        JsonWriter(result).null();
     }
-    buildJsonContent(result, response);
     co_return;
 }
-task::Task<void> EthEndpoint::getBlockByNumber(const Json::Value& request, Json::Value& response)
+task::Task<void> EthEndpoint::getBlockByNumber(const Json::Value& request, bcos::bytes& result)
 {
     // params: blockNumber(QTY|TAG), fullTransaction(Boolean)
     // result: block(BLOCK)
     auto const blockTag = toView(request[0u]);
     auto const fullTransaction = request[1u].asBool();
-    Json::Value result = Json::objectValue;
     try
     {
         auto [blockNumber, _] = co_await getBlockNumberByTag(blockTag);
@@ -606,13 +605,14 @@ task::Task<void> EthEndpoint::getBlockByNumber(const Json::Value& request, Json:
         auto flag = bcos::ledger::HEADER;
         flag |= fullTransaction ? bcos::ledger::TRANSACTIONS : bcos::ledger::TRANSACTIONS_HASH;
         auto block = co_await ledger::getBlockData(*ledger, blockNumber, flag);
-        combineBlockResponse(result, std::move(block), fullTransaction);
+        JsonWriter writer(result);
+        writeBlockResponse(writer, *block, fullTransaction);
     }
     catch (...)
     {
-        result = Json::nullValue;
+        result.clear();
+        JsonWriter(result).null();
     }
-    buildJsonContent(result, response);
     co_return;
 }
 task::Task<void> EthEndpoint::getTransactionByHash(
@@ -707,14 +707,13 @@ task::Task<void> EthEndpoint::getTransactionByBlockNumberAndIndex(
     co_return;
 }
 task::Task<void> EthEndpoint::getTransactionReceipt(
-    const Json::Value& request, Json::Value& response)
+    const Json::Value& request, bcos::bytes& result)
 {
     // params: transactionHash(DATA)
     // result: transactionReceipt(RECEIPT)
     auto const hashStr = toView(request[0U]);
     auto const hash = crypto::HashType(hashStr, crypto::HashType::FromHex);
     auto const ledger = m_nodeService->ledger();
-    Json::Value result = Json::objectValue;
     try
     {
         auto receipt = co_await ledger::getReceipt(*ledger, hash);
@@ -728,15 +727,14 @@ task::Task<void> EthEndpoint::getTransactionReceipt(
         }
         auto block = co_await ledger::getBlockData(*ledger, receipt->blockNumber(),
             bcos::ledger::HEADER | bcos::ledger::TRANSACTIONS_HASH | bcos::ledger::RECEIPTS);
-        combineReceiptResponse(result, std::move(receipt), txs->at(0), std::move(block));
+        JsonWriter writer(result);
+        writeReceiptResponse(writer, std::move(receipt), txs->at(0), std::move(block));
     }
     catch (...)
     {
-        result = Json::nullValue;
-        buildJsonContent(result, response);
-        co_return;
+        result.clear();
+        JsonWriter(result).null();
     }
-    buildJsonContent(result, response);
     co_return;
 }
 task::Task<void> EthEndpoint::getUncleByBlockHashAndIndex(const Json::Value&, Json::Value& response)
@@ -786,33 +784,30 @@ task::Task<void> EthEndpoint::uninstallFilter(const Json::Value& request, Json::
     buildJsonContent(result, response);
     co_return;
 }
-task::Task<void> EthEndpoint::getFilterChanges(const Json::Value& request, Json::Value& response)
+task::Task<void> EthEndpoint::getFilterChanges(const Json::Value& request, bcos::bytes& result)
 {
     // params: filterId(QTY)
     // result: logs(ARRAY)
     auto const id = fromBigQuantity(toView(request[0U]));
-    Json::Value result = co_await m_filterSystem->getFilterChanges(id);
-    buildJsonContent(result, response);
+    result = co_await m_filterSystem->getFilterChanges(id);
     co_return;
 }
-task::Task<void> EthEndpoint::getFilterLogs(const Json::Value& request, Json::Value& response)
+task::Task<void> EthEndpoint::getFilterLogs(const Json::Value& request, bcos::bytes& result)
 {
     // params: filterId(QTY)
     // result: logs(ARRAY)
     auto const id = fromBigQuantity(toView(request[0U]));
-    Json::Value result = co_await m_filterSystem->getFilterLogs(id);
-    buildJsonContent(result, response);
+    result = co_await m_filterSystem->getFilterLogs(id);
     co_return;
 }
-task::Task<void> EthEndpoint::getLogs(const Json::Value& request, Json::Value& response)
+task::Task<void> EthEndpoint::getLogs(const Json::Value& request, bcos::bytes& result)
 {
     // params: filter(FILTER)
     // result: logs(ARRAY)
     Json::Value jParams = request[0U];
     auto params = m_filterSystem->requestFactory()->create();
     params->fromJson(jParams);
-    Json::Value result = co_await m_filterSystem->getLogs(params);
-    buildJsonContent(result, response);
+    result = co_await m_filterSystem->getLogs(params);
     co_return;
 }
 task::Task<std::tuple<protocol::BlockNumber, bool>> EthEndpoint::getBlockNumberByTag(
@@ -65,21 +65,22 @@ protected:
     task::Task<void> sendRawTransaction(const Json::Value&, Json::Value&);
     task::Task<void> call(const Json::Value&, Json::Value&);
     task::Task<void> estimateGas(const Json::Value&, Json::Value&);
-    task::Task<void> getBlockByHash(const Json::Value&, Json::Value&);
-    task::Task<void> getBlockByNumber(const Json::Value&, Json::Value&);
+    // the blocks, the receipts and the logs are written into the result buffer directly
+    task::Task<void> getBlockByHash(const Json::Value&, bcos::bytes&);
+    task::Task<void> getBlockByNumber(const Json::Value&, bcos::bytes&);
     task::Task<void> getTransactionByHash(const Json::Value&, Json::Value&);
     task::Task<void> getTransactionByBlockHashAndIndex(const Json::Value&, Json::Value&);
     task::Task<void> getTransactionByBlockNumberAndIndex(const Json::Value&, Json::Value&);
-    task::Task<void> getTransactionReceipt(const Json::Value&, Json::Value&);
+    task::Task<void> getTransactionReceipt(const Json::Value&, bcos::bytes&);
     task::Task<void> getUncleByBlockHashAndIndex(const Json::Value&, Json::Value&);
     task::Task<void> getUncleByBlockNumberAndIndex(const Json::Value&, Json::Value&);
     task::Task<void> newFilter(const Json::Value&, Json::Value&);
     task::Task<void> newBlockFilter(const Json::Value&, Json::Value&);
     task::Task<void> newPendingTransactionFilter(const Json::Value&, Json::Value&);
     task::Task<void> uninstallFilter(const Json::Value&, Json::Value&);
-    task::Task<void> getFilterChanges(const Json::Value&, Json::Value&);
-    task::Task<void> getFilterLogs(const Json::Value&, Json::Value&);
-    task::Task<void> getLogs(const Json::Value&, Json::Value&);
+    task::Task<void> getFilterChanges(const Json::Value&, bcos::bytes&);
+    task::Task<void> getFilterLogs(const Json::Value&, bcos::bytes&);
+    task::Task<void> getLogs(const Json::Value&, bcos::bytes&);
     task::Task<std::tuple<protocol::BlockNumber, bool>> getBlockNumberByTag(
         std::string_view blockTag);
 
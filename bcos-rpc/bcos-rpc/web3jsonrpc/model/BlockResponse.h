@@ -92,4 +92,83 @@ namespace bcos::rpc
     }
     result["uncles"] = Json::Value(Json::arrayValue);
 }
+
+// write the same members as combineBlockResponse
+[[maybe_unused]] static void writeBlockResponse(
+    JsonWriter& writer, bcos::protocol::Block& block, bool fullTxs = false)
+{
+    auto blockHeader = block.blockHeader();
+    auto blockHash = blockHeader->hash();
+    auto blockNumber = blockHeader->number();
+    writer.startObject();
+    writer.member("number", toQuantity(blockNumber));
+    writer.key("hash").hexValue(blockHash.ref());
+    // Only one parent block in BCOS. It is empty for genesis block
+    if (blockNumber == 0)
+    {
+        writer.member("parentHash",
+            "0x0000000000000000000000000000000000000000000000000000000000000000");
+    }
+    else
+    {
+        std::optional<crypto::HashType> parentHash;
+        for (const auto& info : blockHeader->parentInfo())
+        {
+            parentHash = info.blockHash;
+        }
+        if (parentHash)
+        {
+            writer.key("parentHash").hexValue(parentHash->ref());
+        }
+    }
+    writer.member("nonce", "0x0000000000000000");
+    // empty uncle hash: keccak256(RLP([]))
+    writer.member(
+        "sha3Uncles", "0x1dcc4de8dec75d7aab85b567b6ccd41ad312451b948a7413f0a142fd40d49347");
+    writer.member("logsBloom", "0x");
+    writer.key("transactionsRoot").hexValue(blockHeader->txsRoot().ref());
+    writer.key("stateRoot").hexValue(blockHeader->stateRoot().ref());
+    writer.key("receiptsRoot").hexValue(blockHeader->receiptsRoot().ref());
+    // genesis block
+    if (blockNumber == 0)
+    {
+        writer.member("miner", "0x0000000000000000000000000000000000000000");
+    }
+    else if (std::cmp_greater(blockHeader->sealerList().size(), blockHeader->sealer()))
+    {
+        auto pk = blockHeader->sealerList()[blockHeader->sealer()];
+        auto hash = crypto::keccak256Hash(bcos::ref(pk));
+        Address address = right160(hash);
+        auto addrString = address.hex();
+        auto addrHash = crypto::keccak256Hash(bytesConstRef(addrString)).hex();
+        toChecksumAddress(addrString, addrHash);
+        writer.member("miner", "0x" + addrString);
+    }
+    writer.member("difficulty", "0x0");
+    writer.member("totalDifficulty", "0x0");
+    writer.key("extraData").hexValue(blockHeader->extraData());
+    writer.member("size", toQuantity(block.size()));
+    // TODO: change it wen block gas limit apply
+    writer.member("gasLimit", toQuantity(30000000ULL));
+    writer.member("gasUsed", toQuantity((uint64_t)blockHeader->gasUsed()));
+    writer.member("timestamp", toQuantity(blockHeader->timestamp() / 1000));  // to seconds
+    writer.key("transactions").startArray();
+    if (fullTxs)
+    {
+        for (size_t i = 0; i < block.transactionsSize(); i++)
+        {
+            writeTxResponse(writer, *block.transaction(i), blockHash, blockNumber, i);
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < block.transactionsHashSize(); i++)
+        {
+            writer.hexValue(block.transactionHash(i).ref());
+        }
+    }
+    writer.endArray();
+    writer.key("uncles").startArray().endArray();
+    writer.endObject();
+}
 }  // namespace bcos::rpc
\ No newline at end of file
@@ -39,6 +39,8 @@ void rpc::bytesToBloom(concepts::ByteBuffer auto const& _bytes, Bloom& _bloom)
     }
 }
 
+template void rpc::bytesToBloom(bcos::bytes const& _bytes, Bloom& _bloom);
+
 Bloom rpc::getLogsBloom(Logs const& logs)
 {
     Bloom bloom{};
@@ -24,6 +24,7 @@
 
 #include <bcos-crypto/ChecksumAddress.h>
 #include <bcos-framework/protocol/ProtocolTypeDef.h>
+#include <bcos-rpc/jsonrpc/JsonWriter.h>
 #include <bcos-rpc/web3jsonrpc/model/Log.h>
 #include <bcos-rpc/web3jsonrpc/model/Web3Transaction.h>
 #include <bcos-utilities/Common.h>
@@ -141,4 +142,116 @@ namespace bcos::rpc
     }
     result["type"] = toQuantity(static_cast<uint64_t>(type));
 }
+
+// write the same members as combineReceiptResponse
+[[maybe_unused]] static void writeReceiptResponse(JsonWriter& writer,
+    protocol::TransactionReceipt::ConstPtr&& receipt, bcos::protocol::Transaction::ConstPtr&& tx,
+    bcos::protocol::Block::Ptr&& block)
+{
+    writer.startObject();
+    uint8_t status = (receipt->status() == 0 ? 1 : 0);
+    writer.member("status", toQuantity(status));
+    writer.key("transactionHash").hexValue(tx->hash().ref());
+    size_t transactionIndex = 0;
+    crypto::HashType blockHash;
+    uint64_t blockNumber = 0;
+    u256 cumulativeGasUsed = 0;
+    if (block)
+    {
+        blockHash = block->blockHeader()->hash();
+        blockNumber = block->blockHeader()->number();
+        for (; transactionIndex < block->transactionsHashSize(); transactionIndex++)
+        {
+            if (transactionIndex <= block->receiptsSize())
+            {
+                cumulativeGasUsed += block->receipt(transactionIndex)->gasUsed();
+            }
+            if (block->transactionHash(transactionIndex) == tx->hash())
+            {
+                break;
+            }
+        }
+    }
+    writer.member("transactionIndex", toQuantity(transactionIndex));
+    writer.key("blockHash").hexValue(blockHash.ref());
+    writer.member("blockNumber", toQuantity(blockNumber));
+    auto from = toHex(tx->sender());
+    toChecksumAddress(from, bcos::crypto::keccak256Hash(bcos::bytesConstRef(from)).hex());
+    writer.member("from", "0x" + std::move(from));
+    if (tx->to().empty())
+    {
+        writer.key("to").null();
+    }
+    else
+    {
+        auto toView = tx->to();
+        auto to = std::string(toView.starts_with("0x") ? toView.substr(2) : toView);
+        toChecksumAddress(to, bcos::crypto::keccak256Hash(bcos::bytesConstRef(to)).hex());
+        writer.member("to", "0x" + std::move(to));
+    }
+    writer.member("cumulativeGasUsed", toQuantity(cumulativeGasUsed));
+    auto effectiveGasPrice = receipt->effectiveGasPrice();
+    writer.member("effectiveGasPrice",
+        effectiveGasPrice.empty() ? std::string_view("0x0") : effectiveGasPrice);
+    writer.member("gasUsed", toQuantity(receipt->gasUsed()));
+    if (receipt->contractAddress().empty())
+    {
+        writer.key("contractAddress").null();
+    }
+    else
+    {
+        auto contractAddress = std::string(receipt->contractAddress());
+        toChecksumAddress(contractAddress,
+            bcos::crypto::keccak256Hash(bcos::bytesConstRef(contractAddress)).hex());
+        writer.member("contractAddress", "0x" + std::move(contractAddress));
+    }
+    writer.key("logs").startArray();
+    auto* mutableReceipt = const_cast<bcos::protocol::TransactionReceipt*>(receipt.get());
+    auto receiptLog = mutableReceipt->takeLogEntries();
+    for (size_t i = 0; i < receiptLog.size(); i++)
+    {
+        writer.startObject();
+        auto address = std::string(receiptLog[i].address());
+        toChecksumAddress(address, bcos::crypto::keccak256Hash(bcos::bytesConstRef(address)).hex());
+        writer.member("address", "0x" + std::move(address));
+        writer.key("topics").startArray();
+        for (const auto& topic : receiptLog[i].topics())
+        {
+            writer.hexValue(topic.ref());
+        }
+        writer.endArray();
+        writer.key("data").hexValue(receiptLog[i].data());
+        writer.member("logIndex", toQuantity(i));
+        writer.member("blockNumber", toQuantity(blockNumber));
+        writer.key("blockHash").hexValue(blockHash.ref());
+        writer.member("transactionIndex", toQuantity(transactionIndex));
+        writer.key("transactionHash").hexValue(tx->hash().ref());
+        writer.member("removed", false);
+        writer.endObject();
+    }
+    writer.endArray();
+    Logs logs;
+    logs.reserve(receiptLog.size());
+    for (size_t i = 0; i < receiptLog.size(); i++)
+    {
+        rpc::Log log{.address = std::move(receiptLog[i].takeAddress()),
+            .topics = std::move(receiptLog[i].takeTopics()),
+            .data = std::move(receiptLog[i].takeData())};
+        log.logIndex = i;
+        logs.push_back(std::move(log));
+    }
+    auto logsBloom = getLogsBloom(logs);
+    writer.key("logsBloom").hexValue(logsBloom);
+    auto type = TransactionType::Legacy;
+    if (!tx->extraTransactionBytes().empty())
+    {
+        if (auto firstByte = tx->extraTransactionBytes()[0];
+            firstByte < bcos::codec::rlp::BYTES_HEAD_BASE)
+        {
+            type = static_cast<TransactionType>(firstByte);
+        }
+    }
+    writer.member("type", toQuantity(static_cast<uint64_t>(type)));
+    writer.endObject();
+}
 }  // namespace bcos::rpc
@@ -26,6 +26,7 @@
 #include <bcos-framework/protocol/Block.h>
 #include <bcos-framework/protocol/ProtocolTypeDef.h>
 #include <bcos-framework/protocol/Transaction.h>
+#include <bcos-rpc/jsonrpc/JsonWriter.h>
 #include <bcos-utilities/Common.h>
 #include <bcos-utilities/DataConvertUtility.h>
 #include <json/json.h>
@@ -158,4 +159,106 @@ static void combineTxResponse(Json::Value& result, bcos::protocol::Transaction::
     result["s"] = toQuantity(tx->signatureData().getCroppedData(32, 32));
     result["v"] = toQuantity(tx->signatureData().getCroppedData(64, 1));
 }
+
+// write the same members as combineTxResponse without the receipt, the transaction is in the block
+// of the hash and the number at the index
+[[maybe_unused]] static void writeTxResponse(JsonWriter& writer,
+    bcos::protocol::Transaction const& tx, crypto::HashType const& blockHash, uint64_t blockNumber,
+    size_t transactionIndex)
+{
+    writer.startObject();
+    writer.key("blockHash").hexValue(blockHash.ref());
+    writer.member("blockNumber", toQuantity(blockNumber));
+    writer.member("transactionIndex", toQuantity(transactionIndex));
+    auto from = toHex(tx.sender());
+    toChecksumAddress(from, bcos::crypto::keccak256Hash(bcos::bytesConstRef(from)).hex());
+    writer.member("from", "0x" + std::move(from));
+    if (tx.to().empty())
+    {
+        writer.key("to").null();
+    }
+    else
+    {
+        auto toView = tx.to();
+        auto to = std::string(toView.starts_with("0x") ? toView.substr(2) : toView);
+        toChecksumAddress(to, bcos::crypto::keccak256Hash(bcos::bytesConstRef(to)).hex());
+        writer.member("to", "0x" + std::move(to));
+    }
+    writer.member("gas", toQuantity(tx.gasLimit()));
+    auto gasPrice = tx.gasPrice();
+    writer.member("gasPrice", gasPrice.empty() ? std::string_view("0x0") : gasPrice);
+    writer.key("hash").hexValue(tx.hash().ref());
+    writer.key("input").hexValue(tx.input());
+
+    if (tx.type() == bcos::protocol::TransactionType::BCOSTransaction) [[unlikely]]
+    {
+        writer.member("type", toQuantity(0));
+        // web3 tools do not compatible with too long hex
+        writer.member("nonce", "0x" + std::string(tx.nonce()));
+        writer.member("value", tx.value().empty() ? std::string_view("0x0") : tx.value());
+        auto maxPriorityFeePerGas = tx.maxPriorityFeePerGas();
+        writer.member("maxPriorityFeePerGas",
+            maxPriorityFeePerGas.empty() ? std::string_view("0x0") : maxPriorityFeePerGas);
+        writer.member("maxFeePerGas",
+            tx.maxFeePerGas().empty() ? std::string_view("0x0") : tx.maxFeePerGas());
+        writer.member("chainId", "0x0");
+    }
+    else [[likely]]
+    {
+        Web3Transaction web3Tx;
+        auto extraBytesRef = bcos::bytesRef(const_cast<byte*>(tx.extraTransactionBytes().data()),
+            tx.extraTransactionBytes().size());
+        codec::rlp::decodeFromPayload(extraBytesRef, web3Tx);
+        writer.member("nonce", toQuantity(web3Tx.nonce));
+        writer.member("type", toQuantity(static_cast<uint8_t>(web3Tx.type)));
+        writer.member("value", toQuantity(web3Tx.value));
+        // the arrays start with the nulls of the resize in combineTxResponse
+        auto writeNulls = [&writer](size_t count) {
+            for (size_t i = 0; i < count; i++)
+            {
+                writer.null();
+            }
+        };
+        if (web3Tx.type >= TransactionType::EIP2930)
+        {
+            writer.key("accessList").startArray();
+            writeNulls(web3Tx.accessList.size());
+            for (const auto& accessList : web3Tx.accessList)
+            {
+                writer.startObject();
+                writer.key("address").hexValue(accessList.account.ref());
+                writer.key("storageKeys").startArray();
+                writeNulls(accessList.storageKeys.size());
+                for (const auto& storageKey : accessList.storageKeys)
+                {
+                    writer.hexValue(storageKey.ref());
+                }
+                writer.endArray();
+                writer.endObject();
+            }
+            writer.endArray();
+        }
+        if (web3Tx.type >= TransactionType::EIP1559)
+        {
+            writer.member("maxPriorityFeePerGas", toQuantity(web3Tx.maxPriorityFeePerGas));
+            writer.member("maxFeePerGas", toQuantity(web3Tx.maxFeePerGas));
+        }
+        writer.member("chainId", toQuantity(web3Tx.chainId.value_or(0)));
+        if (web3Tx.type >= TransactionType::EIP4844)
+        {
+            writer.member("maxFeePerBlobGas", web3Tx.maxFeePerBlobGas.str());
+            writer.key("blobVersionedHashes").startArray();
+            writeNulls(web3Tx.blobVersionedHashes.size());
+            for (const auto& hash : web3Tx.blobVersionedHashes)
+            {
+                writer.hexValue(hash.ref());
+            }
+            writer.endArray();
+        }
+    }
+    writer.member("r", toQuantity(tx.signatureData().getCroppedData(0, 32)));
+    writer.member("s", toQuantity(tx.signatureData().getCroppedData(32, 32)));
+    writer.member("v", toQuantity(tx.signatureData().getCroppedData(64, 1)));
+    writer.endObject();
+}
 }  // namespace bcos::rpc
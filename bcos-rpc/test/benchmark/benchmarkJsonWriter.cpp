@@ -0,0 +1,140 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @brief the time and the allocations of the getBlockByNumber response with the full
+ * transactions: building the Json::Value tree and serializing it, and writing the json directly
+ * @file benchmarkJsonWriter.cpp
+ */
+
+#include <bcos-crypto/hash/Keccak256.h>
+#include <bcos-crypto/interfaces/crypto/CryptoSuite.h>
+#include <bcos-crypto/signature/secp256k1/Secp256k1Crypto.h>
+#include <bcos-rpc/jsonrpc/JsonRpcImpl_2_0.h>
+#include <bcos-rpc/jsonrpc/JsonWriter.h>
+#include <bcos-tars-protocol/protocol/BlockFactoryImpl.h>
+#include <bcos-tars-protocol/protocol/BlockHeaderFactoryImpl.h>
+#include <bcos-tars-protocol/protocol/TransactionFactoryImpl.h>
+#include <bcos-tars-protocol/protocol/TransactionReceiptFactoryImpl.h>
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+namespace
+{
+std::atomic<size_t> g_allocations{0};
+}  // namespace
+
+void* operator new(size_t _size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (auto* pointer = std::malloc(_size == 0 ? 1 : _size))
+    {
+        return pointer;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* _pointer) noexcept
+{
+    std::free(_pointer);
+}
+
+void operator delete(void* _pointer, size_t /*unused*/) noexcept
+{
+    std::free(_pointer);
+}
+
+namespace
+{
+bcos::protocol::Block::Ptr buildBlock(size_t _txCount)
+{
+    auto cryptoSuite = std::make_shared<bcos::crypto::CryptoSuite>(
+        std::make_shared<bcos::crypto::Keccak256>(),
+        std::make_shared<bcos::crypto::Secp256k1Crypto>(), nullptr);
+    auto blockHeaderFactory =
+        std::make_shared<bcostars::protocol::BlockHeaderFactoryImpl>(cryptoSuite);
+    auto txFactory = std::make_shared<bcostars::protocol::TransactionFactoryImpl>(cryptoSuite);
+    auto receiptFactory =
+        std::make_shared<bcostars::protocol::TransactionReceiptFactoryImpl>(cryptoSuite);
+    auto blockFactory = std::make_shared<bcostars::protocol::BlockFactoryImpl>(
+        cryptoSuite, blockHeaderFactory, txFactory, receiptFactory);
+
+    auto keyPair = cryptoSuite->signatureImpl()->generateKeyPair();
+    auto block = blockFactory->createBlock();
+    auto blockHeader = blockHeaderFactory->createBlockHeader(100);
+    blockHeader->setTimestamp(utcTime());
+    blockHeader->setSealerList(std::vector<bytes>{keyPair->publicKey()->data()});
+    blockHeader->setConsensusWeights(std::vector<uint64_t>{1});
+    blockHeader->calculateHash(*cryptoSuite->hashImpl());
+    block->setBlockHeader(blockHeader);
+
+    // the erc20 transfer input
+    bytes input(68, 0xab);
+    for (size_t i = 0; i < _txCount; ++i)
+    {
+        auto tx = txFactory->createTransaction(0, "0x2f8ec4e2b8d0a1e5e3c8a1f2d3b4c5d6e7f80910",
+            input, std::to_string(i), 1000, "chain0", "group0", utcTime(), *keyPair);
+        block->appendTransaction(std::move(tx));
+    }
+    return block;
+}
+
+void domResponse(benchmark::State& state)
+{
+    auto block = buildBlock(state.range(0));
+    size_t bytes = 0;
+    auto allocations = g_allocations.load();
+    for (auto _ : state)
+    {
+        JsonResponse response{.jsonrpc = "2.0", .id = 1};
+        toJsonResp(response.result, *block, false);
+        auto out = toStringResponse(std::move(response));
+        bytes += out.size();
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed((int64_t)bytes);
+    state.counters["allocs_per_iter"] = benchmark::Counter(
+        (double)(g_allocations.load() - allocations), benchmark::Counter::kAvgIterations);
+}
+
+void streamResponse(benchmark::State& state)
+{
+    auto block = buildBlock(state.range(0));
+    size_t bytes = 0;
+    auto allocations = g_allocations.load();
+    for (auto _ : state)
+    {
+        JsonResponse response{.jsonrpc = "2.0", .id = 1};
+        bcos::bytes result;
+        JsonWriter writer(result);
+        toJsonResp(writer, *block, false);
+        auto out = toStringResponse(response, result);
+        bytes += out.size();
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetBytesProcessed((int64_t)bytes);
+    state.counters["allocs_per_iter"] = benchmark::Counter(
+        (double)(g_allocations.load() - allocations), benchmark::Counter::kAvgIterations);
+}
+}  // namespace
+
+BENCHMARK(domResponse)->Arg(1000)->Arg(10000)->ArgName("txs")->Unit(benchmark::kMillisecond);
+BENCHMARK(streamResponse)->Arg(1000)->Arg(10000)->ArgName("txs")->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,153 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file EventSubTest.cpp
+ */
+
+#include "../common/RPCFixture.h"
+#include <bcos-rpc/event/EventSubBlockCache.h>
+#include <bcos-rpc/event/EventSubMatcher.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::event;
+using namespace bcos::protocol;
+
+namespace bcos::test
+{
+namespace
+{
+EventBlockLogs::ConstPtr getBlockLogs(EventSubBlockCache& _cache,
+    ledger::LedgerInterface::Ptr _ledger, BlockNumber _number, Error::Ptr* _error = nullptr)
+{
+    EventBlockLogs::ConstPtr result;
+    // the fake ledger calls back in place
+    _cache.asyncGetBlockLogs("group0", std::move(_ledger), _number,
+        [&](Error::Ptr _e, EventBlockLogs::ConstPtr _blockLogs) {
+            if (_error)
+            {
+                *_error = std::move(_e);
+            }
+            result = std::move(_blockLogs);
+        });
+    return result;
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(testEventSub, RPCFixture)
+
+BOOST_AUTO_TEST_CASE(blockLogs)
+{
+    auto block = m_ledger->ledgerData()[1];
+    EventBlockLogs blockLogs(1, *block);
+
+    size_t logCount = 0;
+    for (size_t i = 0; i < block->receiptsSize(); ++i)
+    {
+        logCount += block->receipt(i)->logEntries().size();
+    }
+    BOOST_CHECK_GT(logCount, 0);
+    BOOST_CHECK_EQUAL(blockLogs.number(), 1);
+    BOOST_CHECK_EQUAL(blockLogs.logs().size(), logCount);
+
+    const auto& logEntry = block->receipt(0)->logEntries()[0];
+    const auto* addressLogs = blockLogs.addressLogs(std::string(logEntry.address()));
+    BOOST_REQUIRE(addressLogs);
+    BOOST_CHECK_EQUAL(addressLogs->front(), 0);
+    BOOST_CHECK(std::is_sorted(addressLogs->begin(), addressLogs->end()));
+    const auto* topicLogs = blockLogs.topicLogs(logEntry.topics()[0].hex());
+    BOOST_REQUIRE(topicLogs);
+    BOOST_CHECK_EQUAL(topicLogs->front(), 0);
+    BOOST_CHECK(blockLogs.addressLogs("not exists") == nullptr);
+    BOOST_CHECK(blockLogs.topicLogs(h256().hex()) == nullptr);
+
+    const auto& result = blockLogs.logs()[0].result;
+    BOOST_CHECK_EQUAL(
+        result["transactionHash"].asString(), block->transaction(0)->hash().hexPrefixed());
+    BOOST_CHECK_EQUAL(result["topics"][0].asString(), logEntry.topics()[0].hexPrefixed());
+}
+
+BOOST_AUTO_TEST_CASE(matchBlockLogs)
+{
+    auto block = m_ledger->ledgerData()[2];
+    EventBlockLogs blockLogs(2, *block);
+    EventSubMatcher matcher;
+    const auto& first = block->receipt(0)->logEntries()[0];
+    const auto& last = block->receipt(block->receiptsSize() - 1)->logEntries().back();
+
+    auto params = std::make_shared<EventSubParams>();
+    std::vector<EventSubParams::Ptr> paramsList;
+    // all logs
+    paramsList.push_back(params);
+    // by address
+    params = std::make_shared<EventSubParams>();
+    params->addAddress(std::string(first.address()));
+    params->addAddress(std::string(last.address()));
+    paramsList.push_back(params);
+    // by the first topic
+    params = std::make_shared<EventSubParams>();
+    params->addTopic(0, last.topics()[0].hex());
+    paramsList.push_back(params);
+    // by address and the first topic of the other log
+    params = std::make_shared<EventSubParams>();
+    params->addAddress(std::string(first.address()));
+    params->addTopic(0, last.topics()[0].hex());
+    paramsList.push_back(params);
+    // by nothing in the block
+    params = std::make_shared<EventSubParams>();
+    params->addTopic(0, h256().hex());
+    paramsList.push_back(params);
+
+    // the routed match pushes the same logs in the same order as the match of the whole block
+    for (const auto& item : paramsList)
+    {
+        Json::Value expected(Json::arrayValue);
+        auto expectedCount = matcher.matches(item, block, expected);
+        Json::Value result(Json::arrayValue);
+        auto count = matcher.matches(item, blockLogs, result);
+        BOOST_CHECK_EQUAL(count, expectedCount);
+        BOOST_CHECK(result == expected);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(blockCache)
+{
+    auto cache = std::make_shared<EventSubBlockCache>(2);
+
+    auto blockLogs = getBlockLogs(*cache, m_ledger, 1);
+    BOOST_REQUIRE(blockLogs);
+    BOOST_CHECK_EQUAL(blockLogs->number(), 1);
+    BOOST_CHECK_EQUAL(cache->size(), 1);
+    // loaded once and shared
+    BOOST_CHECK(getBlockLogs(*cache, m_ledger, 1) == blockLogs);
+
+    // the failed load is not cached
+    Error::Ptr error;
+    BOOST_CHECK(!getBlockLogs(*cache, m_ledger, 100, &error));
+    BOOST_CHECK(error);
+    BOOST_CHECK_EQUAL(cache->size(), 1);
+
+    // the earliest loaded block is evicted
+    BOOST_CHECK(getBlockLogs(*cache, m_ledger, 2));
+    BOOST_CHECK(getBlockLogs(*cache, m_ledger, 3));
+    BOOST_CHECK_EQUAL(cache->size(), 2);
+    auto reloaded = getBlockLogs(*cache, m_ledger, 1);
+    BOOST_REQUIRE(reloaded);
+    BOOST_CHECK(reloaded != blockLogs);
+    BOOST_CHECK_EQUAL(reloaded->logs().size(), blockLogs->logs().size());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
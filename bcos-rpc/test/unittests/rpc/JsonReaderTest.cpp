@@ -0,0 +1,87 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file JsonReaderTest.cpp
+ */
+
+#include <bcos-rpc/jsonrpc/JsonReader.h>
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+namespace bcos::test
+{
+BOOST_FIXTURE_TEST_SUITE(testJsonReader, TestPromptFixture)
+
+BOOST_AUTO_TEST_CASE(sameAsJsonReader)
+{
+    std::vector<std::string> inputs = {
+        R"({"jsonrpc":"2.0","method":"sendTransaction","params":["group0","","0x1a2b3c4d5e6f7a8b9c0d",false],"id":1})",
+        R"( { "a" : [ 1 , -2 , 3.5 , 1e3 , -0 , true , false , null ] , "b" : { } , "c" : [ ] } )",
+        R"({"escape":"\"\\\/\b\f\n\r\tAé中😀","utf8":"中文"})",
+        R"([9223372036854775807,9223372036854775808,-9223372036854775808,18446744073709551616])",
+        R"({"dup":1,"dup":2})",
+        R"("top level string")",
+    };
+    for (const auto& input : inputs)
+    {
+        Json::Value expected;
+        BOOST_CHECK(Json::Reader().parse(input, expected));
+        Json::Value value;
+        BOOST_CHECK(JsonReader::parse(input, value));
+        BOOST_CHECK_EQUAL(Json::FastWriter().write(value), Json::FastWriter().write(expected));
+        BOOST_CHECK_EQUAL(value.type(), expected.type());
+    }
+
+    Json::Value value;
+    BOOST_CHECK(JsonReader::parse("[1,18446744073709551615]", value));
+    BOOST_CHECK(value[0].isInt64() && value[0].type() == Json::intValue);
+    BOOST_CHECK(value[1].type() == Json::uintValue);
+}
+
+BOOST_AUTO_TEST_CASE(fallback)
+{
+    // rejected by the fast path, parseJson gives the Json::Reader result
+    std::vector<std::string> inputs = {"", "{", R"({"a":1,})", R"({"a":01})", "[1] // comment",
+        R"(["\ud800"])", "{\"a\":\"\x01\"}", std::string(JsonReader::MAX_DEPTH + 2, '[')};
+    for (const auto& input : inputs)
+    {
+        Json::Value value;
+        BOOST_CHECK(!JsonReader::parse(input, value));
+
+        Json::Value expected;
+        auto expectedResult = false;
+        try
+        {
+            expectedResult = Json::Reader().parse(input, expected);
+        }
+        catch (std::exception const&)
+        {
+            BOOST_CHECK_THROW(parseJson(input, value), std::exception);
+            continue;
+        }
+        Json::Value result;
+        BOOST_CHECK_EQUAL(parseJson(input, result), expectedResult);
+        if (expectedResult)
+        {
+            BOOST_CHECK_EQUAL(Json::FastWriter().write(result), Json::FastWriter().write(expected));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
@@ -0,0 +1,296 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file JsonWriterTest.cpp
+ */
+
+#include "../common/RPCFixture.h"
+#include <bcos-rpc/jsonrpc/JsonRpcImpl_2_0.h>
+#include <bcos-rpc/filter/LogMatcher.h>
+#include <bcos-rpc/jsonrpc/JsonWriter.h>
+#include <bcos-rpc/web3jsonrpc/model/BlockResponse.h>
+#include <bcos-rpc/web3jsonrpc/model/ReceiptResponse.h>
+#include <bcos-rpc/web3jsonrpc/model/Web3FilterRequest.h>
+#include <boost/test/unit_test.hpp>
+#include <limits>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+namespace bcos::test
+{
+namespace
+{
+std::string toString(bcos::bytes const& _buffer)
+{
+    return {(const char*)_buffer.data(), _buffer.size()};
+}
+
+// the compact output of the jsoncpp StreamWriter, the same as the responses serialized before
+std::string toJsoncppString(const Json::Value& _value)
+{
+    Json::StreamWriterBuilder builder;
+    builder["commentStyle"] = "None";
+    builder["indentation"] = "";
+    return Json::writeString(builder, _value);
+}
+
+// parse and serialize again, the members of the objects are sorted by jsoncpp
+std::string normalize(std::string const& _json)
+{
+    Json::Value value;
+    Json::Reader reader;
+    BOOST_CHECK(reader.parse(_json, value));
+    return toJsoncppString(value);
+}
+
+// the receipts give away the log entries when serialized, every serialization takes a new copy
+protocol::Block::Ptr copyBlock(protocol::BlockFactory& _blockFactory, protocol::Block& _block)
+{
+    bcos::bytes encoded;
+    _block.encode(encoded);
+    return _blockFactory.createBlock(encoded, true, false);
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(testJsonWriter, RPCFixture)
+
+BOOST_AUTO_TEST_CASE(writeValues)
+{
+    bcos::bytes buffer;
+    JsonWriter writer(buffer);
+    writer.startObject()
+        .member("str", "a\"b\\c\n\x01")
+        .member("int", -1)
+        .member("uint", (uint64_t)18446744073709551615ULL)
+        .member("bool", true)
+        .key("null")
+        .null()
+        .key("hex")
+        .hexValue(bcos::bytes{0x00, 0xab, 0xff})
+        .key("array")
+        .startArray()
+        .value(1)
+        .startObject()
+        .endObject()
+        .startArray()
+        .endArray()
+        .endArray()
+        .endObject();
+    BOOST_CHECK_EQUAL(toString(buffer),
+        "{\"str\":\"a\\\"b\\\\c\\n\\u0001\",\"int\":-1,\"uint\":18446744073709551615,"
+        "\"bool\":true,\"null\":null,\"hex\":\"0x00abff\",\"array\":[1,{},[]]}");
+}
+
+BOOST_AUTO_TEST_CASE(jsoncppFormat)
+{
+    // the strings and the doubles are written the same as jsoncpp
+    std::vector<Json::Value> values{
+        // valid 2, 3 and 4 bytes sequences and the control characters
+        "\xc3\xa9\xe4\xb8\xad\xf0\x9f\x98\x80",
+        "\x7f\x1f/",
+        // lone continuation byte and invalid lead byte
+        "a\x80"
+        "b\xff"
+        "c",
+        // truncated sequence at the end and before an ascii
+        "\xe4\xb8",
+        "\xe4\xb8z",
+        // overlong, surrogate and above U+10FFFF
+        "\xc0\xaf",
+        "\xed\xa0\x80",
+        "\xf4\x90\x80\x80",
+        0.0,
+        -0.0,
+        0.1,
+        3.0,
+        1.0 / 3,
+        1e300,
+        -5e-324,
+        std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(),
+    };
+    for (const auto& value : values)
+    {
+        bcos::bytes buffer;
+        JsonWriter(buffer).value(value);
+        BOOST_CHECK_EQUAL(toString(buffer), toJsoncppString(value));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(writeJsonValue)
+{
+    Json::Value value;
+    value["number"] = 100;
+    value["real"] = 1.5;
+    value["text"] = "中文\t";
+    value["中文"] = "\xf0\x9f\x98\x80";
+    value["list"] = Json::Value(Json::arrayValue);
+    value["list"].append(Json::Value());
+    value["list"].append(false);
+    value["list"].append(Json::Value::minInt64);
+    value["list"].append(Json::Value::maxUInt64);
+    value["nested"]["key"] = "value";
+    value["nested"]["empty"] = Json::Value(Json::objectValue);
+
+    bcos::bytes buffer;
+    JsonWriter(buffer).value(value);
+    BOOST_CHECK_EQUAL(toString(buffer), toJsoncppString(value));
+}
+
+BOOST_AUTO_TEST_CASE(writeBlock)
+{
+    for (const auto& block : m_ledger->ledgerData())
+    {
+        for (auto onlyTxHash : {false, true})
+        {
+            Json::Value expected;
+            toJsonResp(expected, *block, onlyTxHash);
+
+            bcos::bytes buffer;
+            JsonWriter writer(buffer);
+            toJsonResp(writer, *block, onlyTxHash);
+            BOOST_CHECK_EQUAL(normalize(toString(buffer)), toJsoncppString(expected));
+        }
+
+        Json::Value expectedHeader;
+        toJsonResp(expectedHeader, block->blockHeader());
+        bcos::bytes buffer;
+        JsonWriter writer(buffer);
+        toJsonResp(writer, block->blockHeader());
+        BOOST_CHECK_EQUAL(normalize(toString(buffer)), toJsoncppString(expectedHeader));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(writeReceipt)
+{
+    for (const auto& block : m_ledger->ledgerData())
+    {
+        for (size_t i = 0; i < block->receiptsSize(); ++i)
+        {
+            auto const& receipt = *block->receipt(i);
+            auto txHash = block->transaction(i)->hash().hex();
+            auto status = protocol::TransactionStatus::None;
+            for (auto isWasm : {false, true})
+            {
+                Json::Value expected;
+                toJsonResp(expected, txHash, status, receipt, isWasm, *hashImpl);
+
+                bcos::bytes buffer;
+                JsonWriter writer(buffer);
+                toJsonResp(writer, txHash, status, receipt, isWasm, *hashImpl);
+                BOOST_CHECK_EQUAL(normalize(toString(buffer)), toJsoncppString(expected));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(writeWeb3Block)
+{
+    for (const auto& block : m_ledger->ledgerData())
+    {
+        for (auto fullTxs : {false, true})
+        {
+            Json::Value expected;
+            combineBlockResponse(expected, copyBlock(*m_blockFactory, *block), fullTxs);
+
+            bcos::bytes buffer;
+            JsonWriter writer(buffer);
+            writeBlockResponse(writer, *block, fullTxs);
+            BOOST_CHECK_EQUAL(normalize(toString(buffer)), toJsoncppString(expected));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(writeWeb3Receipt)
+{
+    for (const auto& block : m_ledger->ledgerData())
+    {
+        for (size_t i = 0; i < block->receiptsSize(); ++i)
+        {
+            Json::Value expected;
+            auto expectedBlock = copyBlock(*m_blockFactory, *block);
+            combineReceiptResponse(expected, expectedBlock->receipt(i),
+                expectedBlock->transaction(i), std::move(expectedBlock));
+
+            auto writtenBlock = copyBlock(*m_blockFactory, *block);
+            bcos::bytes buffer;
+            JsonWriter writer(buffer);
+            writeReceiptResponse(writer, writtenBlock->receipt(i), writtenBlock->transaction(i),
+                std::move(writtenBlock));
+            BOOST_CHECK_EQUAL(normalize(toString(buffer)), toJsoncppString(expected));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(writeLogs)
+{
+    LogMatcher matcher;
+    // all logs
+    auto params = std::make_shared<Web3FilterRequest>();
+    for (const auto& block : m_ledger->ledgerData())
+    {
+        auto expectedBlock = copyBlock(*m_blockFactory, *block);
+        auto blockHash = expectedBlock->blockHeader()->hash();
+        size_t logCount = 0;
+        for (size_t i = 0; i < expectedBlock->receiptsSize(); ++i)
+        {
+            logCount += expectedBlock->receipt(i)->logEntries().size();
+        }
+
+        bcos::bytes buffer;
+        JsonWriter writer(buffer);
+        writer.startArray();
+        auto count = matcher.matches(params, copyBlock(*m_blockFactory, *block), writer);
+        writer.endArray();
+        BOOST_CHECK_EQUAL(count, logCount);
+
+        Json::Value logs;
+        BOOST_REQUIRE(Json::Reader().parse(toString(buffer), logs));
+        BOOST_REQUIRE(logs.isArray());
+        BOOST_REQUIRE_EQUAL(logs.size(), logCount);
+        if (logCount == 0)
+        {
+            continue;
+        }
+        auto const& logEntry = expectedBlock->receipt(0)->logEntries()[0];
+        auto const& log = logs[0U];
+        BOOST_CHECK_EQUAL(log["logIndex"].asString(), "0x0");
+        BOOST_CHECK_EQUAL(log["blockHash"].asString(), blockHash.hexPrefixed());
+        BOOST_CHECK_EQUAL(log["blockNumber"].asString(),
+            toQuantity(expectedBlock->blockHeader()->number()));
+        BOOST_CHECK_EQUAL(log["transactionHash"].asString(),
+            expectedBlock->transaction(0)->hash().hexPrefixed());
+        BOOST_CHECK_EQUAL(log["address"].asString(), "0x" + std::string(logEntry.address()));
+        BOOST_CHECK_EQUAL(log["data"].asString(), toHexStringWithPrefix(logEntry.data()));
+        BOOST_CHECK_EQUAL(log["topics"].size(), logEntry.topics().size());
+        BOOST_CHECK(!log["removed"].asBool());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(rawResponse)
+{
+    JsonResponse response{.jsonrpc = "2.0", .id = 1};
+    response.result = "0x1";
+    auto expected = toStringResponse(response);
+
+    bcos::bytes result;
+    JsonWriter(result).value("0x1");
+    BOOST_CHECK_EQUAL(toString(toStringResponse(response, result)), toString(expected));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
@@ -0,0 +1,109 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file LogIndexTest.cpp
+ */
+
+#include <bcos-rpc/filter/LogIndex.h>
+#include <bcos-rpc/jsonrpc/JsonRpcFilterSystem.h>
+#include <bcos-utilities/DataConvertUtility.h>
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::rpc;
+using namespace bcos::protocol;
+
+namespace bcos::test
+{
+namespace
+{
+const std::string c_addressA = "22341ae42d6dd7384bc8584e50419ea3ac75b83f";
+const std::string c_addressB = "e7fb22dfef11920312e4989a3a2b81e2ebf05986";
+const h256 c_topicA("04491edcd115127caedbd478e2e7895ed80c7847e903431f94f9cfa579cad47f");
+const h256 c_topicB("7f1fef85c4b037150d3675218e0cdb7cf38fea354759471e309f3354918a442f");
+
+LogEntries makeLogs(std::string const& _address, h256 const& _topic)
+{
+    LogEntries logEntries;
+    logEntries.emplace_back(asBytes(_address), h256s{_topic}, bytes{});
+    return logEntries;
+}
+}  // namespace
+
+BOOST_FIXTURE_TEST_SUITE(testLogIndex, TestPromptFixture)
+
+BOOST_AUTO_TEST_CASE(candidates)
+{
+    for (auto invertedIndex : {false, true})
+    {
+        LogIndex logIndex(LogIndex::DEFAULT_MAX_SECTIONS, invertedIndex);
+        logIndex.addBlock(1, makeLogs(c_addressA, c_topicA));
+        logIndex.addBlock(2, LogEntries{});
+        logIndex.addBlock(3, makeLogs(c_addressB, c_topicB));
+        BOOST_CHECK(logIndex.indexed(2));
+        BOOST_CHECK(!logIndex.indexed(4));
+
+        // the blocks not indexed are always candidates, the block without logs never
+        JsonRpcFilterRequest anyLogs;
+        auto result = logIndex.candidates(LogIndex::makeQuery(anyLogs), 0, 5);
+        BOOST_CHECK(result == std::vector<BlockNumber>({0, 1, 3, 4, 5}));
+
+        JsonRpcFilterRequest byAddress;
+        byAddress.addAddress("0x" + c_addressA);
+        result = logIndex.candidates(LogIndex::makeQuery(byAddress), 0, 5);
+        BOOST_CHECK(result == std::vector<BlockNumber>({0, 1, 4, 5}));
+
+        JsonRpcFilterRequest byTopic;
+        byTopic.resizeTopic(1);
+        byTopic.addTopic(0, c_topicB.hexPrefixed());
+        result = logIndex.candidates(LogIndex::makeQuery(byTopic), 1, 3);
+        BOOST_CHECK(result == std::vector<BlockNumber>({3}));
+
+        // address of one block and topic of the other
+        JsonRpcFilterRequest mismatch;
+        mismatch.addAddress("0x" + c_addressA);
+        mismatch.resizeTopic(1);
+        mismatch.addTopic(0, c_topicB.hexPrefixed());
+        result = logIndex.candidates(LogIndex::makeQuery(mismatch), 1, 3);
+        BOOST_CHECK(result.empty());
+
+        // the limit counts the candidates, not the blocks skipped by the index
+        result = logIndex.candidates(LogIndex::makeQuery(byAddress), 1, 100, 2);
+        BOOST_CHECK(result == std::vector<BlockNumber>({1, 4}));
+        result = logIndex.candidates(LogIndex::makeQuery(anyLogs), 0, 5, 0);
+        BOOST_CHECK(result.empty());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(evictSection)
+{
+    LogIndex logIndex(2, false);
+    logIndex.addBlock(1, makeLogs(c_addressA, c_topicA));
+    logIndex.addBlock(LogIndex::SECTION_SIZE + 1, makeLogs(c_addressA, c_topicA));
+    BOOST_CHECK_EQUAL(logIndex.sectionSize(), 2);
+
+    // touch the first section, the second one is the least recently used
+    JsonRpcFilterRequest anyLogs;
+    logIndex.candidates(LogIndex::makeQuery(anyLogs), 0, 1);
+    logIndex.addBlock(LogIndex::SECTION_SIZE * 2 + 1, makeLogs(c_addressB, c_topicB));
+    BOOST_CHECK_EQUAL(logIndex.sectionSize(), 2);
+    BOOST_CHECK(logIndex.indexed(1));
+    BOOST_CHECK(!logIndex.indexed(LogIndex::SECTION_SIZE + 1));
+    BOOST_CHECK(logIndex.indexed(LogIndex::SECTION_SIZE * 2 + 1));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
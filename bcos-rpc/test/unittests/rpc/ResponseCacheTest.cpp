@@ -0,0 +1,103 @@
+/**
+ *  Copyright (C) 2024 FISCO BCOS.
+ *  SPDX-License-Identifier: Apache-2.0
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ * @file ResponseCacheTest.cpp
+ */
+
+#include "../common/RPCFixture.h"
+#include <bcos-rpc/jsonrpc/ResponseCache.h>
+#include <bcos-utilities/testutils/TestPromptFixture.h>
+#include <boost/test/unit_test.hpp>
+#include <future>
+
+using namespace bcos;
+using namespace bcos::rpc;
+
+namespace bcos::test
+{
+BOOST_FIXTURE_TEST_SUITE(testResponseCache, RPCFixture)
+
+BOOST_AUTO_TEST_CASE(putAndEvict)
+{
+    auto entry = [](size_t _size) { return bcos::bytes(_size, '1'); };
+    // about 4 entries of 100 bytes
+    ResponseCache cache(4 * (100 + ResponseCache::ENTRY_OVERHEAD + 2));
+    BOOST_CHECK(!cache.get("k0"));
+    cache.put("k0", entry(100));
+    cache.put("k1", entry(100));
+    BOOST_CHECK(cache.get("k0") && *cache.get("k0") == entry(100));
+    BOOST_CHECK_EQUAL(cache.hits(), 2U);
+    BOOST_CHECK_EQUAL(cache.misses(), 1U);
+
+    // the empty result, the null result and the too large result are not cached
+    cache.put("empty", {});
+    cache.put("null", bcos::bytes{'n', 'u', 'l', 'l'});
+    cache.put("large", entry(cache.capacity() / 2));
+    BOOST_CHECK_EQUAL(cache.size(), 2U);
+
+    // the least recently used k1 is evicted
+    cache.put("k2", entry(100));
+    cache.put("k3", entry(100));
+    cache.put("k4", entry(100));
+    BOOST_CHECK(cache.memory() <= cache.capacity());
+    BOOST_CHECK(!cache.get("k1"));
+    BOOST_CHECK(cache.get("k0"));
+    BOOST_CHECK(cache.get("k4"));
+
+    // the block number only moves forward, the lower number of the lagging node is ignored
+    BOOST_CHECK_EQUAL(cache.blockNumber("group0"), -1);
+    cache.onNewBlock("group0", 10);
+    cache.onNewBlock("group0", 11);
+    BOOST_CHECK_EQUAL(cache.blockNumber("group0"), 11);
+    auto size = cache.size();
+    cache.onNewBlock("group0", 9);
+    BOOST_CHECK_EQUAL(cache.blockNumber("group0"), 11);
+    BOOST_CHECK_EQUAL(cache.size(), size);
+    BOOST_CHECK(cache.get("k0"));
+    cache.onNewBlock("group1", 5);
+    BOOST_CHECK_EQUAL(cache.blockNumber("group1"), 5);
+    BOOST_CHECK_EQUAL(cache.blockNumber("group0"), 11);
+}
+
+BOOST_AUTO_TEST_CASE(cachedBlock)
+{
+    auto rpc = factory->buildLocalRpc(groupInfo, nodeService);
+    rpc->groupManager()->updateGroupInfo(groupInfo);
+    auto jsonRpcImpl = rpc->jsonRpcImpl();
+    auto cache = std::make_shared<ResponseCache>(1024 * 1024);
+    jsonRpcImpl->setResponseCache(cache);
+
+    auto onRPCRequest = [&](std::string const& request) {
+        std::promise<bcos::bytes> promise;
+        jsonRpcImpl->onRPCRequest(
+            request, [&promise](bcos::bytes resp) { promise.set_value(std::move(resp)); });
+        return promise.get_future().get();
+    };
+    auto request = R"({"jsonrpc":"2.0","id":1,"method":"getBlockByNumber","params":[")" +
+                   groupId + R"(","",1,false,true]})";
+    auto response = onRPCRequest(request);
+    BOOST_CHECK_EQUAL(cache->size(), 1U);
+    BOOST_CHECK_EQUAL(cache->hits(), 0U);
+    BOOST_CHECK(onRPCRequest(request) == response);
+    BOOST_CHECK_EQUAL(cache->hits(), 1U);
+
+    // the block not exists is not cached
+    onRPCRequest(R"({"jsonrpc":"2.0","id":1,"method":"getBlockByNumber","params":[")" + groupId +
+                 R"(","",100000,false,true]})");
+    BOOST_CHECK_EQUAL(cache->size(), 1U);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}  // namespace bcos::test
@@ -71,5 +71,52 @@ BOOST_AUTO_TEST_CASE(jsonRpcTest)
         BOOST_CHECK(intValue > 0);
     });
 }
+
+BOOST_AUTO_TEST_CASE(jsonRpcBatchTest)
+{
+    auto rpc = factory->buildLocalRpc(groupInfo, nodeService);
+    rpc->groupManager()->updateGroupInfo(groupInfo);
+    auto jsonRpcImpl = rpc->jsonRpcImpl();
+    jsonRpcImpl->setBatchConfig({.maxSize = 4, .maxConcurrency = 2});
+
+    auto onRPCRequest = [&](std::string_view request) {
+        std::promise<bcos::bytes> promise;
+        jsonRpcImpl->onRPCRequest(
+            request, [&promise](bcos::bytes resp) { promise.set_value(std::move(resp)); });
+        auto jsonBytes = promise.get_future().get();
+        Json::Value value;
+        Json::Reader reader;
+        reader.parse((const char*)jsonBytes.data(),
+            (const char*)jsonBytes.data() + jsonBytes.size(), value);
+        return value;
+    };
+    auto blockNumber = [this](int64_t _id) {
+        return R"({"jsonrpc":"2.0","id":)" + std::to_string(_id) +
+               R"(,"method":"getBlockNumber","params":[")" + groupId + R"(",""]})";
+    };
+
+    // the responses are in the request order
+    auto response = onRPCRequest("[" + blockNumber(1) + "," +
+                                 R"({"jsonrpc":"2.0","id":2,"method":"unknown","params":[]})" +
+                                 ",1," + blockNumber(4) + "]");
+    BOOST_CHECK(response.isArray());
+    BOOST_CHECK_EQUAL(response.size(), 4U);
+    BOOST_CHECK_EQUAL(response[0]["id"].asInt64(), 1);
+    BOOST_CHECK(response[0]["result"].asInt64() > 0);
+    BOOST_CHECK_EQUAL(response[1]["id"].asInt64(), 2);
+    BOOST_CHECK_EQUAL(response[1]["error"]["code"].asInt(), JsonRpcError::MethodNotFound);
+    BOOST_CHECK_EQUAL(response[2]["error"]["code"].asInt(), JsonRpcError::InvalidRequest);
+    BOOST_CHECK_EQUAL(response[3]["id"].asInt64(), 4);
+    BOOST_CHECK_EQUAL(response[3]["result"], response[0]["result"]);
+
+    // the empty batch and the batch exceeding the limit are rejected as a whole
+    response = onRPCRequest("[]");
+    BOOST_CHECK(response.isObject());
+    BOOST_CHECK_EQUAL(response["error"]["code"].asInt(), JsonRpcError::InvalidRequest);
+    response = onRPCRequest("[" + blockNumber(1) + "," + blockNumber(2) + "," + blockNumber(3) +
+                            "," + blockNumber(4) + "," + blockNumber(5) + "]");
+    BOOST_CHECK(response.isObject());
+    BOOST_CHECK_EQUAL(response["error"]["code"].asInt(), JsonRpcError::InvalidRequest);
+}
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace bcos::test
\ No newline at end of file
@@ -36,9 +36,11 @@
 #include <bcos-framework/testutils/faker/FakeFrontService.h>
 #include <bcos-framework/testutils/faker/FakeLedger.h>
 #include <bcos-framework/testutils/faker/FakeSealer.h>
+#include <bcos-rpc/jsonrpc/JsonReader.h>
 #include <bcos-rpc/tarsRPC/RPCServer.h>
 #include <bcos-rpc/validator/CallValidator.h>
 #include <bcos-rpc/web3jsonrpc/model/Web3Transaction.h>
+#include <bcos-task/Wait.h>
 #include <bcos-utilities/Exceptions.h>
 #include <bcos-utilities/testutils/TestPromptFixture.h>
 
@@ -236,6 +238,98 @@ BOOST_AUTO_TEST_CASE(handleValidTest)
     }
 }
 
+BOOST_AUTO_TEST_CASE(handleBatchTest)
+{
+    web3JsonRpc->setBatchConfig({.maxSize = 3, .maxConcurrency = 2});
+    // the responses are in the request order, the invalid item responds with the error only
+    {
+        const auto request =
+            R"([{"jsonrpc":"2.0","id":1,"method":"eth_chainId","params":[]},"invalid",)"
+            R"({"jsonrpc":"2.0","id":3,"method":"eth_AAA","params":[]}])";
+        auto response = onRPCRequestWrapper(request);
+        BOOST_CHECK(response.isArray());
+        BOOST_CHECK_EQUAL(response.size(), 3U);
+        validRespCheck(response[0]);
+        BOOST_CHECK_EQUAL(response[0]["id"].asInt64(), 1);
+        BOOST_CHECK(response[1]["id"].isNull());
+        BOOST_CHECK_EQUAL(response[1]["error"]["code"].asInt(), InvalidRequest);
+        BOOST_CHECK_EQUAL(response[2]["id"].asInt64(), 3);
+        BOOST_CHECK_EQUAL(response[2]["error"]["code"].asInt(), MethodNotFound);
+    }
+
+    // the empty batch and the batch exceeding the limit are rejected as a whole
+    {
+        auto response = onRPCRequestWrapper("[]");
+        BOOST_CHECK(response.isObject());
+        BOOST_CHECK_EQUAL(response["error"]["code"].asInt(), InvalidRequest);
+
+        const auto request =
+            R"([{"jsonrpc":"2.0","id":1,"method":"eth_chainId","params":[]},)"
+            R"({"jsonrpc":"2.0","id":2,"method":"eth_chainId","params":[]},)"
+            R"({"jsonrpc":"2.0","id":3,"method":"eth_chainId","params":[]},)"
+            R"({"jsonrpc":"2.0","id":4,"method":"eth_chainId","params":[]}])";
+        response = onRPCRequestWrapper(request);
+        BOOST_CHECK(response.isObject());
+        BOOST_CHECK_EQUAL(response["error"]["code"].asInt(), InvalidRequest);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(handleSubscriptionTest)
+{
+    // the subscription needs the websocket session
+    {
+        const auto request =
+            R"({"jsonrpc":"2.0","id":1,"method":"eth_subscribe","params":["newHeads"]})";
+        auto response = onRPCRequestWrapper(request);
+        BOOST_CHECK_EQUAL(response["error"]["code"].asInt(), MethodNotFound);
+    }
+
+    auto subscriptions = web3JsonRpc->subscriptions();
+    std::vector<bcos::bytes> pushed1;
+    std::vector<bcos::bytes> pushed2;
+    auto pusher = [](std::vector<bcos::bytes>& pushed) {
+        return [&pushed](bcos::bytes data) {
+            pushed.emplace_back(std::move(data));
+            return true;
+        };
+    };
+    Json::Value params(Json::arrayValue);
+    params.append("newHeads");
+    auto id1 = subscriptions->subscribe("owner1", params, pusher(pushed1));
+    auto id2 = subscriptions->subscribe("owner2", params, pusher(pushed2));
+    BOOST_CHECK(id1 != id2);
+    // the subscriber gone is removed when pushing
+    subscriptions->subscribe("owner3", params, [](bcos::bytes) { return false; });
+    BOOST_CHECK_EQUAL(subscriptions->size(), 3U);
+
+    Json::Value invalidParams(Json::arrayValue);
+    invalidParams.append("syncing");
+    BOOST_CHECK_THROW(
+        subscriptions->subscribe("owner1", invalidParams, pusher(pushed1)), JsonRpcException);
+
+    task::syncWait(subscriptions->onNewBlock(1));
+    BOOST_CHECK_EQUAL(subscriptions->size(), 2U);
+    BOOST_REQUIRE_EQUAL(pushed1.size(), 1U);
+    BOOST_REQUIRE_EQUAL(pushed2.size(), 1U);
+    Json::Value notification;
+    BOOST_CHECK(parseJson(
+        std::string_view((const char*)pushed1[0].data(), pushed1[0].size()), notification));
+    BOOST_CHECK_EQUAL(notification["method"].asString(), "eth_subscription");
+    BOOST_CHECK_EQUAL(notification["params"]["subscription"].asString(), id1);
+    BOOST_CHECK_EQUAL(notification["params"]["result"]["number"].asString(), toQuantity(1));
+    BOOST_CHECK(!notification["params"]["result"].isMember("transactions"));
+
+    // the same block is pushed once
+    task::syncWait(subscriptions->onNewBlock(1));
+    BOOST_CHECK_EQUAL(pushed1.size(), 1U);
+
+    // only the owner can unsubscribe
+    BOOST_CHECK(!subscriptions->unsubscribe("owner1", id2));
+    BOOST_CHECK(subscriptions->unsubscribe("owner2", id2));
+    subscriptions->removeOwner("owner1");
+    BOOST_CHECK_EQUAL(subscriptions->size(), 0U);
+}
+
 BOOST_AUTO_TEST_CASE(handleWeb3NamespaceValidTest)
 {
     auto validRespCheck = [](Json::Value const& resp) {
@@ -366,12 +366,38 @@ void NodeConfig::loadRpcConfig(boost::property_tree::ptree const& _pt)
         ; 300s
         filter_timeout=300
         filter_max_process_block=10
+        ; the log index of 4096-block sections kept in memory, 0 disables it
+        filter_index_sections=256
+        filter_inverted_index=false
+        ; the max requests of a batch request
+        batch_max_size=500
+        ; the max requests of a batch executed at the same time
+        batch_max_concurrency=64
+        ; the requests of a batch not started in the time budget(ms) respond with the timeout
+        ; error, 0 means no limit
+        batch_timeout=0
+        ; the memory(MB) of the cached block, transaction and receipt responses shared with the
+        ; web3 rpc, 0 disables the cache
+        response_cache_size=64
+        ; the max memory(MB) of the messages waiting to be sent to a websocket session of the rpc
+        ; and the web3 rpc, 0 means no limit
+        write_queue_size=64
+        ; disconnect the session whose write queue is full instead of dropping the new message
+        write_queue_overflow_disconnect=false
     */
     std::string listenIP = _pt.get<std::string>("rpc.listen_ip", "0.0.0.0");
     int listenPort = _pt.get<int>("rpc.listen_port", 20200);
     int threadCount = _pt.get<int>("rpc.thread_count", 8);
     int filterTimeout = _pt.get<int>("rpc.filter_timeout", 300);
     int maxProcessBlock = _pt.get<int>("rpc.filter_max_process_block", 10);
+    int filterIndexSections = _pt.get<int>("rpc.filter_index_sections", 256);
+    bool filterInvertedIndex = _pt.get<bool>("rpc.filter_inverted_index", false);
+    int batchMaxSize = _pt.get<int>("rpc.batch_max_size", 500);
+    int batchMaxConcurrency = _pt.get<int>("rpc.batch_max_concurrency", 64);
+    int batchTimeout = _pt.get<int>("rpc.batch_timeout", 0);
+    int responseCacheSize = _pt.get<int>("rpc.response_cache_size", 64);
+    int writeQueueSize = _pt.get<int>("rpc.write_queue_size", 64);
+    bool writeQueueOverflowDisconnect = _pt.get<bool>("rpc.write_queue_overflow_disconnect", false);
     bool smSsl = _pt.get<bool>("rpc.sm_ssl", false);
     bool disableSsl = _pt.get<bool>("rpc.disable_ssl", false);
     // enable ssl cover disable ssl
@@ -388,12 +414,28 @@ void NodeConfig::loadRpcConfig(boost::property_tree::ptree const& _pt)
     m_rpcSmSsl = smSsl;
     m_rpcFilterTimeout = filterTimeout;
     m_rpcMaxProcessBlock = maxProcessBlock;
+    m_rpcFilterIndexSections = std::max(filterIndexSections, 0);
+    m_rpcFilterInvertedIndex = filterInvertedIndex;
+    m_rpcBatchMaxSize = std::max(batchMaxSize, 1);
+    m_rpcBatchMaxConcurrency = std::max(batchMaxConcurrency, 1);
+    m_rpcBatchTimeout = std::max(batchTimeout, 0);
+    m_rpcResponseCacheSize = (size_t)std::max(responseCacheSize, 0) * 1024 * 1024;
+    m_rpcWriteQueueSize = (uint64_t)std::max(writeQueueSize, 0) * 1024 * 1024;
+    m_rpcWriteQueueOverflowDisconnect = writeQueueOverflowDisconnect;
     g_BCOSConfig.setNeedRetInput(needRetInput);
 
     NodeConfig_LOG(INFO) << LOG_DESC("loadRpcConfig") << LOG_KV("listenIP", listenIP)
                          << LOG_KV("listenPort", listenPort) << LOG_KV("listenPort", listenPort)
                          << LOG_KV("smSsl", smSsl) << LOG_KV("disableSsl", disableSsl)
-                         << LOG_KV("needRetInput", needRetInput);
+                         << LOG_KV("needRetInput", needRetInput)
+                         << LOG_KV("filterIndexSections", filterIndexSections)
+                         << LOG_KV("filterInvertedIndex", filterInvertedIndex)
+                         << LOG_KV("batchMaxSize", batchMaxSize)
+                         << LOG_KV("batchMaxConcurrency", batchMaxConcurrency)
+                         << LOG_KV("batchTimeout", batchTimeout)
+                         << LOG_KV("responseCacheSize", responseCacheSize)
+                         << LOG_KV("writeQueueSize", writeQueueSize)
+                         << LOG_KV("writeQueueOverflowDisconnect", writeQueueOverflowDisconnect);
 }
 
 void NodeConfig::loadWeb3RpcConfig(boost::property_tree::ptree const& _pt)
@@ -407,13 +449,28 @@ void NodeConfig::loadWeb3RpcConfig(boost::property_tree::ptree const& _pt)
         ; 300s
         filter_timeout=300
         filter_max_process_block=10
+        ; the log index of 4096-block sections kept in memory, 0 disables it
+        filter_index_sections=256
+        filter_inverted_index=false
+        ; the max requests of a batch request
+        batch_max_size=500
+        ; the max requests of a batch executed at the same time
+        batch_max_concurrency=64
+        ; the requests of a batch not started in the time budget(ms) respond with the timeout
+        ; error, 0 means no limit
+        batch_timeout=0
     */
     const std::string listenIP = _pt.get<std::string>("web3_rpc.listen_ip", "127.0.0.1");
     const int listenPort = _pt.get<int>("web3_rpc.listen_port", 8545);
     const int threadCount = _pt.get<int>("web3_rpc.thread_count", 8);
     const int filterTimeout = _pt.get<int>("web3_rpc.filter_timeout", 300);
     const int maxProcessBlock = _pt.get<int>("web3_rpc.filter_max_process_block", 10);
+    const int filterIndexSections = _pt.get<int>("web3_rpc.filter_index_sections", 256);
+    const bool filterInvertedIndex = _pt.get<bool>("web3_rpc.filter_inverted_index", false);
     const bool enableWeb3Rpc = _pt.get<bool>("web3_rpc.enable", false);
+    const int batchMaxSize = _pt.get<int>("web3_rpc.batch_max_size", 500);
+    const int batchMaxConcurrency = _pt.get<int>("web3_rpc.batch_max_concurrency", 64);
+    const int batchTimeout = _pt.get<int>("web3_rpc.batch_timeout", 0);
 
     m_web3RpcListenIP = listenIP;
     m_web3RpcListenPort = listenPort;
@@ -421,10 +478,20 @@ void NodeConfig::loadWeb3RpcConfig(boost::property_tree::ptree const& _pt)
     m_enableWeb3Rpc = enableWeb3Rpc;
     m_web3FilterTimeout = filterTimeout;
     m_web3MaxProcessBlock = maxProcessBlock;
+    m_web3FilterIndexSections = std::max(filterIndexSections, 0);
+    m_web3FilterInvertedIndex = filterInvertedIndex;
+    m_web3BatchMaxSize = std::max(batchMaxSize, 1);
+    m_web3BatchMaxConcurrency = std::max(batchMaxConcurrency, 1);
+    m_web3BatchTimeout = std::max(batchTimeout, 0);
 
     NodeConfig_LOG(INFO) << LOG_DESC("loadWeb3RpcConfig") << LOG_KV("enableWeb3Rpc", enableWeb3Rpc)
                          << LOG_KV("listenIP", listenIP) << LOG_KV("listenPort", listenPort)
-                         << LOG_KV("listenPort", listenPort);
+                         << LOG_KV("listenPort", listenPort)
+                         << LOG_KV("filterIndexSections", filterIndexSections)
+                         << LOG_KV("filterInvertedIndex", filterInvertedIndex)
+                         << LOG_KV("batchMaxSize", batchMaxSize)
+                         << LOG_KV("batchMaxConcurrency", batchMaxConcurrency)
+                         << LOG_KV("batchTimeout", batchTimeout);
 }
 
 void NodeConfig::loadGatewayConfig(boost::property_tree::ptree const& _pt)
@@ -930,12 +997,19 @@ void NodeConfig::loadOthersConfig(boost::property_tree::ptree const& _pt)
 {
     m_sendTxTimeout = _pt.get<int>("others.send_tx_timeout", -1);
     m_vmCacheSize = _pt.get<int>("executor.vm_cache_size", 1024);
+    // save the analysed code when stopped and load it when started, to cut the warm-up
+    m_vmCachePersist = _pt.get<bool>("executor.vm_cache_persist", false);
     m_enableBaselineScheduler = _pt.get<bool>("executor.baseline_scheduler", false);
     m_baselineSchedulerConfig.grainSize =
         _pt.get<int>("executor.baseline_scheduler_chunksize", 100);
     m_baselineSchedulerConfig.maxThread = _pt.get<int>("executor.baseline_scheduler_maxthread", 16);
     m_baselineSchedulerConfig.parallel =
         _pt.get<bool>("executor.baseline_scheduler_parallel", false);
+    m_baselineSchedulerConfig.callThread =
+        _pt.get<int>("executor.baseline_scheduler_call_thread", 4);
+    // the keys learned per contract to prefetch before executing a block, 0 to disable
+    m_baselineSchedulerConfig.prefetchKeys =
+        _pt.get<int>("executor.baseline_scheduler_prefetch_keys", 256);
 
     m_tarsRPCConfig.host = _pt.get<std::string>("rpc.tars_rpc_host", "127.0.0.1");
     m_tarsRPCConfig.port = _pt.get<int>("rpc.tars_rpc_port", 0);
@@ -946,6 +1020,7 @@ void NodeConfig::loadOthersConfig(boost::property_tree::ptree const& _pt)
 
     NodeConfig_LOG(INFO) << LOG_DESC("loadOthersConfig") << LOG_KV("sendTxTimeout", m_sendTxTimeout)
                          << LOG_KV("vmCacheSize", m_vmCacheSize)
+                         << LOG_KV("vmCachePersist", m_vmCachePersist)
                          << LOG_KV("checkTransactionSignature", m_checkTransactionSignature)
                          << LOG_KV("checkParallelConflict", m_checkParallelConflict);
 }
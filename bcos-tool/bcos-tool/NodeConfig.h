@@ -165,6 +165,7 @@ public:
     bool isAuthCheck() const { return m_genesisConfig.m_isAuthCheck; }
     bool isSerialExecute() const { return m_genesisConfig.m_isSerialExecute; }
     size_t vmCacheSize() const { return m_vmCacheSize; }
+    bool vmCachePersist() const { return m_vmCachePersist; }
 
     std::string const& authAdminAddress() const { return m_genesisConfig.m_authAdminAccount; }
 
@@ -186,6 +187,15 @@ public:
     uint32_t rpcThreadPoolSize() const { return m_rpcThreadPoolSize; }
     uint32_t rpcFilterTimeout() const { return m_rpcFilterTimeout; }
     uint32_t rpcMaxProcessBlock() const { return m_rpcMaxProcessBlock; }
+    uint32_t rpcFilterIndexSections() const { return m_rpcFilterIndexSections; }
+    bool rpcFilterInvertedIndex() const { return m_rpcFilterInvertedIndex; }
+    uint32_t rpcBatchMaxSize() const { return m_rpcBatchMaxSize; }
+    uint32_t rpcBatchMaxConcurrency() const { return m_rpcBatchMaxConcurrency; }
+    uint32_t rpcBatchTimeout() const { return m_rpcBatchTimeout; }
+    // bytes
+    size_t rpcResponseCacheSize() const { return m_rpcResponseCacheSize; }
+    uint64_t rpcWriteQueueSize() const { return m_rpcWriteQueueSize; }
+    bool rpcWriteQueueOverflowDisconnect() const { return m_rpcWriteQueueOverflowDisconnect; }
     bool rpcSmSsl() const { return m_rpcSmSsl; }
     bool rpcDisableSsl() const { return m_rpcDisableSsl; }
 
@@ -196,6 +206,11 @@ public:
     uint32_t web3RpcThreadSize() const { return m_web3RpcThreadSize; }
     uint32_t web3FilterTimeout() const { return m_web3FilterTimeout; }
     uint32_t web3MaxProcessBlock() const { return m_web3MaxProcessBlock; }
+    uint32_t web3FilterIndexSections() const { return m_web3FilterIndexSections; }
+    bool web3FilterInvertedIndex() const { return m_web3FilterInvertedIndex; }
+    uint32_t web3BatchMaxSize() const { return m_web3BatchMaxSize; }
+    uint32_t web3BatchMaxConcurrency() const { return m_web3BatchMaxConcurrency; }
+    uint32_t web3BatchTimeout() const { return m_web3BatchTimeout; }
 
     // the gateway configurations
     const std::string& p2pListenIP() const { return m_p2pListenIP; }
@@ -284,6 +299,8 @@ public:
         bool parallel = false;
         int grainSize = 0;
         int maxThread = 0;
+        int callThread = 0;
+        int prefetchKeys = 0;
     };
     BaselineSchedulerConfig const& baselineSchedulerConfig() const
     {
@@ -441,6 +458,7 @@ private:
 
     // executor config
     size_t m_vmCacheSize = 1024;
+    bool m_vmCachePersist = false;
     bool m_enableBaselineScheduler = false;
     BaselineSchedulerConfig m_baselineSchedulerConfig;
     TarsRPCConfig m_tarsRPCConfig;
@@ -466,6 +484,14 @@ private:
     uint32_t m_rpcThreadPoolSize{};
     uint32_t m_rpcFilterTimeout{};
     uint32_t m_rpcMaxProcessBlock{};
+    uint32_t m_rpcFilterIndexSections{};
+    bool m_rpcFilterInvertedIndex = false;
+    uint32_t m_rpcBatchMaxSize = 500;
+    uint32_t m_rpcBatchMaxConcurrency = 64;
+    uint32_t m_rpcBatchTimeout = 0;
+    size_t m_rpcResponseCacheSize = 64 * 1024 * 1024;
+    uint64_t m_rpcWriteQueueSize = 64 * 1024 * 1024;
+    bool m_rpcWriteQueueOverflowDisconnect = false;
     bool m_rpcSmSsl{};
     bool m_rpcDisableSsl = false;
 
@@ -476,6 +502,11 @@ private:
     uint32_t m_web3RpcThreadSize{};
     uint32_t m_web3FilterTimeout{};
     uint32_t m_web3MaxProcessBlock{};
+    uint32_t m_web3FilterIndexSections{};
+    bool m_web3FilterInvertedIndex = false;
+    uint32_t m_web3BatchMaxSize = 500;
+    uint32_t m_web3BatchMaxConcurrency = 64;
+    uint32_t m_web3BatchTimeout = 0;
 
     // config for gateway
     std::string m_p2pListenIP;
@@ -25,6 +25,7 @@
 #include <boost/endian/conversion.hpp>
 #include <boost/throw_exception.hpp>
 #include <algorithm>
+#include <array>
 #include <cstring>
 #include <iterator>
 #include <set>
@@ -35,12 +36,93 @@
 
 namespace bcos
 {
+namespace hex
+{
+// the two lowercase hex chars of every byte
+constexpr inline auto HEX_PAIRS = []() {
+    constexpr std::string_view hexChars = "0123456789abcdef";
+    std::array<char, 512> pairs{};
+    for (size_t i = 0; i < 256; ++i)
+    {
+        pairs[i * 2] = hexChars[i >> 4];
+        pairs[i * 2 + 1] = hexChars[i & 0x0f];
+    }
+    return pairs;
+}();
+
+// the value of the hex char, 0xff for the non-hex char
+constexpr inline auto HEX_VALUES = []() {
+    std::array<uint8_t, 256> values{};
+    for (size_t i = 0; i < 256; ++i)
+    {
+        values[i] = 0xff;
+    }
+    for (size_t i = 0; i < 10; ++i)
+    {
+        values['0' + i] = (uint8_t)i;
+    }
+    for (size_t i = 0; i < 6; ++i)
+    {
+        values['a' + i] = (uint8_t)(10 + i);
+        values['A' + i] = (uint8_t)(10 + i);
+    }
+    return values;
+}();
+
+/**
+ * @brief write the lowercase hex of the bytes, the table lookups are free of branches so the
+ * compiler vectorizes the loop
+ *
+ * @param _input the bytes to be encoded
+ * @param _size the size of the input
+ * @param _output the output with 2 * _size chars
+ */
+inline void encode(const uint8_t* _input, size_t _size, char* _output)
+{
+    for (size_t i = 0; i < _size; ++i)
+    {
+        std::memcpy(_output + i * 2, HEX_PAIRS.data() + (size_t)_input[i] * 2, 2);
+    }
+}
+
+/**
+ * @brief decode 2 * _size hex chars, the invalid chars are checked once after the loop
+ *
+ * @param _input the hex chars without prefix
+ * @param _size the size of the output
+ * @param _output the output with _size bytes
+ * @return false if the input has non-hex char
+ */
+inline bool decode(const char* _input, size_t _size, uint8_t* _output)
+{
+    uint8_t invalid = 0;
+    for (size_t i = 0; i < _size; ++i)
+    {
+        auto high = HEX_VALUES[(uint8_t)_input[i * 2]];
+        auto low = HEX_VALUES[(uint8_t)_input[i * 2 + 1]];
+        invalid |= (high | low);
+        _output[i] = (uint8_t)((high << 4) | (low & 0x0f));
+    }
+    // the valid values are less than 0x10
+    return (invalid & 0xf0) == 0;
+}
+}  // namespace hex
+
 template <class Binary, class Out = std::string>
     requires RANGES::range<Binary> && RANGES::sized_range<Binary>
 Out toHex(const Binary& binary, std::string_view prefix = std::string_view())
 {
     Out out;
 
+    if constexpr (RANGES::contiguous_range<Binary> &&
+                  sizeof(RANGES::range_value_t<Binary>) == 1)
+    {
+        out.resize(binary.size() * 2 + prefix.size());
+        std::copy(prefix.begin(), prefix.end(), out.begin());
+        hex::encode((const uint8_t*)RANGES::data(binary), binary.size(),
+            (char*)out.data() + prefix.size());
+        return out;
+    }
     out.reserve(binary.size() * 2 + prefix.size());
 
     if (!prefix.empty())
@@ -115,6 +197,16 @@ Out fromHex(const Hex& hex, std::string_view prefix = std::string_view())
     }
 
     Out out;
+    if constexpr (RANGES::contiguous_range<Hex>)
+    {
+        out.resize((hex.size() - prefix.size()) / 2);
+        if (!hex::decode((const char*)RANGES::data(hex) + prefix.size(), out.size(),
+                (uint8_t*)out.data()))
+        {
+            BOOST_THROW_EXCEPTION(BCOS_ERROR(-1, "Invalid input hex string"));
+        }
+        return out;
+    }
     out.reserve(hex.size() / 2);
 
     boost::algorithm::unhex(hex.begin() + prefix.size(), hex.end(), std::back_inserter(out));
@@ -211,6 +303,10 @@ std::shared_ptr<std::string> toHexString(T const& _data)
 template <class T>
 std::string toHexStringWithPrefix(T const& _data)
 {
+    if constexpr (RANGES::range<T> && RANGES::sized_range<T>)
+    {
+        return toHex(_data, "0x");
+    }
     std::string out;
     out.reserve(_data.size() * 2 + 2);
     out = "0x";
@@ -21,9 +21,59 @@
  */
 #include "ZstdCompress.h"
 #include "BoostLog.h"
+#include "zdict.h"
 
 namespace bcos
 {
+namespace
+{
+// the contexts are reused by the thread to avoid allocating the zstd workspace for every message
+ZSTD_CCtx* threadCompressContext()
+{
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> context(
+        ZSTD_createCCtx(), &ZSTD_freeCCtx);
+    return context.get();
+}
+
+ZSTD_DCtx* threadDecompressContext()
+{
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> context(
+        ZSTD_createDCtx(), &ZSTD_freeDCtx);
+    return context.get();
+}
+}  // namespace
+
+ZstdDictionary::ZstdDictionary(bytes _content)
+  : m_content(std::move(_content)),
+    m_id(ZSTD_getDictID_fromDict(m_content.data(), m_content.size())),
+    m_decompressDict(ZSTD_createDDict(m_content.data(), m_content.size()))
+{}
+
+ZstdDictionary::~ZstdDictionary()
+{
+    ZSTD_freeDDict(m_decompressDict);
+    for (auto& it : m_compressDicts)
+    {
+        ZSTD_freeCDict(it.second);
+    }
+}
+
+const ZSTD_CDict* ZstdDictionary::compressDict(int _compressionLevel)
+{
+    Guard lock(x_compressDicts);
+    auto it = m_compressDicts.find(_compressionLevel);
+    if (it != m_compressDicts.end())
+    {
+        return it->second;
+    }
+    auto* compressDict = ZSTD_createCDict(m_content.data(), m_content.size(), _compressionLevel);
+    if (compressDict)
+    {
+        m_compressDicts.emplace(_compressionLevel, compressDict);
+    }
+    return compressDict;
+}
+
 bool ZstdCompress::compress(bytesConstRef inputData, bytes& compressedData, int compressionLevel)
 {
     // auto start_t = utcTimeUs();
@@ -53,6 +103,102 @@ bool ZstdCompress::compress(bytesConstRef inputData, bytes& compressedData, int
     return true;
 }
 
+bool ZstdCompress::compress(bytesConstRef inputData, bytes& compressedData, int compressionLevel,
+    ZstdDictionary& dictionary)
+{
+    const auto* compressDict = dictionary.compressDict(compressionLevel);
+    auto* context = threadCompressContext();
+    if (!compressDict || !context)
+    {
+        BCOS_LOG(ERROR) << LOG_BADGE("ZstdCompress")
+                        << LOG_DESC("compress with dictionary failed, invalid dictionary")
+                        << LOG_KV("dictID", dictionary.id());
+        return false;
+    }
+    size_t const cBuffSize = ZSTD_compressBound(inputData.size());
+    compressedData.resize(cBuffSize);
+    size_t const compressedSize = ZSTD_compress_usingCDict(context, compressedData.data(),
+        cBuffSize, inputData.data(), inputData.size(), compressDict);
+    if (ZSTD_isError(compressedSize))
+    {
+        BCOS_LOG(ERROR) << LOG_BADGE("ZstdCompress") << LOG_DESC("compress with dictionary failed")
+                        << LOG_KV("dictID", dictionary.id())
+                        << LOG_KV("msg", ZSTD_getErrorName(compressedSize));
+        return false;
+    }
+    compressedData.resize(compressedSize);
+    return true;
+}
+
+uint32_t ZstdCompress::dictionaryID(bytesConstRef compressedData)
+{
+    return ZSTD_getDictID_fromFrame(compressedData.data(), compressedData.size());
+}
+
+bool ZstdCompress::uncompress(bytesConstRef compressedData, bytes& uncompressedData,
+    DictionaryFinder const& dictionaryFinder)
+{
+    auto dictID = dictionaryID(compressedData);
+    if (dictID == 0)
+    {
+        return uncompress(compressedData, uncompressedData);
+    }
+    auto dictionary = dictionaryFinder ? dictionaryFinder(dictID) : nullptr;
+    auto* context = threadDecompressContext();
+    if (!dictionary || !dictionary->decompressDict() || !context)
+    {
+        BCOS_LOG(ERROR) << LOG_BADGE("ZstdUncompress")
+                        << LOG_DESC("uncompress failed, dictionary not found")
+                        << LOG_KV("dictID", dictID);
+        return false;
+    }
+    size_t const cBuffSize = ZSTD_getFrameContentSize(compressedData.data(), compressedData.size());
+    if (0 == cBuffSize || ZSTD_CONTENTSIZE_UNKNOWN == cBuffSize ||
+        ZSTD_CONTENTSIZE_ERROR == cBuffSize)
+    {
+        BCOS_LOG(ERROR) << LOG_BADGE("ZstdUncompress")
+                        << LOG_DESC("uncompress failed, compressedData size error")
+                        << LOG_KV("compressedData size", cBuffSize) << LOG_KV("dictID", dictID);
+        return false;
+    }
+    uncompressedData.resize(cBuffSize);
+    size_t const uncompressSize = ZSTD_decompress_usingDDict(context, uncompressedData.data(),
+        cBuffSize, compressedData.data(), compressedData.size(), dictionary->decompressDict());
+    if (ZSTD_isError(uncompressSize))
+    {
+        BCOS_LOG(ERROR) << LOG_BADGE("ZstdUncompress")
+                        << LOG_DESC("uncompress with dictionary failed") << LOG_KV("dictID", dictID)
+                        << LOG_KV("msg", ZSTD_getErrorName(uncompressSize));
+        return false;
+    }
+    uncompressedData.resize(uncompressSize);
+    return true;
+}
+
+bytes ZstdCompress::trainDictionary(const std::vector<bytes>& samples, size_t dictCapacity)
+{
+    bytes samplesBuffer;
+    std::vector<size_t> samplesSizes;
+    samplesSizes.reserve(samples.size());
+    for (const auto& sample : samples)
+    {
+        samplesBuffer.insert(samplesBuffer.end(), sample.begin(), sample.end());
+        samplesSizes.push_back(sample.size());
+    }
+    bytes dictionary(dictCapacity);
+    auto dictSize = ZDICT_trainFromBuffer(dictionary.data(), dictionary.size(),
+        samplesBuffer.data(), samplesSizes.data(), (unsigned)samplesSizes.size());
+    if (ZDICT_isError(dictSize))
+    {
+        BCOS_LOG(WARNING) << LOG_BADGE("ZstdCompress") << LOG_DESC("trainDictionary failed")
+                          << LOG_KV("samples", samples.size())
+                          << LOG_KV("msg", ZDICT_getErrorName(dictSize));
+        return {};
+    }
+    dictionary.resize(dictSize);
+    return dictionary;
+}
+
 bool ZstdCompress::uncompress(bytesConstRef compressedData, bytes& uncompressedData)
 {
     // auto start_t = utcTimeUs();
@@ -22,15 +22,60 @@
 #pragma once
 #include "Common.h"
 #include "zstd.h"
+#include <functional>
+#include <map>
 
 namespace bcos
 {
+/// the trained zstd dictionary, the digested dictionaries are created once and shared by all the
+/// threads
+class ZstdDictionary
+{
+public:
+    using Ptr = std::shared_ptr<ZstdDictionary>;
+    explicit ZstdDictionary(bytes _content);
+    ZstdDictionary(const ZstdDictionary&) = delete;
+    ZstdDictionary(ZstdDictionary&&) = delete;
+    ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+    ZstdDictionary& operator=(ZstdDictionary&&) = delete;
+    ~ZstdDictionary();
+
+    // the dictionary id written into the frame header of the compressed data, 0 means invalid
+    uint32_t id() const { return m_id; }
+    bytesConstRef content() const { return ref(m_content); }
+
+    // the digested dictionary for compression with the given level, created lazily
+    const ZSTD_CDict* compressDict(int _compressionLevel);
+    const ZSTD_DDict* decompressDict() const { return m_decompressDict; }
+
+private:
+    bytes m_content;
+    uint32_t m_id = 0;
+    ZSTD_DDict* m_decompressDict = nullptr;
+
+    mutable bcos::Mutex x_compressDicts;
+    std::map<int, ZSTD_CDict*> m_compressDicts;
+};
 
 class ZstdCompress
 {
 public:
+    using DictionaryFinder = std::function<ZstdDictionary::Ptr(uint32_t _dictID)>;
+
     static bool compress(bytesConstRef inputData, bytes& compressedData, int compressionLevel);
+    static bool compress(bytesConstRef inputData, bytes& compressedData, int compressionLevel,
+        ZstdDictionary& dictionary);
     static bool uncompress(bytesConstRef compressedData, bytes& uncompressedData);
+    // uncompress the data compressed with or without dictionary, the dictionary is found by the
+    // dictionary id recorded in the frame header
+    static bool uncompress(bytesConstRef compressedData, bytes& uncompressedData,
+        DictionaryFinder const& dictionaryFinder);
+
+    // the dictionary id of the compressed frame, 0 means compressed without dictionary
+    static uint32_t dictionaryID(bytesConstRef compressedData);
+
+    // train the dictionary from the samples, return empty bytes when train failed
+    static bytes trainDictionary(const std::vector<bytes>& samples, size_t dictCapacity);
 };
 
 }  // namespace bcos
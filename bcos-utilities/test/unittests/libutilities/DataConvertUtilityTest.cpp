@@ -62,6 +62,26 @@ BOOST_AUTO_TEST_CASE(testHex)
     BOOST_CHECK(isHexString("000123123") == true);
 }
 
+BOOST_AUTO_TEST_CASE(testFastHex)
+{
+    bytes data(256);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = (byte)i;
+    }
+    auto hex = toHex(data);
+    BOOST_CHECK_EQUAL(hex, *toHexString(data));
+    BOOST_CHECK_EQUAL(toHexStringWithPrefix(data), "0x" + hex);
+    BOOST_CHECK(fromHex(hex) == data);
+    BOOST_CHECK(fromHexWithPrefix("0x" + hex) == data);
+    BOOST_CHECK(fromHex(std::string("0xABCDEF"), "0x") == bytes({0xab, 0xcd, 0xef}));
+    BOOST_CHECK((fromHex<std::string_view, std::string>("6162") == "ab"));
+
+    BOOST_CHECK_THROW(fromHex(std::string("0g")), bcos::Error);
+    BOOST_CHECK_THROW(fromHex(std::string("0x0:")), bcos::Error);
+    BOOST_CHECK(!safeFromHexWithPrefix(std::string("0x1x")));
+}
+
 /// test asString && asBytes
 BOOST_AUTO_TEST_CASE(testStringTrans)
 {
@@ -48,6 +48,49 @@ BOOST_AUTO_TEST_CASE(testZstdCompress)
     BOOST_CHECK(!retUncompressFail);
 }
 
+BOOST_AUTO_TEST_CASE(testZstdCompressWithDictionary)
+{
+    // the structurally similar payloads
+    std::vector<bytes> samples;
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        std::string sample = "{\"type\":\"transfer\",\"from\":\"0x" + std::to_string(i * 7919) +
+                             "\",\"to\":\"0x" + std::to_string(i * 104729) +
+                             "\",\"amount\":" + std::to_string(i % 97) + ",\"nonce\":" +
+                             std::to_string(i * 31) + "}";
+        samples.emplace_back(sample.begin(), sample.end());
+    }
+    auto content = ZstdCompress::trainDictionary(samples, 4096);
+    BOOST_CHECK(!content.empty());
+    auto dictionary = std::make_shared<ZstdDictionary>(content);
+    BOOST_CHECK(dictionary->id() != 0);
+
+    auto const& payload = samples.at(512);
+    bytes compressData;
+    BOOST_CHECK(ZstdCompress::compress(ref(payload), compressData, 3, *dictionary));
+    BOOST_CHECK_EQUAL(ZstdCompress::dictionaryID(ref(compressData)), dictionary->id());
+
+    // uncompress without the dictionary failed
+    bytes uncompressData;
+    BOOST_CHECK(!ZstdCompress::uncompress(ref(compressData), uncompressData));
+    BOOST_CHECK(!ZstdCompress::uncompress(ref(compressData), uncompressData,
+        [](uint32_t) -> ZstdDictionary::Ptr { return nullptr; }));
+
+    BOOST_CHECK(ZstdCompress::uncompress(ref(compressData), uncompressData,
+        [&dictionary](uint32_t _dictID) -> ZstdDictionary::Ptr {
+            return _dictID == dictionary->id() ? dictionary : nullptr;
+        }));
+    BOOST_CHECK(uncompressData == payload);
+
+    // the data compressed without dictionary can also be uncompressed
+    bytes plainCompressData;
+    BOOST_CHECK(ZstdCompress::compress(ref(payload), plainCompressData, 3));
+    BOOST_CHECK_EQUAL(ZstdCompress::dictionaryID(ref(plainCompressData)), 0);
+    BOOST_CHECK(ZstdCompress::uncompress(ref(plainCompressData), uncompressData,
+        [](uint32_t) -> ZstdDictionary::Ptr { return nullptr; }));
+    BOOST_CHECK(uncompressData == payload);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 }  // namespace test
 }  // namespace bcos
@@ -77,6 +77,7 @@ macro(configure_project)
     default_option(WITH_BENCHMARK ON)
     default_option(WITH_WASM ON)
     default_option(WITH_VTUNE_ITT OFF)
+    default_option(WITH_IO_URING OFF)
     default_option(ONLY_CPP_SDK OFF)
 
     if((NOT FULLNODE) AND (NOT WITH_LIGHTNODE) AND WITH_CPPSDK)
@@ -108,6 +109,15 @@ macro(configure_project)
     if(WITH_SM2_OPTIMIZE)
         add_compile_definitions(WITH_SM2_OPTIMIZE)
     endif()
+    # the boost.asio sockets use io_uring instead of epoll, requires linux 5.10+ and liburing
+    if(WITH_IO_URING)
+        if(NOT CMAKE_SYSTEM_NAME STREQUAL "Linux")
+            message(FATAL_ERROR "WITH_IO_URING is only supported on linux")
+        endif()
+        find_library(URING_LIBRARY NAMES uring REQUIRED)
+        add_compile_definitions(BOOST_ASIO_HAS_IO_URING BOOST_ASIO_DISABLE_EPOLL)
+        link_libraries(${URING_LIBRARY})
+    endif()
 
     if(NOT ALLOCATOR)
         set(ALLOCATOR "defalut")
@@ -166,6 +176,7 @@ macro(print_config NAME)
     message("-- WITH_SWIG_SDK      Enable swig sdk              ${WITH_SWIG_SDK}")
     message("-- WITH_WASM          Enable wasm                  ${WITH_WASM}")
     message("-- WITH_VTUNE_ITT     Enable vtune itt api support ${WITH_VTUNE_ITT}")
+    message("-- WITH_IO_URING      Enable asio io_uring backend ${WITH_IO_URING}")
     message("-- ONLY_CPP_SDK       Only build cpp sdk           ${ONLY_CPP_SDK}")
     message("------------------------------------------------------------------------")
     message("")
@@ -98,13 +98,19 @@ bcos::transaction_scheduler::BaselineSchedulerInitializer::build(::rocksdb::DB&
                 decltype(data->m_transactionExecutor), decltype(*scheduler),
                 ledger::LedgerInterface>>(data->m_multiLayerStorage, *scheduler,
                 data->m_transactionExecutor, *blockFactory->blockHeaderFactory(), *ledger, *txpool,
-                *transactionSubmitResultFactory, *blockFactory->cryptoSuite()->hashImpl());
+                *transactionSubmitResultFactory, *blockFactory->cryptoSuite()->hashImpl(),
+                config.callThread);
         baselineScheduler->registerTransactionNotifier(
             [txpool](bcos::protocol::BlockNumber blockNumber,
                 bcos::protocol::TransactionSubmitResultsPtr result,
                 std::function<void(bcos::Error::Ptr)> callback) mutable {
                 txpool->asyncNotifyBlockResult(blockNumber, std::move(result), std::move(callback));
             });
+        if (config.prefetchKeys > 0)
+        {
+            baselineScheduler->setAccessSetCache(
+                std::make_shared<AccessSetCache>(config.prefetchKeys));
+        }
 
         return std::make_tuple(
             [scheduler = std::move(scheduler), baselineScheduler, data = std::move(data),
@@ -120,7 +126,9 @@ bcos::transaction_scheduler::BaselineSchedulerInitializer::build(::rocksdb::DB&
 
     INITIALIZER_LOG(INFO) << "Initialize baseline scheduler, parallel: " << config.parallel
                           << ", grainSize: " << config.grainSize
-                          << ", maxThread: " << config.maxThread;
+                          << ", maxThread: " << config.maxThread
+                          << ", callThread: " << config.callThread
+                          << ", prefetchKeys: " << config.prefetchKeys;
 
     if (config.parallel)
     {
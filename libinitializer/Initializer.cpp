@@ -31,6 +31,7 @@
 #include "SchedulerInitializer.h"
 #include "StorageInitializer.h"
 #include "bcos-executor/src/executor/SwitchExecutorManager.h"
+#include "bcos-executor/src/vm/CodeAnalysisCache.h"
 #include "bcos-framework/storage/StorageInterface.h"
 #include "bcos-scheduler/src/TarsExecutorManager.h"
 #include "bcos-storage/RocksDBStorage.h"
@@ -334,6 +335,15 @@ void Initializer::init(bcos::protocol::NodeArchitectureType _nodeArchType,
         INITIALIZER_LOG(INFO) << LOG_DESC("create Executor")
                               << LOG_KV("nodeArchType", _nodeArchType);
 
+        // The code analyses are shared by the executors of the process
+        auto& codeAnalysisCache = executor::CodeAnalysisCache::global();
+        codeAnalysisCache.reserve(m_nodeConfig->vmCacheSize());
+        if (m_nodeConfig->vmCachePersist())
+        {
+            codeAnalysisCache.load(codeAnalysisCachePath(),
+                *m_protocolInitializer->cryptoSuite()->hashImpl());
+        }
+
         // Note: ensure that there has at least one executor before pbft/sync execute block
         if (!useBaselineScheduler)
         {
@@ -623,6 +633,10 @@ void Initializer::stop()
         {
             m_archiveService->stop();
         }
+        if (m_nodeConfig && m_nodeConfig->vmCachePersist())
+        {
+            executor::CodeAnalysisCache::global().save(codeAnalysisCachePath());
+        }
     }
     catch (std::exception const& e)
     {
@@ -101,6 +101,10 @@ public:
     std::string getStateDBPath(bool _airVersion) const;
     std::string getBlockDBPath(bool _airVersion) const;
     std::string getConsensusStorageDBPath(bool _airVersion) const;
+    std::string codeAnalysisCachePath() const
+    {
+        return m_nodeConfig->storagePath() + c_fileSeparator + c_codeAnalysisCacheFileName;
+    }
 
 private:
     bcos::tool::NodeConfig::Ptr m_nodeConfig;
@@ -118,6 +122,7 @@ private:
     std::weak_ptr<bcos::executor::SwitchExecutorManager> m_switchExecutorManager;
     std::string const c_consensusStorageDBName = "consensus_log";
     std::string const c_fileSeparator = "/";
+    std::string const c_codeAnalysisCacheFileName = "code_analysis.cache";
     std::shared_ptr<bcos::archive::ArchiveService> m_archiveService = nullptr;
     bcos::storage::TransactionalStorageInterface::Ptr m_storage = nullptr;
     // if enable SeparateBlockAndState,txs and receipts will be stored in m_blockStorage
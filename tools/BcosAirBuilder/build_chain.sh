@@ -1359,6 +1359,12 @@ generate_config_ini() {
     ; enable_rip_protocol=false
     ; enable compression for p2p message, default: true
     ; enable_compression=false
+    ; zstd compression level, default: 1
+    ; compression_level=1
+    ; skip the incompressible modules and lower the level when compression costs too much, default: false
+    ; enable_adaptive_compression=true
+    ; the directory of the trained compression dictionaries named ${moduleID}.dict
+    ; compression_dict_path=
 
 [certificate_blacklist]
     ; crl.0 should be nodeid, nodeid's length is 512
@@ -1578,6 +1584,12 @@ generate_sm_config_ini() {
     ; enable_rip_protocol=false
     ; enable compression for p2p message, default: true
     ; enable_compression=false
+    ; zstd compression level, default: 1
+    ; compression_level=1
+    ; skip the incompressible modules and lower the level when compression costs too much, default: false
+    ; enable_adaptive_compression=true
+    ; the directory of the trained compression dictionaries named ${moduleID}.dict
+    ; compression_dict_path=
 
 [certificate_blacklist]
     ; crl.0 should be nodeid, nodeid's length is 128
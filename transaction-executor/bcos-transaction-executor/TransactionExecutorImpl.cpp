@@ -1,11 +1,15 @@
 #include "TransactionExecutorImpl.h"
+#include "bcos-executor/src/dag/TxDAGInterface.h"
+#include <boost/container_hash/hash.hpp>
 
 bcos::transaction_executor::TransactionExecutorImpl::TransactionExecutorImpl(
     protocol::TransactionReceiptFactory const& receiptFactory, crypto::Hash::Ptr hashImpl,
     PrecompiledManager& precompiledManager)
   : m_receiptFactory(receiptFactory),
     m_hashImpl(std::move(hashImpl)),
-    m_precompiledManager(precompiledManager)
+    m_precompiledManager(precompiledManager),
+    m_abiCache(std::make_shared<executor::ClockCache<bytes, executor::FunctionAbi>>(
+        DEFAULT_ABI_CACHE_SIZE))
 {}
 
 evmc_message bcos::transaction_executor::newEVMCMessage(
@@ -33,3 +37,143 @@ evmc_message bcos::transaction_executor::newEVMCMessage(
 
     return message;
 }
+
+std::optional<std::vector<bcos::bytes>> bcos::transaction_executor::precompiledConflictKeys(
+    Precompiled const& precompiled, protocol::Transaction const& transaction)
+{
+    return std::visit(
+        bcos::overloaded{
+            [](executor::PrecompiledContract const& /*unused*/)
+                -> std::optional<std::vector<bytes>> {
+                // 以太坊预编译合约不访问状态
+                // The ethereum precompiled doesn't access the state
+                return std::vector<bytes>{};
+            },
+            [&](std::shared_ptr<precompiled::Precompiled> const& precompiled)
+                -> std::optional<std::vector<bytes>> {
+                if (!precompiled->isParallelPrecompiled())
+                {
+                    return std::nullopt;
+                }
+                std::vector<std::string> tags;
+                try
+                {
+                    tags = precompiled->getParallelTag(transaction.input(), false);
+                }
+                catch (std::exception& e)
+                {
+                    // 参数无法解析，交给执行时报错
+                    // The invalid input is reported by the execution
+                    TRANSACTION_EXECUTOR_LOG(DEBUG) << "Get parallel tag failed: "
+                                                    << boost::diagnostic_information(e);
+                    return std::nullopt;
+                }
+                auto const& to = transaction.to();
+                std::vector<bytes> keys;
+                keys.reserve(tags.size());
+                for (auto const& tag : tags)
+                {
+                    auto& key = keys.emplace_back(tag.begin(), tag.end());
+                    key.insert(key.end(), to.begin(), to.end());
+                }
+                return keys;
+            }},
+        precompiled.m_precompiled);
+}
+
+std::optional<std::vector<bcos::bytes>> bcos::transaction_executor::abiConflictKeys(
+    executor::FunctionAbi const& functionAbi, protocol::Transaction const& transaction,
+    protocol::BlockHeader const& blockHeader)
+{
+    if (functionAbi.conflictFields.empty())
+    {
+        return std::nullopt;
+    }
+
+    auto const& to = transaction.to();
+    auto toHash = boost::hash<std::string_view>()(to);
+    auto params = transaction.input().getCroppedData(4);
+
+    std::vector<bytes> keys;
+    keys.reserve(functionAbi.conflictFields.size());
+    for (auto const& conflictField : functionAbi.conflictFields)
+    {
+        auto slot = toHash + (conflictField.slot ? *conflictField.slot : 0);
+        bytes key(
+            reinterpret_cast<uint8_t const*>(&slot), reinterpret_cast<uint8_t const*>(&slot + 1));
+        switch (conflictField.kind)
+        {
+        case executor::All:
+            return std::nullopt;
+        case executor::Len:
+        case executor::None:
+            break;
+        case executor::Env:
+        {
+            if (conflictField.value.size() != 1)
+            {
+                return std::nullopt;
+            }
+            switch (conflictField.value[0])
+            {
+            case executor::Caller:
+            case executor::Origin:
+            {
+                // 交易的调用者即是发起者
+                // The caller of the transaction is the origin
+                auto sender = transaction.sender();
+                key.insert(key.end(), sender.begin(), sender.end());
+                break;
+            }
+            case executor::Now:
+            {
+                auto now = blockHeader.timestamp();
+                key.insert(key.end(), reinterpret_cast<uint8_t const*>(&now),
+                    reinterpret_cast<uint8_t const*>(&now + 1));
+                break;
+            }
+            case executor::BlkNumber:
+            {
+                auto blockNumber = blockHeader.number();
+                key.insert(key.end(), reinterpret_cast<uint8_t const*>(&blockNumber),
+                    reinterpret_cast<uint8_t const*>(&blockNumber + 1));
+                break;
+            }
+            case executor::Addr:
+                key.insert(key.end(), to.begin(), to.end());
+                break;
+            default:
+                return std::nullopt;
+            }
+            break;
+        }
+        case executor::Params:
+        {
+            if (conflictField.value.empty() ||
+                conflictField.value[0] >= functionAbi.flatInputs.size())
+            {
+                return std::nullopt;
+            }
+            auto index = conflictField.value[0];
+            auto const& typeName = functionAbi.flatInputs[index];
+            if (typeName.empty())
+            {
+                return std::nullopt;
+            }
+            auto value = getComponentBytes(index, typeName, params);
+            key.insert(key.end(), value.begin(), value.end());
+            break;
+        }
+        case executor::Const:
+            key.insert(key.end(), conflictField.value.begin(), conflictField.value.end());
+            break;
+        default:
+            return std::nullopt;
+        }
+        if (conflictField.kind != executor::None)
+        {
+            keys.emplace_back(std::move(key));
+        }
+    }
+    return keys;
+}
@@ -1,7 +1,10 @@
 #pragma once
 
 #include "RollbackableStorage.h"
+#include "bcos-executor/src/dag/Abi.h"
+#include "bcos-executor/src/dag/ClockCache.h"
 #include "bcos-framework/ledger/Account.h"
+#include "bcos-framework/ledger/EVMAccount.h"
 #include "bcos-framework/ledger/Features.h"
 #include "bcos-framework/protocol/BlockHeader.h"
 #include "bcos-framework/protocol/TransactionReceipt.h"
@@ -15,7 +18,9 @@
 #include <boost/exception/diagnostic_information.hpp>
 #include <functional>
 #include <iterator>
+#include <optional>
 #include <type_traits>
+#include <vector>
 
 namespace bcos::transaction_executor
 {
@@ -23,6 +28,15 @@ namespace bcos::transaction_executor
 
 evmc_message newEVMCMessage(protocol::Transaction const& transaction, int64_t gasLimit);
 
+// 并行预编译合约声明的冲突键，std::nullopt表示不能并行
+// The conflict keys declared by the parallel precompiled, std::nullopt if it can't be parallel
+std::optional<std::vector<bytes>> precompiledConflictKeys(
+    Precompiled const& precompiled, protocol::Transaction const& transaction);
+// 合约函数abi中声明的冲突字段对应的冲突键
+// The conflict keys of the conflict fields declared in the abi of the contract function
+std::optional<std::vector<bytes>> abiConflictKeys(executor::FunctionAbi const& functionAbi,
+    protocol::Transaction const& transaction, protocol::BlockHeader const& blockHeader);
+
 class TransactionExecutorImpl
 {
 public:
@@ -32,6 +46,10 @@ public:
     std::reference_wrapper<protocol::TransactionReceiptFactory const> m_receiptFactory;
     crypto::Hash::Ptr m_hashImpl;
     std::reference_wrapper<PrecompiledManager> m_precompiledManager;
+    constexpr static size_t DEFAULT_ABI_CACHE_SIZE = 32;
+    // 按合约地址和函数选择器缓存解析后的函数abi
+    // The parsed function abi, cached by the contract address and the function selector
+    std::shared_ptr<executor::ClockCache<bytes, executor::FunctionAbi>> m_abiCache;
 
     template <class Storage>
     struct ExecuteContext
@@ -92,6 +110,76 @@ public:
             executor, storage, blockHeader, transaction, contextID, ledgerConfig);
     }
 
+    friend task::Task<std::optional<std::vector<bytes>>> tag_invoke(
+        tag_t<conflictKeys> /*unused*/, TransactionExecutorImpl& executor, auto& storage,
+        protocol::BlockHeader const& blockHeader, protocol::Transaction const& transaction,
+        ledger::LedgerConfig const& ledgerConfig)
+    {
+        // 部署合约会创建新的合约表，转账会修改接收者的余额，不能并行
+        // The deployment creates the table of the new contract, the transfer changes the balance
+        // of the receiver, can't be parallel
+        auto input = transaction.input();
+        if (transaction.to().empty() || input.size() < 4 ||
+            (!transaction.value().empty() && u256(transaction.value()) != 0))
+        {
+            co_return std::nullopt;
+        }
+
+        std::optional<std::vector<bytes>> keys;
+        auto address = unhexAddress(transaction.to());
+        if (auto const* precompiled = executor.m_precompiledManager.get().getPrecompiled(address))
+        {
+            if (auto flag = featureFlag(*precompiled);
+                flag && !ledgerConfig.features().get(*flag))
+            {
+                co_return std::nullopt;
+            }
+            keys = precompiledConflictKeys(*precompiled, transaction);
+        }
+        else
+        {
+            bytes abiKey(transaction.to().begin(), transaction.to().end());
+            abiKey.insert(abiKey.end(), input.begin(), input.begin() + 4);
+            if (auto cacheHandle = executor.m_abiCache->lookup(abiKey); cacheHandle.isValid())
+            {
+                keys = abiConflictKeys(cacheHandle.value(), transaction, blockHeader);
+            }
+            else
+            {
+                ledger::account::EVMAccount account(storage, address,
+                    ledgerConfig.features().get(ledger::Features::Flag::feature_raw_address));
+                auto abiEntry = co_await ledger::account::abi(account);
+                if (!abiEntry || abiEntry->size() == 0)
+                {
+                    co_return std::nullopt;
+                }
+                auto functionAbi = executor::FunctionAbi::deserialize(abiEntry->get(),
+                    bytes(input.begin(), input.begin() + 4),
+                    executor.m_hashImpl->getHashImplType() == crypto::HashImplType::Sm3Hash);
+                if (!functionAbi)
+                {
+                    co_return std::nullopt;
+                }
+                keys = abiConflictKeys(*functionAbi, transaction, blockHeader);
+                // 插入成功后由缓存管理abi的生命周期
+                // The cache takes the ownership of the abi if inserted
+                if (executor.m_abiCache->insert(abiKey, functionAbi.get()))
+                {
+                    std::ignore = functionAbi.release();
+                }
+            }
+        }
+
+        // 开启余额策略后，交易会扣除发送者的余额
+        // The balance of the sender is deducted by the transaction with the balance policy
+        if (keys && ledgerConfig.features().get(ledger::Features::Flag::feature_balance_policy1))
+        {
+            auto sender = transaction.sender();
+            keys->emplace_back(sender.begin(), sender.end());
+        }
+        co_return keys;
+    }
+
     template <int step>
     friend task::Task<protocol::TransactionReceipt::Ptr> tag_invoke(
         tag_t<executeStep> /*unused*/, auto& context)
@@ -149,10 +149,14 @@ struct EVMHostInterface
         return EVMC_ACCESS_COLD;
     }
 
-    static evmc_access_status accessStorage([[maybe_unused]] evmc_host_context* context,
-        [[maybe_unused]] const evmc_address* addr,
-        [[maybe_unused]] const evmc_bytes32* key) noexcept
+    static evmc_access_status accessStorage(evmc_host_context* context,
+        [[maybe_unused]] const evmc_address* addr, const evmc_bytes32* key) noexcept
     {
+        // 记录访问过的slot，gas仍按cold收取，保持已有链的回执不变
+        // Track the accessed slots, the gas is still charged as cold to keep the receipts of the
+        // existing chains
+        auto& hostContext = static_cast<HostContextType&>(*context);
+        hostContext.accessStorage(key);
         return EVMC_ACCESS_COLD;
     }
 
@@ -80,6 +80,13 @@ bcos::transaction_executor::hostcontext::Executable::Executable(
         bytesConstRef(reinterpret_cast<const uint8_t*>(m_code->data()), m_code->size()), revision))
 {}
 
+bcos::transaction_executor::hostcontext::Executable::Executable(
+    storage::Entry code, const crypto::HashType& codeHash, evmc_revision revision)
+  : m_code(std::make_optional(std::move(code))),
+    m_vmInstance(VMFactory::create(VMKind::evmone, codeHash,
+        bytesConstRef(reinterpret_cast<const uint8_t*>(m_code->data()), m_code->size()), revision))
+{}
+
 bcos::transaction_executor::hostcontext::Executable::Executable(
     bytesConstRef code, evmc_revision revision)
   : m_vmInstance(VMFactory::create(VMKind::evmone, code, revision))
@@ -25,6 +25,7 @@
 #include "../precompiled/PrecompiledImpl.h"
 #include "../precompiled/PrecompiledManager.h"
 #include "EVMHostInterface.h"
+#include "SlotCache.h"
 #include "VMInstance.h"
 #include "bcos-codec/abi/ContractABICodec.h"
 #include "bcos-executor/src/Common.h"
@@ -80,6 +81,7 @@ std::variant<const evmc_message*, evmc_message> getMessage(const evmc_message& i
 struct Executable
 {
     Executable(storage::Entry code, evmc_revision revision);
+    Executable(storage::Entry code, const crypto::HashType& codeHash, evmc_revision revision);
     explicit Executable(bytesConstRef code, evmc_revision revision);
 
     std::optional<storage::Entry> m_code;
@@ -107,7 +109,13 @@ inline task::Task<std::shared_ptr<Executable>> getExecutable(
     Account<std::decay_t<decltype(storage)>> account(storage, address, binaryAddress);
     if (auto codeEntry = co_await ledger::account::code(account))
     {
-        auto executable = std::make_shared<Executable>(std::move(*codeEntry), revision);
+        // 相同的代码部署在多个地址时，按code hash共享代码分析
+        // The same code deployed at many addresses shares the analysis by the code hash
+        auto codeHash = co_await ledger::account::codeHash(account);
+        auto executable = codeHash == crypto::HashType{} ?
+                              std::make_shared<Executable>(std::move(*codeEntry), revision) :
+                              std::make_shared<Executable>(
+                                  std::move(*codeEntry), codeHash, revision);
         co_await storage2::writeOne(getCacheExecutables(), address, executable);
         co_return executable;
     }
@@ -150,6 +158,8 @@ private:
     std::reference_wrapper<const crypto::Hash> m_hashImpl;
     std::variant<const evmc_message*, evmc_message> m_message;
     Account<Storage> m_recipientAccount;
+    // Shared by all the calls of the transaction
+    std::shared_ptr<SlotCache> m_slotCache;
 
     evmc_revision m_revision;
     std::vector<protocol::LogEntry> m_logs;
@@ -212,7 +222,8 @@ private:
         const protocol::BlockHeader& blockHeader, const evmc_message& message,
         const evmc_address& origin, std::string_view abi, int contextID, int64_t& seq,
         PrecompiledManager const& precompiledManager, ledger::LedgerConfig const& ledgerConfig,
-        crypto::Hash const& hashImpl, const evmc_host_interface* hostInterface)
+        crypto::Hash const& hashImpl, std::shared_ptr<SlotCache> slotCache,
+        const evmc_host_interface* hostInterface)
       : evmc_host_context{.interface = hostInterface,
             .wasm_interface = nullptr,
             .hash_fn = evm_hash_fn,
@@ -232,6 +243,7 @@ private:
         m_message(
             getMessage(message, m_blockHeader.get().number(), m_contextID, m_seq, m_hashImpl)),
         m_recipientAccount(getAccount(*this, this->message().recipient)),
+        m_slotCache(std::move(slotCache)),
         m_revision(m_ledgerConfig.get().features().get(ledger::Features::Flag::feature_evm_cancun) ?
                        EVMC_CANCUN :
                        EVMC_PARIS)
@@ -245,6 +257,7 @@ public:
         crypto::Hash const& hashImpl, auto&& waitOperator)
       : HostContext(innerConstructor, storage, transientStorage, blockHeader, message, origin, abi,
             contextID, seq, precompiledManager, ledgerConfig, hashImpl,
+            std::make_shared<SlotCache>(),
             getHostInterface<HostContext>(std::forward<decltype(waitOperator)>(waitOperator)))
     {}
 
@@ -263,12 +276,25 @@ public:
 
     task::Task<evmc_bytes32> get(const evmc_bytes32* key, auto&&... /*unused*/)
     {
-        co_return co_await ledger::account::storage(m_recipientAccount, *key);
+        auto const& address = message().recipient;
+        if (auto const* value = m_slotCache->get(address, *key))
+        {
+            co_return *value;
+        }
+        auto value = co_await ledger::account::storage(m_recipientAccount, *key);
+        m_slotCache->put(address, *key, value);
+        co_return value;
     }
 
     task::Task<void> set(const evmc_bytes32* key, const evmc_bytes32* value, auto&&... /*unused*/)
     {
         co_await ledger::account::setStorage(m_recipientAccount, *key, *value);
+        m_slotCache->put(message().recipient, *key, *value);
+    }
+
+    evmc_access_status accessStorage(const evmc_bytes32* key)
+    {
+        return m_slotCache->access(message().recipient, *key);
     }
 
     task::Task<evmc_bytes32> getTransientStorage(const evmc_bytes32* key, auto&&... /*unused*/)
@@ -416,6 +442,7 @@ public:
 
         auto savepoint = current(hostContext.m_rollbackableStorage.get());
         auto transientSavepoint = current(hostContext.m_rollbackableTransientStorage.get());
+        auto slotSavepoint = current(*hostContext.m_slotCache);
         std::optional<EVMCResult> evmResult;
         if (hostContext.m_ledgerConfig.get().authCheckStatus() != 0U)
         {
@@ -511,6 +538,7 @@ public:
         {
             co_await rollback(hostContext.m_rollbackableStorage.get(), savepoint);
             co_await rollback(hostContext.m_rollbackableTransientStorage.get(), transientSavepoint);
+            rollback(*hostContext.m_slotCache, slotSavepoint);
 
             if (auto hexAddress = address2FixedArray(ref.code_address);
                 precompiled::contains(bcos::precompiled::c_systemTxsAddress,
@@ -546,7 +574,7 @@ public:
 
         HostContext hostcontext(innerConstructor, m_rollbackableStorage.get(),
             m_rollbackableTransientStorage.get(), m_blockHeader, message, m_origin, {}, m_contextID,
-            m_seq, m_precompiledManager.get(), m_ledgerConfig, m_hashImpl, interface);
+            m_seq, m_precompiledManager.get(), m_ledgerConfig, m_hashImpl, m_slotCache, interface);
 
         co_await prepare(hostcontext);
         auto result = co_await execute(hostcontext);
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <evmc/evmc.h>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace bcos::transaction_executor
+{
+
+// The storage slots accessed by one transaction, in front of the rollbackable storage. A slot
+// accessed once (warm, as EIP-2929) is found by one probe of a flat open addressing table, and
+// its value is served without walking the storage layers. Every change is journaled, so the cache
+// is rolled back with the savepoint of the storage when a call reverts.
+class SlotCache
+{
+public:
+    using Savepoint = int64_t;
+
+    // Mark the slot accessed, return the access status before
+    evmc_access_status access(const evmc_address& address, const evmc_bytes32& key)
+    {
+        auto [slot, inserted] = findOrInsert(address, key);
+        return inserted ? EVMC_ACCESS_COLD : EVMC_ACCESS_WARM;
+    }
+
+    // nullptr if the value of the slot is not cached
+    const evmc_bytes32* get(const evmc_address& address, const evmc_bytes32& key) const
+    {
+        if (m_buckets.empty())
+        {
+            return nullptr;
+        }
+        auto index = m_buckets[bucketOf(address, key)];
+        if (index == 0 || !m_slots[index - 1].loaded)
+        {
+            return nullptr;
+        }
+        return std::addressof(m_slots[index - 1].value);
+    }
+
+    // Cache the value read from or written to the storage
+    void put(const evmc_address& address, const evmc_bytes32& key, const evmc_bytes32& value)
+    {
+        auto [slot, inserted] = findOrInsert(address, key);
+        if (!inserted)
+        {
+            m_changes.emplace_back(Change{.index = static_cast<uint32_t>(&slot - m_slots.data()),
+                .inserted = false,
+                .loaded = slot.loaded,
+                .value = slot.value});
+        }
+        slot.loaded = true;
+        slot.value = value;
+    }
+
+    size_t size() const { return m_slots.size(); }
+
+private:
+    constexpr static size_t INITIAL_BUCKETS = 64;
+
+    struct Slot
+    {
+        evmc_address address;
+        evmc_bytes32 key;
+        evmc_bytes32 value;
+        bool loaded;
+    };
+    struct Change
+    {
+        uint32_t index;
+        bool inserted;
+        bool loaded;
+        evmc_bytes32 value;
+    };
+    std::vector<Slot> m_slots;
+    // 0 is empty, otherwise the index of m_slots + 1
+    std::vector<uint32_t> m_buckets;
+    std::vector<Change> m_changes;
+
+    static size_t hash(const evmc_address& address, const evmc_bytes32& key)
+    {
+        // The mapping slots are hashes, the array slots are small numbers in the last bytes
+        uint64_t head = 0;
+        uint64_t tail = 0;
+        uint64_t owner = 0;
+        std::memcpy(&head, key.bytes, sizeof(head));
+        std::memcpy(&tail, key.bytes + sizeof(key.bytes) - sizeof(tail), sizeof(tail));
+        std::memcpy(&owner, address.bytes + sizeof(address.bytes) - sizeof(owner), sizeof(owner));
+        auto mixed = (head ^ std::rotl(tail, 32) ^ owner) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<size_t>(mixed ^ (mixed >> 32));
+    }
+
+    static bool equal(const Slot& slot, const evmc_address& address, const evmc_bytes32& key)
+    {
+        return std::memcmp(slot.key.bytes, key.bytes, sizeof(key.bytes)) == 0 &&
+               std::memcmp(slot.address.bytes, address.bytes, sizeof(address.bytes)) == 0;
+    }
+
+    // The bucket of the slot, or the empty bucket to insert it
+    size_t bucketOf(const evmc_address& address, const evmc_bytes32& key) const
+    {
+        auto mask = m_buckets.size() - 1;
+        for (auto pos = hash(address, key) & mask;; pos = (pos + 1) & mask)
+        {
+            if (auto index = m_buckets[pos];
+                index == 0 || equal(m_slots[index - 1], address, key))
+            {
+                return pos;
+            }
+        }
+    }
+
+    std::pair<Slot&, bool> findOrInsert(const evmc_address& address, const evmc_bytes32& key)
+    {
+        if (m_buckets.empty())
+        {
+            m_buckets.resize(INITIAL_BUCKETS);
+        }
+        auto pos = bucketOf(address, key);
+        if (auto index = m_buckets[pos]; index != 0)
+        {
+            return {m_slots[index - 1], false};
+        }
+
+        m_slots.emplace_back(Slot{.address = address, .key = key, .value = {}, .loaded = false});
+        m_buckets[pos] = static_cast<uint32_t>(m_slots.size());
+        m_changes.emplace_back(Change{.index = static_cast<uint32_t>(m_slots.size() - 1),
+            .inserted = true,
+            .loaded = false,
+            .value = {}});
+        if (m_slots.size() * 2 > m_buckets.size())
+        {
+            rehash(m_buckets.size() * 2);
+        }
+        return {m_slots.back(), true};
+    }
+
+    // Insert in the order of m_slots, so the latest slot is always the tail of its probe chain
+    // and can be removed by clearing its bucket
+    void rehash(size_t bucketCount)
+    {
+        m_buckets.assign(bucketCount, 0);
+        for (uint32_t index = 0; index < m_slots.size(); ++index)
+        {
+            auto& slot = m_slots[index];
+            m_buckets[bucketOf(slot.address, slot.key)] = index + 1;
+        }
+    }
+
+    friend Savepoint current(SlotCache const& cache)
+    {
+        return static_cast<Savepoint>(cache.m_changes.size());
+    }
+
+    friend void rollback(SlotCache& cache, Savepoint savepoint)
+    {
+        while (static_cast<Savepoint>(cache.m_changes.size()) > savepoint)
+        {
+            auto& change = cache.m_changes.back();
+            if (change.inserted)
+            {
+                assert(change.index + 1 == cache.m_slots.size());
+                auto& slot = cache.m_slots.back();
+                cache.m_buckets[cache.bucketOf(slot.address, slot.key)] = 0;
+                cache.m_slots.pop_back();
+            }
+            else
+            {
+                auto& slot = cache.m_slots[change.index];
+                slot.loaded = change.loaded;
+                slot.value = change.value;
+            }
+            cache.m_changes.pop_back();
+        }
+    }
+};
+
+}  // namespace bcos::transaction_executor
@@ -21,6 +21,7 @@
 
 #pragma once
 #include "VMInstance.h"
+#include "bcos-executor/src/vm/CodeAnalysisCache.h"
 #include "bcos-utilities/Error.h"
 #include <evmone/evmone.h>
 #include <boost/throw_exception.hpp>
@@ -54,5 +55,21 @@ public:
             BOOST_THROW_EXCEPTION(UnknownVMError{});
         }
     }
+
+    // The analysis is shared by the code deployed at other addresses and the legacy executor
+    static VMInstance create(
+        VMKind kind, const crypto::HashType& codeHash, bytesConstRef code, evmc_revision mode)
+    {
+        switch (kind)
+        {
+        case VMKind::evmone:
+        {
+            return VMInstance{executor::CodeAnalysisCache::global().getOrAnalyze(codeHash, mode,
+                evmone::bytes_view((const uint8_t*)code.data(), code.size()))};
+        }
+        default:
+            BOOST_THROW_EXCEPTION(UnknownVMError{});
+        }
+    }
 };
 }  // namespace bcos::transaction_executor
\ No newline at end of file
@@ -1,6 +1,5 @@
 #include "VMInstance.h"
-#include <evmone/advanced_analysis.hpp>
-#include <evmone/advanced_execution.hpp>
+#include "bcos-executor/src/vm/ExecutionStatePool.h"
 
 bcos::transaction_executor::VMInstance::VMInstance(
     std::shared_ptr<evmone::baseline::CodeAnalysis const> instance) noexcept
@@ -12,22 +11,14 @@ bcos::transaction_executor::EVMCResult bcos::transaction_executor::VMInstance::e
     const evmc_message* msg, const uint8_t* code, size_t codeSize)
 {
     static auto const* evm = evmc_create_evmone();
-    static thread_local std::unique_ptr<evmone::ExecutionState> localExecutionState;
 
-    auto executionState = std::move(localExecutionState);
-    if (!executionState)
-    {
-        executionState = std::make_unique<evmone::ExecutionState>();
-    }
+    // 嵌套调用从线程的池中取另一个状态，执行结束后归还
+    // The nested call takes another state from the pool of the thread, returned when finished
+    auto executionState = executor::ExecutionStatePool<evmone::ExecutionState>::local().acquire();
     executionState->reset(
         *msg, rev, *host, context, std::basic_string_view<uint8_t>(code, codeSize), {});
-    auto result = EVMCResult(evmone::baseline::execute(
+    return EVMCResult(evmone::baseline::execute(
         *static_cast<evmone::VM const*>(evm), msg->gas, *executionState, *m_instance));
-    if (!localExecutionState)
-    {
-        localExecutionState = std::move(executionState);
-    }
-    return result;
 }
 
 void bcos::transaction_executor::VMInstance::enableDebugOutput() {}
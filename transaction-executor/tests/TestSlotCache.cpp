@@ -0,0 +1,92 @@
+#include "../bcos-transaction-executor/vm/SlotCache.h"
+#include <boost/test/unit_test.hpp>
+
+using namespace bcos;
+using namespace bcos::transaction_executor;
+
+class TestSlotCacheFixture
+{
+public:
+    static evmc_bytes32 toBytes32(uint64_t number)
+    {
+        evmc_bytes32 value{};
+        for (auto i = 0; i < 8; ++i)
+        {
+            value.bytes[sizeof(value.bytes) - 1 - i] = static_cast<uint8_t>(number >> (i * 8));
+        }
+        return value;
+    }
+
+    evmc_address address{.bytes = {0x11, 0x22, 0x33}};
+    evmc_address address2{.bytes = {0x44, 0x55, 0x66}};
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestSlotCache, TestSlotCacheFixture)
+
+BOOST_AUTO_TEST_CASE(accessAndGet)
+{
+    SlotCache slotCache;
+    auto key = toBytes32(1);
+    BOOST_CHECK(!slotCache.get(address, key));
+    BOOST_CHECK_EQUAL(slotCache.access(address, key), EVMC_ACCESS_COLD);
+    BOOST_CHECK_EQUAL(slotCache.access(address, key), EVMC_ACCESS_WARM);
+    BOOST_CHECK_EQUAL(slotCache.access(address2, key), EVMC_ACCESS_COLD);
+    // Accessed but not loaded
+    BOOST_CHECK(!slotCache.get(address, key));
+
+    slotCache.put(address, key, toBytes32(100));
+    BOOST_REQUIRE(slotCache.get(address, key));
+    BOOST_CHECK_EQUAL(slotCache.get(address, key)->bytes[31], 100);
+    BOOST_CHECK(!slotCache.get(address2, key));
+    BOOST_CHECK_EQUAL(slotCache.size(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(rollbackChanges)
+{
+    SlotCache slotCache;
+    slotCache.put(address, toBytes32(1), toBytes32(1));
+    auto savepoint = current(slotCache);
+
+    slotCache.put(address, toBytes32(1), toBytes32(2));
+    slotCache.put(address, toBytes32(2), toBytes32(2));
+    BOOST_CHECK_EQUAL(slotCache.access(address, toBytes32(3)), EVMC_ACCESS_COLD);
+    BOOST_CHECK_EQUAL(slotCache.get(address, toBytes32(1))->bytes[31], 2);
+
+    rollback(slotCache, savepoint);
+    BOOST_CHECK_EQUAL(slotCache.size(), 1);
+    BOOST_CHECK_EQUAL(slotCache.get(address, toBytes32(1))->bytes[31], 1);
+    BOOST_CHECK(!slotCache.get(address, toBytes32(2)));
+    // The access of the reverted call is reverted too
+    BOOST_CHECK_EQUAL(slotCache.access(address, toBytes32(3)), EVMC_ACCESS_COLD);
+}
+
+BOOST_AUTO_TEST_CASE(rollbackAfterGrow)
+{
+    SlotCache slotCache;
+    for (uint64_t i = 0; i < 10; ++i)
+    {
+        slotCache.put(address, toBytes32(i), toBytes32(i));
+    }
+    auto savepoint = current(slotCache);
+    for (uint64_t i = 10; i < 1000; ++i)
+    {
+        slotCache.put(i % 2 == 0 ? address : address2, toBytes32(i), toBytes32(i));
+    }
+    BOOST_CHECK_EQUAL(slotCache.size(), 1000);
+    BOOST_REQUIRE(slotCache.get(address2, toBytes32(999)));
+    BOOST_CHECK_EQUAL(slotCache.get(address2, toBytes32(999))->bytes[31], 999 % 256);
+
+    rollback(slotCache, savepoint);
+    BOOST_CHECK_EQUAL(slotCache.size(), 10);
+    for (uint64_t i = 0; i < 10; ++i)
+    {
+        BOOST_REQUIRE(slotCache.get(address, toBytes32(i)));
+        BOOST_CHECK_EQUAL(slotCache.get(address, toBytes32(i))->bytes[31], i);
+    }
+    for (uint64_t i = 10; i < 1000; ++i)
+    {
+        BOOST_CHECK(!slotCache.get(i % 2 == 0 ? address : address2, toBytes32(i)));
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
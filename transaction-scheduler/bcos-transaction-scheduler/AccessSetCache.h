@@ -0,0 +1,125 @@
+#pragma once
+
+#include "bcos-framework/transaction-executor/StateKey.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace bcos::transaction_scheduler
+{
+
+// The keys read from the backend storage while executing, grouped by the table (the contract
+// storage), the learned keys of the contracts called by a block are prefetched in one batch
+// before executing the block. The tables are sharded by their hash so the concurrent reads of the
+// different tables rarely wait for the same lock, both the tables and the keys of a table are
+// kept in LRU so the keys no longer read are replaced by the hot ones
+class AccessSetCache
+{
+public:
+    constexpr static size_t DEFAULT_MAX_KEYS_PER_TABLE = 256;
+    constexpr static size_t DEFAULT_MAX_TABLES = 4096;
+    constexpr static size_t SHARD_COUNT = 16;
+
+    explicit AccessSetCache(size_t maxKeysPerTable = DEFAULT_MAX_KEYS_PER_TABLE,
+        size_t maxTables = DEFAULT_MAX_TABLES)
+      : m_maxKeysPerTable(std::max<size_t>(maxKeysPerTable, 1)),
+        m_maxTablesPerShard(std::max<size_t>(maxTables / SHARD_COUNT, 1))
+    {}
+
+    void record(transaction_executor::StateKey const& stateKey)
+    {
+        auto [table, key] = transaction_executor::StateKeyView(stateKey).get();
+        auto& shard = m_shards[TableHash{}(table) % SHARD_COUNT];
+        std::unique_lock lock(shard.mutex);
+        auto& keys = touch(shard.tables, shard.index, table, m_maxTablesPerShard).second;
+        touch(keys.keys, keys.index, key, m_maxKeysPerTable);
+    }
+
+    // Append the learned keys of the table to keys, the most recently read first
+    void collect(std::string_view table, std::vector<transaction_executor::StateKey>& keys) const
+    {
+        auto const& shard = m_shards[TableHash{}(table) % SHARD_COUNT];
+        std::unique_lock lock(shard.mutex);
+        if (auto it = shard.index.find(table); it != shard.index.end())
+        {
+            auto const& tableKeys = it->second->second.keys;
+            keys.reserve(keys.size() + tableKeys.size());
+            for (auto const& key : tableKeys)
+            {
+                keys.emplace_back(table, key.first);
+            }
+        }
+    }
+
+    size_t tableCount() const
+    {
+        size_t count = 0;
+        for (auto const& shard : m_shards)
+        {
+            std::unique_lock lock(shard.mutex);
+            count += shard.tables.size();
+        }
+        return count;
+    }
+
+private:
+    struct TableHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::string_view table) const noexcept
+        {
+            return std::hash<std::string_view>{}(table);
+        }
+    };
+    // The most recently read first, the index refers to the strings in the list nodes
+    template <class Value>
+    using LRUList = std::list<std::pair<std::string, Value>>;
+    template <class Value>
+    using LRUIndex = std::unordered_map<std::string_view, typename LRUList<Value>::iterator,
+        TableHash, std::equal_to<>>;
+
+    struct Keys
+    {
+        LRUList<std::monostate> keys;
+        LRUIndex<std::monostate> index;
+    };
+    struct Shard
+    {
+        mutable std::mutex mutex;
+        LRUList<Keys> tables;
+        LRUIndex<Keys> index;
+    };
+
+    // Move the name to the front of the list, evict the least recently read one when full
+    template <class Value>
+    static std::pair<std::string, Value>& touch(LRUList<Value>& list, LRUIndex<Value>& index,
+        std::string_view name, size_t capacity)
+    {
+        if (auto it = index.find(name); it != index.end())
+        {
+            list.splice(list.begin(), list, it->second);
+            return list.front();
+        }
+        if (list.size() >= capacity)
+        {
+            index.erase(list.back().first);
+            list.pop_back();
+        }
+        list.emplace_front(std::string(name), Value{});
+        index.emplace(list.front().first, list.begin());
+        return list.front();
+    }
+
+    size_t m_maxKeysPerTable;
+    size_t m_maxTablesPerShard;
+    std::array<Shard, SHARD_COUNT> m_shards;
+};
+
+}  // namespace bcos::transaction_scheduler
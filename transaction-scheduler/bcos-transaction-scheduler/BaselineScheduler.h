@@ -1,4 +1,5 @@
 #pragma once
+#include "AccessSetCache.h"
 
 #include "bcos-crypto/interfaces/crypto/Hash.h"
 #include "bcos-crypto/merkle/Merkle.h"
@@ -31,14 +32,18 @@
 #include <oneapi/tbb/concurrent_vector.h>
 #include <oneapi/tbb/parallel_invoke.h>
 #include <oneapi/tbb/parallel_reduce.h>
+#include <oneapi/tbb/task_arena.h>
 #include <oneapi/tbb/task_group.h>
 #include <boost/atomic.hpp>
 #include <boost/exception/diagnostic_information.hpp>
 #include <boost/throw_exception.hpp>
+#include <algorithm>
 #include <chrono>
 #include <exception>
 #include <memory>
 #include <type_traits>
+#include <unordered_set>
+#include <vector>
 
 namespace bcos::transaction_scheduler
 {
@@ -244,6 +249,55 @@ private:
     std::deque<ExecuteResult> m_results;
     std::mutex m_resultsMutex;
 
+    tbb::task_arena m_callArena;
+    tbb::task_group m_callGroup;
+    std::shared_ptr<AccessSetCache> m_accessSetCache;
+
+    /**
+     * Prefetches the keys learned from the previous executions of the contracts called by the
+     * transactions in one batch, and learns the keys read from the backend storage by this
+     * execution.
+     *
+     * @param view The view to execute the block.
+     * @param transactions The transactions of the block.
+     * @param ledgerConfig The ledger config to execute the block.
+     */
+    friend task::Task<void> prefetchAccessSets(BaselineScheduler& scheduler, auto& view,
+        auto const& transactions, ledger::LedgerConfig const& ledgerConfig)
+    {
+        if (!scheduler.m_accessSetCache)
+        {
+            co_return;
+        }
+        auto now = current();
+        auto rawAddress = ledgerConfig.features().get(ledger::Features::Flag::feature_raw_address);
+        std::unordered_set<std::string> tables;
+        std::vector<transaction_executor::StateKey> keys;
+        for (auto const& transaction : transactions)
+        {
+            if (transaction->to().empty())
+            {
+                continue;
+            }
+            ledger::account::EVMAccount account(view, unhexAddress(transaction->to()), rawAddress);
+            auto table = co_await ledger::account::path(account);
+            if (tables.emplace(table).second)
+            {
+                scheduler.m_accessSetCache->collect(table, keys);
+            }
+        }
+
+        auto keyCount = keys.size();
+        auto prefetched = keys.empty() ? 0 : co_await prefetch(view, std::move(keys));
+        view.m_onBackendRead = [accessSetCache = scheduler.m_accessSetCache](
+                                   transaction_executor::StateKey const& key) {
+            accessSetCache->record(key);
+        };
+        BASELINE_SCHEDULER_LOG(DEBUG)
+            << "Prefetch access sets, tables: " << tables.size() << ", keys: " << keyCount
+            << ", prefetched: " << prefetched << ", elapsed: " << (current() - now) << "ms";
+    }
+
     /**
      * Executes a block and returns a tuple containing an error (if any), the block header, and
      * a boolean indicating success.
@@ -322,6 +376,7 @@ private:
                 std::unique_lock ledgerConfigLock(scheduler.m_ledgerConfigMutex);
                 ledgerConfig = scheduler.m_ledgerConfig;
             }
+            co_await prefetchAccessSets(scheduler, view, transactions, *ledgerConfig);
             auto receipts = co_await transaction_scheduler::executeBlock(
                 scheduler.m_schedulerImpl.get(), view, scheduler.m_executor.get(), *blockHeader,
                 ::ranges::views::indirect(transactions), *ledgerConfig);
@@ -359,10 +414,12 @@ private:
                     nullptr, false);
             }
 
+            // 已执行未提交的区块数与存储层数一起更新，只读调用据此跳过未提交的层
+            // The executed but not committed blocks are updated with the storage layers together,
+            // the read only calls skip the layers not committed by them
+            std::unique_lock resultsLock(scheduler.m_resultsMutex);
             pushView(scheduler.m_multiLayerStorage.get(), std::move(view));
             scheduler.m_lastExecutedBlockNumber = blockHeader->number();
-
-            std::unique_lock resultsLock(scheduler.m_resultsMutex);
             scheduler.m_results.push_front(
                 {.m_transactions =
                         std::make_shared<protocol::ConstTransactions>(std::move(transactions)),
@@ -534,12 +591,75 @@ private:
         }
     }
 
+    /**
+     * Executes a read only transaction on the state of the latest committed block, or of the
+     * block being committed, the blocks executed but not committing yet are invisible and never
+     * locked.
+     *
+     * @param transaction The transaction to call.
+     * @return A task that returns a tuple containing an error object and the receipt.
+     */
+    friend task::Task<std::tuple<Error::Ptr, protocol::TransactionReceipt::Ptr>> coCall(
+        BaselineScheduler& scheduler, protocol::Transaction::Ptr transaction)
+    {
+        try
+        {
+            ledger::LedgerConfig::Ptr ledgerConfig;
+            {
+                std::unique_lock ledgerConfigLock(scheduler.m_ledgerConfigMutex);
+                ledgerConfig = scheduler.m_ledgerConfig;
+            }
+            // 未开始提交的区块与存储层在m_resultsMutex下一起更新，跳过这些层；
+            // 正在提交的区块在合并完成前仍在最上层，不会单独读到合并了一半的后端存储
+            // The blocks not committing yet are updated with the storage layers together under
+            // m_resultsMutex, skip their layers; the layer of the block being committed stays on
+            // top until merged, so the half merged backend is never read alone
+            auto view = [&]() {
+                std::unique_lock resultsLock(scheduler.m_resultsMutex);
+                return fork(scheduler.m_multiLayerStorage.get(), scheduler.m_results.size());
+            }();
+            newMutable(view);
+            auto blockHeader = scheduler.m_blockHeaderFactory.get().createBlockHeader();
+
+            protocol::TransactionReceipt::Ptr receipt;
+            if (ledgerConfig)
+            {
+                blockHeader->setVersion(ledgerConfig->compatibilityVersion());
+                blockHeader->setNumber(ledgerConfig->blockNumber() + 1);  // Use next block number
+                blockHeader->calculateHash(scheduler.m_hashImpl.get());
+                receipt = co_await transaction_executor::executeTransaction(
+                    scheduler.m_executor.get(), view, *blockHeader, *transaction, 0,
+                    *ledgerConfig, task::syncWait);
+            }
+            else
+            {
+                ledger::LedgerConfig emptyLedgerConfig;
+                blockHeader->setVersion((uint32_t)bcos::protocol::BlockVersion::V3_2_4_VERSION);
+                blockHeader->calculateHash(scheduler.m_hashImpl.get());
+                receipt = co_await transaction_executor::executeTransaction(
+                    scheduler.m_executor.get(), view, *blockHeader, *transaction, 0,
+                    emptyLedgerConfig, task::syncWait);
+            }
+            co_return std::make_tuple(Error::Ptr{}, std::move(receipt));
+        }
+        catch (std::exception& e)
+        {
+            auto message = fmt::format("Call failed! {}", boost::diagnostic_information(e));
+            BASELINE_SCHEDULER_LOG(ERROR) << message;
+
+            co_return std::make_tuple(
+                BCOS_ERROR_UNIQUE_PTR(scheduler::SchedulerError::UnknownError, message), nullptr);
+        }
+    }
+
 public:
+    constexpr static size_t DEFAULT_CALL_CONCURRENCY = 4;
+
     BaselineScheduler(MultiLayerStorage& multiLayerStorage, SchedulerImpl& schedulerImpl,
         Executor& executor, protocol::BlockHeaderFactory& blockFactory, Ledger& ledger,
         txpool::TxPoolInterface& txPool,
         protocol::TransactionSubmitResultFactory& transactionSubmitResultFactory,
-        crypto::Hash const& hashImpl)
+        crypto::Hash const& hashImpl, size_t callConcurrency = DEFAULT_CALL_CONCURRENCY)
       : m_multiLayerStorage(multiLayerStorage),
         m_schedulerImpl(schedulerImpl),
         m_executor(executor),
@@ -548,13 +668,19 @@ public:
         m_txpool(txPool),
         m_transactionSubmitResultFactory(transactionSubmitResultFactory),
         m_hashImpl(hashImpl),
-        m_ledgerConfig(task::syncWait(ledger::getLedgerConfig(m_ledger)))
+        m_ledgerConfig(task::syncWait(ledger::getLedgerConfig(m_ledger))),
+        m_callArena(static_cast<int>(std::max<size_t>(callConcurrency, 1)), 0,
+            tbb::task_arena::priority::low)
     {}
     BaselineScheduler(const BaselineScheduler&) = delete;
     BaselineScheduler(BaselineScheduler&&) noexcept = default;
     BaselineScheduler& operator=(const BaselineScheduler&) = delete;
     BaselineScheduler& operator=(BaselineScheduler&&) noexcept = default;
-    ~BaselineScheduler() noexcept override { m_asyncGroup.wait(); }
+    ~BaselineScheduler() noexcept override
+    {
+        m_callArena.execute([this]() { m_callGroup.wait(); });
+        m_asyncGroup.wait();
+    }
 
     void executeBlock(bcos::protocol::Block::Ptr block, bool verify,
         std::function<void(bcos::Error::Ptr&&, bcos::protocol::BlockHeader::Ptr&&, bool sysBlock)>
@@ -585,37 +711,18 @@ public:
     void call(protocol::Transaction::Ptr transaction,
         std::function<void(Error::Ptr&&, protocol::TransactionReceipt::Ptr&&)> callback) override
     {
-        task::wait([](decltype(this) self, protocol::Transaction::Ptr transaction,
-                       decltype(callback) callback) -> task::Task<void> {
-            auto view = fork(self->m_multiLayerStorage.get());
-            newMutable(view);
-            auto blockHeader = self->m_blockHeaderFactory.get().createBlockHeader();
-            ledger::LedgerConfig::Ptr ledgerConfig;
-            {
-                std::unique_lock ledgerConfigLock(self->m_ledgerConfigMutex);
-                ledgerConfig = self->m_ledgerConfig;
-            }
-
-            protocol::TransactionReceipt::Ptr receipt;
-            if (ledgerConfig)
-            {
-                blockHeader->setVersion(ledgerConfig->compatibilityVersion());
-                blockHeader->setNumber(ledgerConfig->blockNumber() + 1);  // Use next block number
-                blockHeader->calculateHash(self->m_hashImpl.get());
-                receipt = co_await transaction_executor::executeTransaction(self->m_executor.get(),
-                    view, *blockHeader, *transaction, 0, *ledgerConfig, task::syncWait);
-            }
-            else
-            {
-                ledger::LedgerConfig emptyLedgerConfig;
-                blockHeader->setVersion((uint32_t)bcos::protocol::BlockVersion::V3_2_4_VERSION);
-                blockHeader->calculateHash(self->m_hashImpl.get());
-                receipt = co_await transaction_executor::executeTransaction(self->m_executor.get(),
-                    view, *blockHeader, *transaction, 0, emptyLedgerConfig, task::syncWait);
-            }
-
-            callback(nullptr, std::move(receipt));
-        }(this, std::move(transaction), std::move(callback)));
+        // 只读调用在独立的低优先级线程池中并发执行，不占用区块执行的线程
+        // 入队后立即返回，不阻塞调用方；任务在入队时即计入m_callGroup，析构时会等待其完成
+        // The read only calls run concurrently in a dedicated low priority arena, never take the
+        // threads of the block execution; enqueue returns at once without blocking the caller, the
+        // task is counted by m_callGroup when enqueued so the destructor waits for it
+        m_callArena.enqueue(m_callGroup.defer(
+            [this, transaction = std::move(transaction), callback = std::move(callback)]() {
+                task::wait([](decltype(this) self, protocol::Transaction::Ptr transaction,
+                               decltype(callback) callback) -> task::Task<void> {
+                    std::apply(callback, co_await coCall(*self, std::move(transaction)));
+                }(this, transaction, callback));
+            }));
     }
 
     void reset([[maybe_unused]] std::function<void(Error::Ptr&&)> callback) override
@@ -673,6 +780,14 @@ public:
 
     void stop() override {};
 
+    // 学习交易的访问集并在执行区块前批量预读，nullptr表示不预读
+    // Learn the access sets of the transactions and prefetch them before executing the blocks,
+    // nullptr disables the prefetch
+    void setAccessSetCache(std::shared_ptr<AccessSetCache> accessSetCache)
+    {
+        m_accessSetCache = std::move(accessSetCache);
+    }
+
     void registerTransactionNotifier(std::function<void(bcos::protocol::BlockNumber,
             bcos::protocol::TransactionSubmitResultsPtr, std::function<void(Error::Ptr)>)>
             txNotifier)
@@ -7,12 +7,16 @@
 #include "bcos-utilities/RecursiveLambda.h"
 #include <oneapi/tbb/parallel_invoke.h>
 #include <boost/throw_exception.hpp>
+#include <algorithm>
 #include <functional>
+#include <optional>
+#include <range/v3/range/conversion.hpp>
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/map.hpp>
 #include <range/v3/view/zip.hpp>
 #include <type_traits>
 #include <variant>
+#include <vector>
 
 namespace bcos::transaction_scheduler
 {
@@ -76,6 +80,8 @@ public:
     [[no_unique_address]] std::conditional_t<withCacheStorage,
         std::reference_wrapper<std::remove_reference_t<CachedStorage>>, std::monostate>
         m_cacheStorage;
+    // Called with the keys read from the backend storage, e.g. to learn the access sets
+    std::function<void(Key const&)> m_onBackendRead;
 
     View(BackendStorage& backendStorage)
         requires(!withCacheStorage)
@@ -143,6 +149,16 @@ public:
             }
         }
 
+        if (view.m_onBackendRead)
+        {
+            for (auto&& [key, value] : ::ranges::views::zip(keys, values))
+            {
+                if (!value)
+                {
+                    view.m_onBackendRead(Key(key));
+                }
+            }
+        }
         co_await fillMissingValues<typename View::Key, typename View::Value>(
             view.m_backendStorage.get(), keys, values);
         co_return values;
@@ -203,6 +219,10 @@ public:
             }
         }
 
+        if (view.m_onBackendRead)
+        {
+            view.m_onBackendRead(Key(key));
+        }
         co_return co_await storage2::readOne(view.m_backendStorage.get(), key);
     }
 
@@ -384,6 +404,57 @@ public:
 
     friend BackendStorage& backendStorage(View& view) { return view.m_backendStorage; }
 
+    // Read the keys not in the memory layers from the backend storage in one batch, the values
+    // found are kept as the oldest immutable layer of the view, so the reads during execution
+    // don't hit the backend storage one by one. Return the count of the values found.
+    friend task::Task<size_t> prefetch(View& view, ::ranges::input_range auto&& keys)
+    {
+        auto keyList = ::ranges::to<std::vector<Key>>(std::forward<decltype(keys)>(keys));
+        std::vector<std::optional<Value>> values(keyList.size());
+        if (view.m_mutableStorage)
+        {
+            co_await fillMissingValues<Key, Value>(*view.m_mutableStorage, keyList, values);
+        }
+        for (auto& immutableStorage : view.m_immutableStorages)
+        {
+            co_await fillMissingValues<Key, Value>(*immutableStorage, keyList, values);
+        }
+        if constexpr (withCacheStorage)
+        {
+            co_await fillMissingValues<Key, Value>(view.m_cacheStorage.get(), keyList, values);
+        }
+
+        std::vector<Key> missingKeys;
+        for (auto&& [key, value] : ::ranges::views::zip(keyList, values))
+        {
+            if (!value)
+            {
+                missingKeys.emplace_back(std::move(key));
+            }
+        }
+        if (missingKeys.empty())
+        {
+            co_return 0;
+        }
+
+        auto gotValues = co_await storage2::readSome(view.m_backendStorage.get(), missingKeys);
+        auto prefetched = std::make_shared<MutableStorage>();
+        size_t count = 0;
+        for (auto&& [key, value] : ::ranges::views::zip(missingKeys, gotValues))
+        {
+            if (value)
+            {
+                co_await storage2::writeOne(*prefetched, std::move(key), std::move(*value));
+                ++count;
+            }
+        }
+        if (count > 0)
+        {
+            view.m_immutableStorages.push_back(std::move(prefetched));
+        }
+        co_return count;
+    }
+
     friend task::Task<Iterator> tag_invoke(
         bcos::storage2::tag_t<storage2::range> /*unused*/, View& view, auto&&... args)
     {
@@ -461,6 +532,16 @@ private:
         }
     }
 
+    // Fork without the newest skip layers, e.g. the blocks executed but not committed
+    friend ViewType fork(MultiLayerStorage& storage, size_t skip)
+    {
+        auto view = fork(storage);
+        view.m_immutableStorages.erase(view.m_immutableStorages.begin(),
+            view.m_immutableStorages.begin() +
+                static_cast<std::ptrdiff_t>(std::min(skip, view.m_immutableStorages.size())));
+        return view;
+    }
+
     friend void pushView(MultiLayerStorage& storage, ViewType view)
     {
         if (!view.m_mutableStorage)
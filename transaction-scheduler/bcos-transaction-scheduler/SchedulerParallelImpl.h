@@ -13,16 +13,22 @@
 #include "bcos-task/Trait.h"
 #include "bcos-utilities/ITTAPI.h"
 #include <oneapi/tbb/cache_aligned_allocator.h>
+#include <oneapi/tbb/parallel_for.h>
 #include <oneapi/tbb/parallel_pipeline.h>
 #include <oneapi/tbb/task_arena.h>
 #include <oneapi/tbb/task_group.h>
+#include <boost/container_hash/hash.hpp>
 #include <boost/throw_exception.hpp>
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <range/v3/view/enumerate.hpp>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 namespace bcos::transaction_scheduler
 {
@@ -326,6 +332,116 @@ size_t executeSinglePass(SchedulerParallelImpl& scheduler, auto& storage, auto&
     return 0;
 }
 
+using OptionalConflictKeys = std::optional<std::vector<bytes>>;
+
+/**
+ * @brief Execute the contexts by their conflict keys. A transaction is placed in the level after
+ * the latest level of the previous transactions sharing a key with it, so the transactions of a
+ * level are independent and never retry, and each level is executed after the levels it depends
+ * on. The transactions without the keys are executed optimistically in the block order, as a
+ * barrier between the runs of the transactions with the keys.
+ *
+ * @return The retry count of the passes
+ */
+template <IsSchedulerParallelImpl SchedulerParallelImpl>
+size_t executeDAG(SchedulerParallelImpl& scheduler, auto& storage, auto& executor,
+    protocol::BlockHeader const& blockHeader, ledger::LedgerConfig const& ledgerConfig,
+    std::vector<ExecutionContext>& contexts, std::vector<OptionalConflictKeys> const& conflictKeys)
+{
+    size_t retryCount = 0;
+    size_t offset = 0;
+    while (offset < contexts.size())
+    {
+        auto end = offset;
+        auto hasKeys = conflictKeys[offset].has_value();
+        while (end < contexts.size() && conflictKeys[end].has_value() == hasKeys)
+        {
+            ++end;
+        }
+
+        if (!hasKeys && offset == 0 && end == contexts.size())
+        {
+            retryCount += executeSinglePass(scheduler, storage, executor, blockHeader,
+                ledgerConfig, contexts, scheduler.m_grainSize);
+        }
+        else if (!hasKeys)
+        {
+            std::vector<ExecutionContext> run(contexts.begin() + static_cast<int64_t>(offset),
+                contexts.begin() + static_cast<int64_t>(end));
+            retryCount += executeSinglePass(scheduler, storage, executor, blockHeader,
+                ledgerConfig, run, scheduler.m_grainSize);
+        }
+        else
+        {
+            std::unordered_map<bytes, size_t, boost::hash<bytes>> keyLevels;
+            std::vector<std::vector<ExecutionContext>> levels;
+            for (auto index = offset; index < end; ++index)
+            {
+                size_t level = 0;
+                for (auto const& key : *conflictKeys[index])
+                {
+                    if (auto it = keyLevels.find(key); it != keyLevels.end())
+                    {
+                        level = std::max(level, it->second + 1);
+                    }
+                }
+                for (auto const& key : *conflictKeys[index])
+                {
+                    keyLevels.insert_or_assign(key, level);
+                }
+                if (level >= levels.size())
+                {
+                    levels.resize(level + 1);
+                }
+                levels[level].emplace_back(contexts[index]);
+            }
+
+            PARALLEL_SCHEDULER_LOG(DEBUG) << "Execute DAG, transactions: " << end - offset
+                                          << ", levels: " << levels.size();
+            for (auto& level : levels)
+            {
+                retryCount += executeSinglePass(scheduler, storage, executor, blockHeader,
+                    ledgerConfig, level, scheduler.m_grainSize);
+            }
+        }
+        offset = end;
+    }
+
+    return retryCount;
+}
+
+/**
+ * @brief The declared conflict keys of the transactions with the DAG attribute, std::nullopt for
+ * the others or if the executor doesn't support them
+ */
+std::vector<OptionalConflictKeys> getConflictKeys(auto& storage, auto& executor,
+    protocol::BlockHeader const& blockHeader,
+    ::ranges::random_access_range auto const& transactions,
+    ledger::LedgerConfig const& ledgerConfig)
+{
+    std::vector<OptionalConflictKeys> conflictKeys(RANGES::size(transactions));
+    if constexpr (requires(protocol::Transaction const& transaction) {
+                      transaction_executor::conflictKeys(
+                          executor, storage, blockHeader, transaction, ledgerConfig);
+                  })
+    {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, conflictKeys.size()),
+            [&](tbb::blocked_range<size_t> const& range) {
+                for (auto index = range.begin(); index != range.end(); ++index)
+                {
+                    auto const& transaction = transactions[index];
+                    if ((transaction.attribute() & protocol::Transaction::Attribute::DAG) != 0)
+                    {
+                        conflictKeys[index] =
+                            task::tbb::syncWait(transaction_executor::conflictKeys(
+                                executor, storage, blockHeader, transaction, ledgerConfig));
+                    }
+                }
+            });
+    }
+    return conflictKeys;
+}
+
 template <IsSchedulerParallelImpl SchedulerParallelImpl>
 task::Task<std::vector<protocol::TransactionReceipt::Ptr>> tag_invoke(
     tag_t<executeBlock> /*unused*/, SchedulerParallelImpl& scheduler, auto& storage, auto& executor,
@@ -348,8 +464,22 @@ task::Task<std::vector<protocol::TransactionReceipt::Ptr>> tag_invoke(
 
     tbb::task_arena arena(scheduler.m_maxConcurrency, 1, tbb::task_arena::priority::high);
     arena.execute([&]() {
-        auto retryCount = executeSinglePass(scheduler, storage, executor, blockHeader, ledgerConfig,
-            contexts, scheduler.m_grainSize);
+        size_t retryCount = 0;
+        // 分层执行会改变交易的执行顺序，必须由链上的feature开启，保证所有节点的结果一致
+        // The levels change the execution order, so they are enabled by the feature of the
+        // ledger, the same on all the nodes
+        if (ledgerConfig.features().get(ledger::Features::Flag::feature_dag_scheduler))
+        {
+            auto conflictKeys =
+                getConflictKeys(storage, executor, blockHeader, transactions, ledgerConfig);
+            retryCount = executeDAG(
+                scheduler, storage, executor, blockHeader, ledgerConfig, contexts, conflictKeys);
+        }
+        else
+        {
+            retryCount = executeSinglePass(scheduler, storage, executor, blockHeader,
+                ledgerConfig, contexts, scheduler.m_grainSize);
+        }
         GC::collect(std::move(contexts));
         PARALLEL_SCHEDULER_LOG(INFO) << "Parallel execute block retry count: " << retryCount;
     });
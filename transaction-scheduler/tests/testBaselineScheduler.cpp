@@ -21,6 +21,13 @@ using namespace bcos;
 using namespace bcos::storage2;
 using namespace bcos::transaction_executor;
 using namespace bcos::transaction_scheduler;
+using namespace std::string_view_literals;
+
+// The state written by each block of MockScheduler, read back by the calls
+inline StateKey blockStateKey()
+{
+    return StateKey{"test_table"sv, "block"sv};
+}
 
 struct MockExecutorBaseline
 {
@@ -31,7 +38,15 @@ struct MockExecutorBaseline
         protocol::Transaction const& transaction, int contextID, ledger::LedgerConfig const&,
         auto&& waitOperator)
     {
-        co_return std::shared_ptr<protocol::TransactionReceipt>();
+        // The output is the block state visible to the transaction
+        auto receipt = std::make_shared<bcostars::protocol::TransactionReceiptImpl>(
+            [inner = bcostars::TransactionReceipt()]() mutable { return std::addressof(inner); });
+        if (auto value = co_await storage2::readOne(storage, blockStateKey()))
+        {
+            auto view = value->get();
+            receipt->mutableInner().data.output.assign(view.begin(), view.end());
+        }
+        co_return receipt;
     }
 };
 struct MockScheduler
@@ -42,6 +57,10 @@ struct MockScheduler
         protocol::BlockHeader const& blockHeader, RANGES::input_range auto const& transactions,
         ledger::LedgerConfig const& /*unused*/)
     {
+        storage::Entry entry;
+        entry.set(std::to_string(blockHeader.number()));
+        co_await storage2::writeOne(storage, blockStateKey(), std::move(entry));
+
         auto receipts =
             RANGES::iota_view<size_t, size_t>(0, RANGES::size(transactions)) |
             RANGES::views::transform([](size_t index) -> protocol::TransactionReceipt::Ptr {
@@ -61,12 +80,18 @@ struct MockScheduler
 
 struct MockLedger
 {
+    // Called when a block starts committing, before its storage is merged
+    std::function<void()> onPrewrite;
 };
 
 inline task::AwaitableValue<void> tag_invoke(ledger::tag_t<bcos::ledger::prewriteBlock> /*unused*/,
     MockLedger& ledger, bcos::protocol::ConstTransactionsPtr transactions,
     bcos::protocol::Block::ConstPtr block, bool withTransactionsAndReceipts, auto& storage)
 {
+    if (ledger.onPrewrite)
+    {
+        ledger.onPrewrite();
+    }
     return {};
 }
 
@@ -253,4 +278,114 @@ BOOST_AUTO_TEST_CASE(sameBlock)
     BOOST_CHECK(!error2);
 }
 
+BOOST_AUTO_TEST_CASE(concurrentCall)
+{
+    bcos::bytes input;
+    auto transaction =
+        transactionFactory->createTransaction(0, "to", input, "12345", 100, "chain", "group", 0);
+
+    constexpr static auto CALL_COUNT = 16;
+    std::vector<std::promise<bcos::Error::Ptr>> ends(CALL_COUNT);
+    for (auto& end : ends)
+    {
+        baselineScheduler.call(transaction,
+            [&end](bcos::Error::Ptr&& error, protocol::TransactionReceipt::Ptr&& /*unused*/) {
+                end.set_value(std::move(error));
+            });
+    }
+    for (auto& end : ends)
+    {
+        BOOST_CHECK(!end.get_future().get());
+    }
+
+    // The calls never block the block execution
+    auto block = std::make_shared<bcostars::protocol::BlockImpl>();
+    auto blockHeader = block->blockHeader();
+    blockHeader->setNumber(500);
+    blockHeader->setVersion(200);
+    blockHeader->calculateHash(*hashImpl);
+    block->appendTransaction(transaction);
+
+    std::promise<bcos::Error::Ptr> executeEnd;
+    std::promise<bcos::Error::Ptr> callEnd;
+    baselineScheduler.executeBlock(block, false,
+        [&](bcos::Error::Ptr&& error, bcos::protocol::BlockHeader::Ptr&& /*unused*/,
+            bool /*unused*/) { executeEnd.set_value(std::move(error)); });
+    baselineScheduler.call(transaction,
+        [&](bcos::Error::Ptr&& error, protocol::TransactionReceipt::Ptr&& /*unused*/) {
+            callEnd.set_value(std::move(error));
+        });
+    BOOST_CHECK(!executeEnd.get_future().get());
+    BOOST_CHECK(!callEnd.get_future().get());
+}
+
+BOOST_AUTO_TEST_CASE(callWhileCommit)
+{
+    baselineScheduler.registerBlockNumberNotifier([](bcos::protocol::BlockNumber) {});
+    baselineScheduler.registerTransactionNotifier(
+        [](bcos::protocol::BlockNumber, bcos::protocol::TransactionSubmitResultsPtr,
+            std::function<void(Error::Ptr)> callback) { callback(nullptr); });
+
+    bcos::bytes input;
+    auto transaction =
+        transactionFactory->createTransaction(0, "to", input, "12345", 100, "chain", "group", 0);
+    auto callOutput = [&]() {
+        std::promise<std::string> end;
+        baselineScheduler.call(transaction,
+            [&end](bcos::Error::Ptr&& error, protocol::TransactionReceipt::Ptr&& receipt) {
+                if (error || !receipt)
+                {
+                    end.set_value("error");
+                    return;
+                }
+                auto output = receipt->output();
+                end.set_value(std::string((char const*)output.data(), output.size()));
+            });
+        return end.get_future().get();
+    };
+
+    auto block = std::make_shared<bcostars::protocol::BlockImpl>();
+    auto blockHeader = block->blockHeader();
+    blockHeader->setNumber(500);
+    blockHeader->setVersion(200);
+    blockHeader->calculateHash(*hashImpl);
+    block->appendTransaction(transaction);
+
+    std::promise<bcos::protocol::BlockHeader::Ptr> executeEnd;
+    baselineScheduler.executeBlock(block, false,
+        [&](bcos::Error::Ptr&& error, bcos::protocol::BlockHeader::Ptr&& executedHeader,
+            bool /*unused*/) {
+            executeEnd.set_value(error ? nullptr : std::move(executedHeader));
+        });
+    auto executedHeader = executeEnd.get_future().get();
+    BOOST_REQUIRE(executedHeader);
+    // The block executed but not committed is invisible
+    BOOST_CHECK_EQUAL(callOutput(), "");
+
+    // Hold the commit before its storage is merged
+    std::promise<void> committing;
+    std::promise<void> resume;
+    auto resumed = resume.get_future().share();
+    mockLedger.onPrewrite = [&]() {
+        committing.set_value();
+        resumed.wait();
+    };
+    auto commitEnd = std::async(std::launch::async, [&]() {
+        std::promise<bcos::Error::Ptr> end;
+        baselineScheduler.commitBlock(executedHeader,
+            [&end](Error::Ptr&& error, ledger::LedgerConfig::Ptr&& /*unused*/) {
+                end.set_value(std::move(error));
+            });
+        return end.get_future().get();
+    });
+    committing.get_future().wait();
+
+    // The block being committed stays on top of the backend until merged, it is never skipped
+    BOOST_CHECK_EQUAL(callOutput(), "500");
+    resume.set_value();
+    BOOST_CHECK(!commitEnd.get());
+    mockLedger.onPrewrite = {};
+    BOOST_CHECK_EQUAL(callOutput(), "500");
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "bcos-framework/storage2/Storage.h"
 #include "bcos-framework/transaction-executor/StateKey.h"
 #include "bcos-task/Wait.h"
+#include "bcos-transaction-scheduler/AccessSetCache.h"
 #include "bcos-transaction-scheduler/MultiLayerStorage.h"
 #include "bcos-transaction-scheduler/ReadWriteSetStorage.h"
 #include <fmt/format.h>
@@ -70,6 +71,33 @@ BOOST_AUTO_TEST_CASE(readWriteMutable)
     }());
 }
 
+BOOST_AUTO_TEST_CASE(forkSkip)
+{
+    task::syncWait([this]() -> task::Task<void> {
+        StateKey key{"test_table"sv, "test_key"sv};
+        for (auto num : RANGES::iota_view<int, int>(0, 2))
+        {
+            auto view = fork(multiLayerStorage);
+            newMutable(view);
+            storage::Entry entry;
+            entry.set(fmt::format("value: {}", num));
+            co_await storage2::writeOne(view, key, std::move(entry));
+            pushView(multiLayerStorage, std::move(view));
+        }
+
+        auto view = fork(multiLayerStorage, 1);
+        auto value = co_await storage2::readOne(view, key);
+        BOOST_REQUIRE(value);
+        BOOST_CHECK_EQUAL(value->get(), "value: 0");
+
+        auto view2 = fork(multiLayerStorage, 10);
+        auto value2 = co_await storage2::readOne(view2, key);
+        BOOST_CHECK(!value2);
+
+        co_return;
+    }());
+}
+
 BOOST_AUTO_TEST_CASE(merge)
 {
     task::syncWait([this]() -> task::Task<void> {
@@ -180,4 +208,89 @@ BOOST_AUTO_TEST_CASE(rangeMulti)
     }());
 }
 
+BOOST_AUTO_TEST_CASE(prefetch)
+{
+    task::syncWait([this]() -> task::Task<void> {
+        auto toKey = RANGES::views::transform(
+            [](int num) { return StateKey{"test_table"sv, fmt::format("key: {}", num)}; });
+        auto toValue = RANGES::views::transform([](int num) {
+            storage::Entry entry;
+            entry.set(fmt::format("value: {}", num));
+            return entry;
+        });
+        co_await storage2::writeSome(
+            backendStorage, ::ranges::views::zip(RANGES::iota_view<int, int>(0, 10) | toKey,
+                                RANGES::iota_view<int, int>(0, 10) | toValue));
+
+        // Learn the keys read from the backend storage
+        AccessSetCache accessSetCache;
+        auto view = fork(multiLayerStorage);
+        newMutable(view);
+        view.m_onBackendRead = [&](StateKey const& key) { accessSetCache.record(key); };
+        co_await storage2::readSome(view, RANGES::iota_view<int, int>(0, 5) | toKey);
+        BOOST_CHECK_EQUAL(accessSetCache.tableCount(), 1);
+
+        std::vector<StateKey> keys;
+        accessSetCache.collect("test_table"sv, keys);
+        BOOST_CHECK_EQUAL(keys.size(), 5);
+        // The missing key is skipped
+        keys.emplace_back("test_table"sv, "key: 100"sv);
+
+        auto view2 = fork(multiLayerStorage);
+        newMutable(view2);
+        BOOST_CHECK_EQUAL(co_await prefetch(view2, keys), 5);
+
+        std::vector<StateKey> backendReads;
+        view2.m_onBackendRead = [&](StateKey const& key) { backendReads.emplace_back(key); };
+        auto values = co_await storage2::readSome(view2, RANGES::iota_view<int, int>(0, 5) | toKey);
+        for (auto&& [index, value] : RANGES::views::enumerate(values))
+        {
+            BOOST_REQUIRE(value);
+            BOOST_CHECK_EQUAL(value->get(), fmt::format("value: {}", index));
+        }
+        BOOST_CHECK(backendReads.empty());
+
+        auto value = co_await storage2::readOne(view2, StateKey{"test_table"sv, "key: 7"sv});
+        BOOST_REQUIRE(value);
+        BOOST_CHECK_EQUAL(value->get(), "value: 7");
+        BOOST_CHECK_EQUAL(backendReads.size(), 1);
+
+        co_return;
+    }());
+}
+
+BOOST_AUTO_TEST_CASE(accessSetCacheLRU)
+{
+    AccessSetCache accessSetCache(3, AccessSetCache::SHARD_COUNT);
+    auto keysOf = [&](std::string_view table) {
+        std::vector<StateKey> keys;
+        accessSetCache.collect(table, keys);
+        std::vector<std::string> result;
+        for (auto const& key : keys)
+        {
+            auto [keyTable, keyName] = StateKeyView(key).get();
+            BOOST_CHECK_EQUAL(keyTable, table);
+            result.emplace_back(keyName);
+        }
+        return result;
+    };
+
+    for (auto key : {"a"sv, "b"sv, "c"sv})
+    {
+        accessSetCache.record(StateKey{"test_table"sv, key});
+    }
+    // The key read again is kept, the least recently read one is replaced by the new key
+    accessSetCache.record(StateKey{"test_table"sv, "a"sv});
+    accessSetCache.record(StateKey{"test_table"sv, "d"sv});
+    BOOST_CHECK(keysOf("test_table"sv) == std::vector<std::string>({"d", "a", "c"}));
+    BOOST_CHECK(keysOf("missing_table"sv).empty());
+
+    // One table per shard, the tables beyond are evicted
+    for (size_t i = 0; i < AccessSetCache::SHARD_COUNT * 4; ++i)
+    {
+        accessSetCache.record(StateKey{fmt::format("table_{}", i), "a"sv});
+    }
+    BOOST_CHECK_LE(accessSetCache.tableCount(), AccessSetCache::SHARD_COUNT);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -228,4 +228,123 @@ BOOST_AUTO_TEST_CASE(conflict)
     }());
 }
 
+struct MockDAGExecutor : public MockConflictExecutor
+{
+    // 每10笔交易中有一笔不声明冲突键
+    // One of every 10 transactions doesn't declare the conflict keys
+    friend task::Task<std::optional<std::vector<bytes>>> tag_invoke(
+        transaction_executor::tag_t<conflictKeys> /*unused*/, MockDAGExecutor& executor,
+        auto& storage, protocol::BlockHeader const& blockHeader,
+        protocol::Transaction const& transaction, ledger::LedgerConfig const& ledgerConfig)
+    {
+        auto input = transaction.input();
+        auto inputNum =
+            boost::lexical_cast<int>(std::string_view((const char*)input.data(), input.size()));
+        if (inputNum % 10 == 0)
+        {
+            co_return std::nullopt;
+        }
+        auto fromAddress = std::to_string(inputNum % MOCK_USER_COUNT);
+        auto toAddress = std::to_string((inputNum + (MOCK_USER_COUNT / 2)) % MOCK_USER_COUNT);
+        co_return std::vector<bytes>{bytes(fromAddress.begin(), fromAddress.end()),
+            bytes(toAddress.begin(), toAddress.end())};
+    }
+};
+
+BOOST_AUTO_TEST_CASE(dag)
+{
+    task::syncWait([&, this]() -> task::Task<void> {
+        MockDAGExecutor executor;
+        SchedulerParallelImpl<MutableStorage> scheduler;
+
+        auto view1 = fork(multiLayerStorage);
+        newMutable(view1);
+        pushView(multiLayerStorage, std::move(view1));
+
+        constexpr static int INITIAL_VALUE = 100000;
+        for (auto i : RANGES::views::iota(0LU, MOCK_USER_COUNT))
+        {
+            StateKey key{"t_test"sv, boost::lexical_cast<std::string>(i)};
+            storage::Entry entry;
+            entry.set(boost::lexical_cast<std::string>(INITIAL_VALUE));
+            co_await storage2::writeOne(*frontStorage(multiLayerStorage), key, std::move(entry));
+        }
+
+        bcostars::protocol::BlockHeaderImpl blockHeader(
+            [inner = bcostars::BlockHeader()]() mutable { return std::addressof(inner); });
+        constexpr static auto TRANSACTION_COUNT = 1000;
+        auto transactions =
+            RANGES::views::iota(0, TRANSACTION_COUNT) | RANGES::views::transform([](int index) {
+                auto transaction = std::make_unique<bcostars::protocol::TransactionImpl>();
+                auto num = boost::lexical_cast<std::string>(index);
+                transaction->mutableInner().data.input.assign(num.begin(), num.end());
+                transaction->setAttribute(protocol::Transaction::Attribute::DAG);
+
+                return transaction;
+            }) |
+            RANGES::to<std::vector<std::unique_ptr<bcostars::protocol::TransactionImpl>>>();
+        auto transactionRefs =
+            transactions | RANGES::views::transform([](auto& ptr) -> auto& { return *ptr; });
+        ledger::LedgerConfig ledgerConfig;
+        ledger::Features features;
+        features.set(ledger::Features::Flag::feature_dag_scheduler);
+        ledgerConfig.setFeatures(features);
+
+        // 声明了冲突键的交易不会重试
+        // The transactions with the conflict keys never retry
+        {
+            auto view = fork(multiLayerStorage);
+            newMutable(view);
+            auto conflictKeys =
+                getConflictKeys(view, executor, blockHeader, transactionRefs, ledgerConfig);
+            BOOST_CHECK(!conflictKeys[0]);
+            BOOST_REQUIRE(conflictKeys[1]);
+            BOOST_CHECK_EQUAL(conflictKeys[1]->size(), 2);
+            for (auto index = 0; index < TRANSACTION_COUNT; index += 10)
+            {
+                auto fromAddress = std::to_string(index % MOCK_USER_COUNT);
+                auto toAddress = std::to_string((index + (MOCK_USER_COUNT / 2)) % MOCK_USER_COUNT);
+                conflictKeys[index].emplace(std::vector<bytes>{
+                    bytes(fromAddress.begin(), fromAddress.end()),
+                    bytes(toAddress.begin(), toAddress.end())});
+            }
+
+            std::vector<protocol::TransactionReceipt::Ptr> receipts(TRANSACTION_COUNT);
+            std::vector<ExecutionContext> contexts;
+            for (auto index : RANGES::views::iota(0, TRANSACTION_COUNT))
+            {
+                contexts.emplace_back(index, std::addressof(transactionRefs[index]),
+                    std::addressof(receipts[index]));
+            }
+            auto retryCount = executeDAG(scheduler, view, executor, blockHeader, ledgerConfig,
+                contexts, conflictKeys);
+            BOOST_CHECK_EQUAL(retryCount, 0);
+            for (auto const& receipt : receipts)
+            {
+                BOOST_CHECK_EQUAL(receipt.get(), (bcos::protocol::TransactionReceipt*)0x10086);
+            }
+        }
+
+        auto view = fork(multiLayerStorage);
+        newMutable(view);
+        auto receipts = co_await bcos::transaction_scheduler::executeBlock(
+            scheduler, view, executor, blockHeader, transactionRefs, ledgerConfig);
+        pushView(multiLayerStorage, std::move(view));
+
+        for (auto i : RANGES::views::iota(0LU, MOCK_USER_COUNT))
+        {
+            StateKey key{"t_test"sv, boost::lexical_cast<std::string>(i)};
+            auto entry = co_await storage2::readOne(*frontStorage(multiLayerStorage), key);
+            BOOST_CHECK_EQUAL(boost::lexical_cast<int>(entry->get()), INITIAL_VALUE);
+        }
+        BOOST_CHECK_EQUAL(receipts.size(), TRANSACTION_COUNT);
+        for (auto const& receipt : receipts)
+        {
+            BOOST_CHECK_EQUAL(receipt.get(), (bcos::protocol::TransactionReceipt*)0x10086);
+        }
+
+        co_return;
+    }());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file